@@ -47,6 +47,58 @@ int openblas_get_parallel(void);
 /* OpenBLAS is compiled using OpenMP threading model */
 #define OPENBLAS_OPENMP 2
 
+/* Get the number of level 3 calls that reused the calling thread's cached workspace (hits)
+   and that had to take a buffer from the shared memory pool (misses) */
+void openblas_get_workspace_stats(size_t *hits, size_t *misses);
+
+/* Times candidate GEMM blocking sizes for the current core, applies the fastest ones and
+   stores them in the autotune cache file. Returns -1 if the sizes are fixed at build time */
+int openblas_autotune(void);
+
+/* Page size used for the BLAS buffers mapped from now on; openblas_set_hugepages returns the previous
+   setting, or -1 if mode is not one of these */
+#define OPENBLAS_HUGEPAGES_NONE 0
+/* Transparent huge pages (madvise) */
+#define OPENBLAS_HUGEPAGES_THP  1
+/* 2MB hugetlb pages */
+#define OPENBLAS_HUGEPAGES_2M   2
+/* 1GB hugetlb pages */
+#define OPENBLAS_HUGEPAGES_1G   3
+int openblas_set_hugepages(int mode);
+int openblas_get_hugepages(void);
+/* Number of buffers mapped with each of the page sizes above, counts[OPENBLAS_HUGEPAGES_1G + 1] */
+void openblas_get_hugepage_stats(size_t *counts);
+
+/* Splits large threaded GEMM calls by NUMA node: every node packs its own panels of B for its
+   part of C, on the threads bound to it. openblas_set_numa_gemm returns the previous setting */
+int openblas_set_numa_gemm(int enable);
+int openblas_get_numa_gemm(void);
+
+/* Relative speed (1 to 1024) of the core of an OpenBLAS thread, which weights its share of threaded calls.
+   It is detected on hybrid machines; a value set here overrides it, 0 restores it. `thread_idx` is as for
+   openblas_setaffinity. Returns -1 for an invalid thread or capacity */
+int openblas_set_thread_capacity(int thread_idx, int capacity);
+int openblas_get_thread_capacity(int thread_idx);
+
+/* Lets the threads of level 3 calls take blocks of C from a shared counter instead of fixed slices, so that
+   a preempted thread delays only the blocks it holds. openblas_set_dynamic_gemm returns the previous setting */
+int openblas_set_dynamic_gemm(int enable);
+int openblas_get_dynamic_gemm(void);
+
+/* A context is a separate pool of OpenBLAS threads. BLAS calls made by a thread
+   run on the pool of the context it made current, or on the default pool if none */
+typedef struct openblas_context *openblas_context_t;
+openblas_context_t openblas_context_create(int num_threads);
+void openblas_context_destroy(openblas_context_t context);
+/* Returns the previously current context; NULL selects the default pool */
+openblas_context_t openblas_context_set_current(openblas_context_t context);
+openblas_context_t openblas_context_get_current(void);
+int openblas_context_get_num_threads(openblas_context_t context);
+#ifdef OPENBLAS_OS_LINUX
+/* Sets the affinity of the threads a context adds to the calling thread */
+int openblas_context_setaffinity(openblas_context_t context, size_t cpusetsize, cpu_set_t* cpu_set);
+#endif
+
 
 /*
  * Since all of GotoBlas was written without const,
@@ -64,6 +116,11 @@ typedef enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=1
 typedef enum CBLAS_UPLO      {CblasUpper=121, CblasLower=122} CBLAS_UPLO;
 typedef enum CBLAS_DIAG      {CblasNonUnit=131, CblasUnit=132} CBLAS_DIAG;
 typedef enum CBLAS_SIDE      {CblasLeft=141, CblasRight=142} CBLAS_SIDE;
+typedef enum CBLAS_STORAGE   {CblasPacked=151} CBLAS_STORAGE;
+typedef enum CBLAS_IDENTIFIER {CblasAMatrix=161, CblasBMatrix=162} CBLAS_IDENTIFIER;
+typedef enum CBLAS_OFFSET     {CblasRowOffset=171, CblasColOffset=172, CblasFixOffset=173} CBLAS_OFFSET;
+typedef enum CBLAS_BIAS       {CblasNoBias=181, CblasRowBias=182, CblasColBias=183} CBLAS_BIAS;
+typedef enum CBLAS_ACTIVATION {CblasNoActivation=191, CblasReLU=192, CblasGELU=193, CblasGELUTanh=194, CblasSigmoid=195} CBLAS_ACTIVATION;
 typedef CBLAS_ORDER CBLAS_LAYOUT;
 	
 float  cblas_sdsdot(OPENBLAS_CONST blasint n, OPENBLAS_CONST float alpha, OPENBLAS_CONST float *x, OPENBLAS_CONST blasint incx, OPENBLAS_CONST float *y, OPENBLAS_CONST blasint incy);
@@ -428,6 +485,120 @@ void cblas_cgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enu
 void cblas_zgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransA_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransB_array, OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST blasint * K_array,
 		       OPENBLAS_CONST void * alpha_array, OPENBLAS_CONST void ** A_array, OPENBLAS_CONST blasint * lda_array, OPENBLAS_CONST void ** B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST void * beta_array, void ** C_array, OPENBLAS_CONST blasint * ldc_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
 
+/* Batched GEMM with all members of one shape; member i uses A + i*strideA, B + i*strideB and C + i*strideC,
+   a stride of 0 shares that operand between all members */
+void cblas_sgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			       OPENBLAS_CONST float alpha, OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideB,
+			       OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint strideC, OPENBLAS_CONST blasint batch_size);
+void cblas_dgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			       OPENBLAS_CONST double alpha, OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST double *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideB,
+			       OPENBLAS_CONST double beta, double *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint strideC, OPENBLAS_CONST blasint batch_size);
+void cblas_cgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			       OPENBLAS_CONST void *alpha, OPENBLAS_CONST void *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST void *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideB,
+			       OPENBLAS_CONST void *beta, void *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint strideC, OPENBLAS_CONST blasint batch_size);
+void cblas_zgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			       OPENBLAS_CONST void *alpha, OPENBLAS_CONST void *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST void *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideB,
+			       OPENBLAS_CONST void *beta, void *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint strideC, OPENBLAS_CONST blasint batch_size);
+
+/* Batched GEMV, AXPY, SCAL and DOT. The members of a batch are independent and are distributed over the threads;
+   group variants take one set of arguments per group of group_size[i] members, strided variants one shape for all */
+void cblas_sgemv_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE * Trans_array, OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array,
+		       OPENBLAS_CONST float *alpha_array, OPENBLAS_CONST float **A_array, OPENBLAS_CONST blasint * lda_array, OPENBLAS_CONST float **X_array, OPENBLAS_CONST blasint * incX_array,
+		       OPENBLAS_CONST float *beta_array, float **Y_array, OPENBLAS_CONST blasint * incY_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_sgemv_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N,
+			       OPENBLAS_CONST float alpha, OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST float *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			       OPENBLAS_CONST float beta, float *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size);
+void cblas_saxpy_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST float *alpha_array, OPENBLAS_CONST float **X_array, OPENBLAS_CONST blasint * incX_array,
+		       float **Y_array, OPENBLAS_CONST blasint * incY_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_saxpy_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST float alpha, OPENBLAS_CONST float *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			       float *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size);
+void cblas_sscal_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST float *alpha_array, float **X_array, OPENBLAS_CONST blasint * incX_array,
+		       OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_sscal_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST float alpha, float *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX, OPENBLAS_CONST blasint batch_size);
+void cblas_sdot_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST float **X_array, OPENBLAS_CONST blasint * incX_array, OPENBLAS_CONST float **Y_array, OPENBLAS_CONST blasint * incY_array,
+		      OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size, float *result);
+void cblas_sdot_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST float *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			      OPENBLAS_CONST float *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size, float *result);
+void cblas_dgemv_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE * Trans_array, OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array,
+		       OPENBLAS_CONST double *alpha_array, OPENBLAS_CONST double **A_array, OPENBLAS_CONST blasint * lda_array, OPENBLAS_CONST double **X_array, OPENBLAS_CONST blasint * incX_array,
+		       OPENBLAS_CONST double *beta_array, double **Y_array, OPENBLAS_CONST blasint * incY_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_dgemv_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N,
+			       OPENBLAS_CONST double alpha, OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST double *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			       OPENBLAS_CONST double beta, double *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size);
+void cblas_daxpy_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST double *alpha_array, OPENBLAS_CONST double **X_array, OPENBLAS_CONST blasint * incX_array,
+		       double **Y_array, OPENBLAS_CONST blasint * incY_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_daxpy_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST double alpha, OPENBLAS_CONST double *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			       double *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size);
+void cblas_dscal_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST double *alpha_array, double **X_array, OPENBLAS_CONST blasint * incX_array,
+		       OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_dscal_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST double alpha, double *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX, OPENBLAS_CONST blasint batch_size);
+void cblas_ddot_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST double **X_array, OPENBLAS_CONST blasint * incX_array, OPENBLAS_CONST double **Y_array, OPENBLAS_CONST blasint * incY_array,
+		      OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size, double *result);
+void cblas_ddot_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST double *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			      OPENBLAS_CONST double *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size, double *result);
+void cblas_cgemv_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE * Trans_array, OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array,
+		       OPENBLAS_CONST void *alpha_array, OPENBLAS_CONST void **A_array, OPENBLAS_CONST blasint * lda_array, OPENBLAS_CONST void **X_array, OPENBLAS_CONST blasint * incX_array,
+		       OPENBLAS_CONST void *beta_array, void **Y_array, OPENBLAS_CONST blasint * incY_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_cgemv_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N,
+			       OPENBLAS_CONST void *alpha, OPENBLAS_CONST void *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST void *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			       OPENBLAS_CONST void *beta, void *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size);
+void cblas_caxpy_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST void *alpha_array, OPENBLAS_CONST void **X_array, OPENBLAS_CONST blasint * incX_array,
+		       void **Y_array, OPENBLAS_CONST blasint * incY_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_caxpy_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST void *alpha, OPENBLAS_CONST void *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			       void *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size);
+void cblas_cscal_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST void *alpha_array, void **X_array, OPENBLAS_CONST blasint * incX_array,
+		       OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_cscal_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST void *alpha, void *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX, OPENBLAS_CONST blasint batch_size);
+void cblas_zgemv_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE * Trans_array, OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array,
+		       OPENBLAS_CONST void *alpha_array, OPENBLAS_CONST void **A_array, OPENBLAS_CONST blasint * lda_array, OPENBLAS_CONST void **X_array, OPENBLAS_CONST blasint * incX_array,
+		       OPENBLAS_CONST void *beta_array, void **Y_array, OPENBLAS_CONST blasint * incY_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_zgemv_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N,
+			       OPENBLAS_CONST void *alpha, OPENBLAS_CONST void *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST void *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			       OPENBLAS_CONST void *beta, void *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size);
+void cblas_zaxpy_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST void *alpha_array, OPENBLAS_CONST void **X_array, OPENBLAS_CONST blasint * incX_array,
+		       void **Y_array, OPENBLAS_CONST blasint * incY_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_zaxpy_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST void *alpha, OPENBLAS_CONST void *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX,
+			       void *Y, OPENBLAS_CONST blasint incY, OPENBLAS_CONST blasint strideY, OPENBLAS_CONST blasint batch_size);
+void cblas_zscal_batch(OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST void *alpha_array, void **X_array, OPENBLAS_CONST blasint * incX_array,
+		       OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_zscal_batch_strided(OPENBLAS_CONST blasint N, OPENBLAS_CONST void *alpha, void *X, OPENBLAS_CONST blasint incX, OPENBLAS_CONST blasint strideX, OPENBLAS_CONST blasint batch_size);
+
+/* C_j = alpha*op(A)*op(B_j) + beta*C_j for j = 0 .. nrhs-1, where op(B_j) is K x N_array[j] and C_j is M x N_array[j];
+   each block of A is packed once and used for all B_j */
+void cblas_sgemm_multi_rhs(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint K,
+			   OPENBLAS_CONST float alpha, OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint nrhs, OPENBLAS_CONST blasint * N_array,
+			   OPENBLAS_CONST float **B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST float beta, float **C_array, OPENBLAS_CONST blasint * ldc_array);
+void cblas_dgemm_multi_rhs(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint K,
+			   OPENBLAS_CONST double alpha, OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint nrhs, OPENBLAS_CONST blasint * N_array,
+			   OPENBLAS_CONST double **B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST double beta, double **C_array, OPENBLAS_CONST blasint * ldc_array);
+
+/* GEMM followed by C = act(C + bias), applied to each block of C as soon as it is complete. With CblasRowBias bias[i]
+   is added to row i of C, with CblasColBias bias[j] to column j. If C_bf16 is not NULL the result is also stored there
+   as bfloat16, in the same order as C and with leading dimension ldc_bf16. */
+typedef struct {
+  enum CBLAS_BIAS bias_type;
+  OPENBLAS_CONST float *bias;
+  enum CBLAS_ACTIVATION activation;
+  bfloat16 *C_bf16;
+  blasint ldc_bf16;
+} openblas_gemm_epilogue_t;
+
+void cblas_sgemm_ex(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		    OPENBLAS_CONST float alpha, OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc,
+		    OPENBLAS_CONST openblas_gemm_epilogue_t *epilogue);
+
+/* GEMM with operands packed once ahead of time; pass CblasPacked as TransA/TransB to cblas_?gemm_compute for a packed operand */
+size_t cblas_sgemm_pack_get_size(OPENBLAS_CONST enum CBLAS_IDENTIFIER Identifier, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K);
+size_t cblas_dgemm_pack_get_size(OPENBLAS_CONST enum CBLAS_IDENTIFIER Identifier, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K);
+void cblas_sgemm_pack(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_IDENTIFIER Identifier, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		      OPENBLAS_CONST float alpha, OPENBLAS_CONST float *src, OPENBLAS_CONST blasint ld, float *dest);
+void cblas_dgemm_pack(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_IDENTIFIER Identifier, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		      OPENBLAS_CONST double alpha, OPENBLAS_CONST double *src, OPENBLAS_CONST blasint ld, double *dest);
+void cblas_sgemm_compute(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST blasint TransA, OPENBLAS_CONST blasint TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			 OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc);
+void cblas_dgemm_compute(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST blasint TransA, OPENBLAS_CONST blasint TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			 OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST double *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST double beta, double *C, OPENBLAS_CONST blasint ldc);
+
 /*** BFLOAT16 and INT8 extensions ***/
 /* convert float array to BFLOAT16 array by rounding */
 void   cblas_sbstobf16(OPENBLAS_CONST blasint n, OPENBLAS_CONST float  *in, OPENBLAS_CONST blasint incin, bfloat16 *out, OPENBLAS_CONST blasint incout);
@@ -445,6 +616,20 @@ void   cblas_sbgemm(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum C
 		    OPENBLAS_CONST float alpha, OPENBLAS_CONST bfloat16 *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST bfloat16 *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc);
 void cblas_sbgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransA_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransB_array, OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST blasint * K_array,
 		       OPENBLAS_CONST float * alpha_array, OPENBLAS_CONST bfloat16 ** A_array, OPENBLAS_CONST blasint * lda_array, OPENBLAS_CONST bfloat16 ** B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST float * beta_array, float ** C_array, OPENBLAS_CONST blasint * ldc_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+void cblas_sbgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+				OPENBLAS_CONST float alpha, OPENBLAS_CONST bfloat16 *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint strideA, OPENBLAS_CONST bfloat16 *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideB,
+				OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint strideC, OPENBLAS_CONST blasint batch_size);
+
+/*** IEEE half precision (HFLOAT16) extensions, fp16 inputs with float accumulation and output ***/
+void   cblas_shgemv(OPENBLAS_CONST enum CBLAS_ORDER order,  OPENBLAS_CONST enum CBLAS_TRANSPOSE trans,  OPENBLAS_CONST blasint m, OPENBLAS_CONST blasint n, OPENBLAS_CONST float alpha, OPENBLAS_CONST hfloat16 *a, OPENBLAS_CONST blasint lda, OPENBLAS_CONST hfloat16 *x, OPENBLAS_CONST blasint incx, OPENBLAS_CONST float beta, float *y, OPENBLAS_CONST blasint incy);
+void   cblas_shgemm(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		    OPENBLAS_CONST float alpha, OPENBLAS_CONST hfloat16 *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST hfloat16 *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc);
+
+/*** 8-bit integer GEMM, C = alpha*(op(A)+ao)*(op(B)+bo) + beta*C + co with unsigned A, signed B and int32 C ***/
+void cblas_gemm_s8u8s32(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST enum CBLAS_OFFSET OffsetC,
+			OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K, OPENBLAS_CONST float alpha,
+			OPENBLAS_CONST void *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST int8_t ao, OPENBLAS_CONST void *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST int8_t bo,
+			OPENBLAS_CONST float beta, int32_t *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST int32_t *co);
 
 #ifdef __cplusplus
 }
@@ -194,6 +194,10 @@ if (BUILD_BFLOAT16)
   SetFallback(SBGEMVTKERNEL ../x86_64/sbgemv_t.c)
   SetFallback(SHGERKERNEL ../generic/ger.c)
 endif ()
+if (BUILD_HFLOAT16)
+  SetFallback(SHGEMVNKERNEL ../generic/shgemv_n.c)
+  SetFallback(SHGEMVTKERNEL ../generic/shgemv_t.c)
+endif ()
 endmacro ()
 
 macro(SetDefaultL3)
@@ -214,5 +218,29 @@ if (BUILD_BFLOAT16)
   SetFallback(SBGEMMONCOPYOBJ sbgemm_oncopy.o)
   SetFallback(SBGEMMOTCOPYOBJ sbgemm_otcopy.o)
 endif ()
+if (BUILD_HFLOAT16)
+  SetFallback(SHGEMMKERNEL ../generic/gemmkernel_2x2.c)
+  SetFallback(SHGEMM_BETA  ../generic/gemm_beta.c)
+  SetFallback(SHGEMMINCOPY ../generic/gemm_ncopy_2.c)
+  SetFallback(SHGEMMITCOPY ../generic/gemm_tcopy_2.c)
+  SetFallback(SHGEMMONCOPY ../generic/gemm_ncopy_2.c)
+  SetFallback(SHGEMMOTCOPY ../generic/gemm_tcopy_2.c)
+  SetFallback(SHGEMMINCOPYOBJ shgemm_incopy.o)
+  SetFallback(SHGEMMITCOPYOBJ shgemm_itcopy.o)
+  SetFallback(SHGEMMONCOPYOBJ shgemm_oncopy.o)
+  SetFallback(SHGEMMOTCOPYOBJ shgemm_otcopy.o)
+endif ()
+if (BUILD_INT8)
+  SetFallback(I8GEMMKERNEL ../generic/i8gemm_kernel_4x4.c)
+  SetFallback(I8GEMM_BETA  ../generic/i8gemm_beta.c)
+  SetFallback(I8GEMMINCOPY ../generic/i8gemm_ncopy_4.c)
+  SetFallback(I8GEMMITCOPY ../generic/i8gemm_tcopy_4.c)
+  SetFallback(I8GEMMONCOPY ../generic/i8gemm_ncopy_4.c)
+  SetFallback(I8GEMMOTCOPY ../generic/i8gemm_tcopy_4.c)
+  SetFallback(I8GEMMINCOPYOBJ i8gemm_incopy.o)
+  SetFallback(I8GEMMITCOPYOBJ i8gemm_itcopy.o)
+  SetFallback(I8GEMMONCOPYOBJ i8gemm_oncopy.o)
+  SetFallback(I8GEMMOTCOPYOBJ i8gemm_otcopy.o)
+endif ()
 
 endmacro ()
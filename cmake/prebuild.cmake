@@ -331,6 +331,8 @@ if (DEFINED CORE AND CMAKE_CROSSCOMPILING AND NOT (${HOST_OS} STREQUAL "WINDOWSS
       set(HAVE_FMA3 1)
       set(SBGEMM_UNROLL_M 8)
       set(SBGEMM_UNROLL_N 4)
+      set(SHGEMM_UNROLL_M 16)
+      set(SHGEMM_UNROLL_N 4)
       set(SGEMM_UNROLL_M 8)
       set(SGEMM_UNROLL_N 4)
       set(DGEMM_UNROLL_M 4)
@@ -381,6 +383,8 @@ if (DEFINED CORE AND CMAKE_CROSSCOMPILING AND NOT (${HOST_OS} STREQUAL "WINDOWSS
       set(HAVE_AVX512VL 1)
       set(SBGEMM_UNROLL_M 8)
       set(SBGEMM_UNROLL_N 4)
+      set(SHGEMM_UNROLL_M 16)
+      set(SHGEMM_UNROLL_N 4)
       set(SGEMM_UNROLL_M 16)
       set(SGEMM_UNROLL_N 4)
       set(DGEMM_UNROLL_M 16)
@@ -433,6 +437,8 @@ if (DEFINED CORE AND CMAKE_CROSSCOMPILING AND NOT (${HOST_OS} STREQUAL "WINDOWSS
       set(HAVE_AVX512BF16 1)
       set(SBGEMM_UNROLL_M 16)
       set(SBGEMM_UNROLL_N 4)
+      set(SHGEMM_UNROLL_M 16)
+      set(SHGEMM_UNROLL_N 4)
       set(SGEMM_UNROLL_M 16)
       set(SGEMM_UNROLL_N 4)
       set(DGEMM_UNROLL_M 16)
@@ -485,6 +491,8 @@ if (DEFINED CORE AND CMAKE_CROSSCOMPILING AND NOT (${HOST_OS} STREQUAL "WINDOWSS
       set(HAVE_AVX512BF16 1)
       set(SBGEMM_UNROLL_M 32)
       set(SBGEMM_UNROLL_N 16)
+      set(SHGEMM_UNROLL_M 16)
+      set(SHGEMM_UNROLL_N 4)
       set(SGEMM_UNROLL_M 16)
       set(SGEMM_UNROLL_N 4)
       set(DGEMM_UNROLL_M 16)
@@ -811,6 +819,8 @@ if (DEFINED CORE AND CMAKE_CROSSCOMPILING AND NOT (${HOST_OS} STREQUAL "WINDOWSS
       set(HAVE_CFLUSH 1)
       set(SBGEMM_UNROLL_M 8)
       set(SBGEMM_UNROLL_N 4)
+      set(SHGEMM_UNROLL_M 16)
+      set(SHGEMM_UNROLL_N 4)
       set(SGEMM_UNROLL_M 8)
       set(SGEMM_UNROLL_N 4)
       set(DGEMM_UNROLL_M 4)
@@ -1352,6 +1362,12 @@ endif ()
   endif()
   set(SBGEMM_UNROLL_M 8)
   set(SBGEMM_UNROLL_N 4)
+  if (NOT DEFINED SHGEMM_UNROLL_M)
+    set(SHGEMM_UNROLL_M 8)
+  endif()
+  if (NOT DEFINED SHGEMM_UNROLL_N)
+    set(SHGEMM_UNROLL_N 4)
+  endif()
 
   # Or should this actually be NUM_CORES?
   if (${NUM_THREADS} GREATER 0)
@@ -326,6 +326,8 @@ function(GenerateNamedObjects sources_in)
     list(REMOVE_ITEM float_list "SINGLE")
     list(REMOVE_ITEM float_list "DOUBLE")
     list(REMOVE_ITEM float_list "BFLOAT16")
+    list(REMOVE_ITEM float_list "HFLOAT16")
+    list(REMOVE_ITEM float_list "INT8")
   elseif (real_only)
     list(REMOVE_ITEM float_list "COMPLEX")
     list(REMOVE_ITEM float_list "ZCOMPLEX")
@@ -342,6 +344,12 @@ function(GenerateNamedObjects sources_in)
 	if (${float_type} STREQUAL "BFLOAT16")
 		set (float_char "sb")
 	endif ()
+	if (${float_type} STREQUAL "HFLOAT16")
+		set (float_char "sh")
+	endif ()
+	if (${float_type} STREQUAL "INT8")
+		set (float_char "i8")
+	endif ()
       endif ()
 
       if (NOT name_in)
@@ -392,6 +400,12 @@ function(GenerateNamedObjects sources_in)
       if (${float_type} STREQUAL "BFLOAT16")
         list(APPEND obj_defines "BFLOAT16")
       endif ()
+      if (${float_type} STREQUAL "HFLOAT16")
+        list(APPEND obj_defines "HFLOAT16")
+      endif ()
+      if (${float_type} STREQUAL "INT8")
+        list(APPEND obj_defines "INT8")
+      endif ()
       if (${float_type} STREQUAL "COMPLEX" OR ${float_type} STREQUAL "ZCOMPLEX")
         list(APPEND obj_defines "COMPLEX")
         if (mangle_complex_sources)
@@ -430,6 +444,9 @@ function(GenerateNamedObjects sources_in)
         if ( ${new_source_file} MATCHES "dgemv_t_k.*c")
 		set_source_files_properties(${new_source_file} PROPERTIES COMPILE_OPTIONS "-mfma")
         endif ()
+        if ( ${old_source_file} MATCHES "x86_64/sh(gemm_kernel_16x4_haswell|gemv_n|gemv_t).c")
+		set_source_files_properties(${new_source_file} PROPERTIES COMPILE_OPTIONS "-mfma;-mf16c")
+        endif ()
       endif ()
     endforeach ()
   endforeach ()
@@ -266,6 +266,11 @@ typedef uint16_t bfloat16;
 #define BFLOAT16CONVERSION 1
 #endif
 
+#ifndef hfloat16
+#include <stdint.h>
+typedef uint16_t hfloat16;
+#endif
+
 #ifdef USE64BITINT
 typedef BLASLONG blasint;
 #if defined(OS_WINDOWS) && defined(__64BIT__)
@@ -313,6 +318,20 @@ typedef int blasint;
 #define SIZE   2
 #define BASE_SHIFT 1
 #define ZBASE_SHIFT 2
+#elif defined(HFLOAT16)
+#define IFLOAT	hfloat16
+#define XFLOAT IFLOAT
+#define FLOAT	float
+#define SIZE   2
+#define BASE_SHIFT 1
+#define ZBASE_SHIFT 2
+#elif defined(INT8)
+#define IFLOAT	int8_t
+#define XFLOAT IFLOAT
+#define FLOAT	float
+#define SIZE   1
+#define BASE_SHIFT 0
+#define ZBASE_SHIFT 1
 #else
 #define FLOAT	float
 #define SIZE    4
@@ -677,6 +696,18 @@ void *blas_memory_alloc  (int);
 void  blas_memory_free   (void *);
 void *blas_memory_alloc_nolock  (int); //use malloc without blas_lock
 void  blas_memory_free_nolock   (void *);
+void *blas_workspace_alloc (void); //level 3 buffer, cached per calling thread
+void  blas_workspace_free  (void *);
+extern volatile int blas_memory_generation;
+/* Huge page backends, same values as in cblas.h */
+#define OPENBLAS_HUGEPAGES_NONE 0
+#define OPENBLAS_HUGEPAGES_THP  1
+#define OPENBLAS_HUGEPAGES_2M   2
+#define OPENBLAS_HUGEPAGES_1G   3
+void *blas_hugepage_map    (BLASULONG, int, BLASULONG *); //(void *)-1 unless a huge page backend is selected
+void  blas_hugepage_unmap  (void *, BLASULONG);
+void  blas_hugepage_account(int);
+int   blas_memory_node     (void);
 
 int  get_num_procs (void);
 
@@ -684,6 +715,17 @@ int  get_num_procs (void);
 int  get_num_nodes (void);
 int get_num_proc   (int);
 int get_node_equal (void);
+int get_node_threads(int *, int *, int);
+#endif
+int openblas_get_numa_gemm(void);
+int openblas_get_dynamic_gemm(void);
+
+/* Relative speed of a core, see driver/others/blas_capacity.c */
+#define BLAS_CAPACITY_FULL 1024
+int  blas_hybrid_cores(void);
+void blas_capacity_probe(void);
+#if defined(OS_LINUX) && defined(SMP)
+int  blas_cpuset_capacity(size_t, const cpu_set_t *);
 #endif
 
 void goto_set_num_threads(int);
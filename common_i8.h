@@ -0,0 +1,43 @@
+#ifndef COMMON_I8_H
+#define COMMON_I8_H
+
+#ifndef DYNAMIC_ARCH
+
+#define	I8GEMM_ONCOPY		i8gemm_oncopy
+#define	I8GEMM_OTCOPY		i8gemm_otcopy
+#define	I8GEMM_INCOPY		i8gemm_incopy
+#define	I8GEMM_ITCOPY		i8gemm_itcopy
+#define	I8GEMM_BETA		i8gemm_beta
+#define I8GEMM_KERNEL            i8gemm_kernel
+
+#else
+
+#define	I8GEMM_ONCOPY		gotoblas -> i8gemm_oncopy
+#define	I8GEMM_OTCOPY		gotoblas -> i8gemm_otcopy
+#define	I8GEMM_INCOPY		gotoblas -> i8gemm_incopy
+#define	I8GEMM_ITCOPY		gotoblas -> i8gemm_itcopy
+#define	I8GEMM_BETA		gotoblas -> i8gemm_beta
+#define	I8GEMM_KERNEL		gotoblas -> i8gemm_kernel
+
+#endif
+
+#define	I8GEMM_NN		i8gemm_nn
+#define	I8GEMM_TN		i8gemm_tn
+#define	I8GEMM_NT		i8gemm_nt
+#define	I8GEMM_TT		i8gemm_tt
+
+#define	I8GEMM_THREAD_NN		i8gemm_thread_nn
+#define	I8GEMM_THREAD_TN		i8gemm_thread_tn
+#define	I8GEMM_THREAD_NT		i8gemm_thread_nt
+#define	I8GEMM_THREAD_TT		i8gemm_thread_tt
+
+#ifndef ASSEMBLER
+/* Round to nearest and saturate when scaling an int32 GEMM result by a float alpha or beta */
+static __inline int32_t i8gemm_round(double x) {
+  if (x >=  2147483647.0) return  2147483647;
+  if (x <= -2147483648.0) return (-2147483647 - 1);
+  return (int32_t)(x < 0. ? x - 0.5 : x + 0.5);
+}
+#endif
+
+#endif
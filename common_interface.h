@@ -257,6 +257,8 @@ void BLASFUNC(xgerc)(blasint *,    blasint *, xdouble *, xdouble *, blasint *,
 
 void BLASFUNC(sbgemv)(char *, blasint *, blasint *, float  *, bfloat16 *, blasint *,
             bfloat16  *, blasint *, float  *, float  *, blasint *);
+void BLASFUNC(shgemv)(char *, blasint *, blasint *, float  *, hfloat16 *, blasint *,
+            hfloat16  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(sgemv)(char *, blasint *, blasint *, float  *, float  *, blasint *,
 		    float  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(dgemv)(char *, blasint *, blasint *, double *, double *, blasint *,
@@ -483,6 +485,8 @@ void BLASFUNC(xhbmv)(char *, blasint *, blasint *, xdouble *, xdouble *, blasint
 
 void BLASFUNC(sbgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
 	   bfloat16 *, blasint *, bfloat16 *, blasint *, float *, float *, blasint *);
+void BLASFUNC(shgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
+	   hfloat16 *, blasint *, hfloat16 *, blasint *, float *, float *, blasint *);
 void BLASFUNC(sgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
 	   float  *, blasint *, float  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(dgemm)(char *, char *, blasint *, blasint *, blasint *, double *,
@@ -704,6 +708,7 @@ int BLASFUNC(xgetrs)(char *, blasint *, blasint *, xdouble *, blasint *, blasint
 
 int BLASFUNC(sgesv)(blasint *, blasint *, float  *, blasint *, blasint *, float *, blasint *, blasint *);
 int BLASFUNC(dgesv)(blasint *, blasint *, double *, blasint *, blasint *, double*, blasint *, blasint *);
+int BLASFUNC(dsgesv)(blasint *, blasint *, double *, blasint *, blasint *, double *, blasint *, double *, blasint *, double *, float *, blasint *, blasint *);
 int BLASFUNC(qgesv)(blasint *, blasint *, xdouble *, blasint *, blasint *, xdouble*, blasint *, blasint *);
 int BLASFUNC(cgesv)(blasint *, blasint *, float  *, blasint *, blasint *, float *, blasint *, blasint *);
 int BLASFUNC(zgesv)(blasint *, blasint *, double *, blasint *, blasint *, double*, blasint *, blasint *);
@@ -737,6 +742,18 @@ int BLASFUNC(cpotrs)(char *, blasint *, blasint *, float   *, blasint *, float
 int BLASFUNC(zpotrs)(char *, blasint *, blasint *, double  *, blasint *, double  *, blasint *, blasint *);
 int BLASFUNC(xpotrs)(char *, blasint *, blasint *, xdouble *, blasint *, xdouble *, blasint *, blasint *);
 
+int BLASFUNC(sgeqrf)(blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(dgeqrf)(blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+
+int BLASFUNC(sorgqr)(blasint *, blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(dorgqr)(blasint *, blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+
+int BLASFUNC(sormqr)(char *, char *, blasint *, blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dormqr)(char *, char *, blasint *, blasint *, blasint *, double *, blasint *, double *, double *, blasint *, double *, blasint *, blasint *);
+
+int BLASFUNC(ssytrd_2stage)(char *, char *, blasint *, float  *, blasint *, float  *, float  *, float  *, float  *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dsytrd_2stage)(char *, char *, blasint *, double *, blasint *, double *, double *, double *, double *, blasint *, double *, blasint *, blasint *);
+
 int BLASFUNC(slauu2)(char *, blasint *, float  *, blasint *, blasint *);
 int BLASFUNC(dlauu2)(char *, blasint *, double *, blasint *, blasint *);
 int BLASFUNC(qlauu2)(char *, blasint *, xdouble *, blasint *, blasint *);
@@ -38,6 +38,11 @@
 
 #ifndef ASSEMBLER
 
+/* Block size of the native QR routines (geqrf, orgqr, ormqr) */
+#ifndef QR_NB
+#define QR_NB 64
+#endif
+
 /* Lapack Library */
 
 blasint sgetf2_k(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
@@ -293,6 +298,55 @@ blasint zlarf_R(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLO
 blasint xlarf_L(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 blasint xlarf_R(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 
+float  slarfg_k(BLASLONG, float  *);
+double dlarfg_k(BLASLONG, double *);
+int slarft_k(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int dlarft_k(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int slarfb_LN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int slarfb_LT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int slarfb_RN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int slarfb_RT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int dlarfb_LN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dlarfb_LT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dlarfb_RN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dlarfb_RT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint sgeqrf_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgeqrf_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint sgeqrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgeqrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint sorgqr_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dorgqr_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint sorgqr_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dorgqr_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint sormqr_LN_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_LT_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_RN_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_RT_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dormqr_LN_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_LT_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_RN_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_RT_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint sormqr_LN_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_LT_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_RN_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_RT_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dormqr_LN_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_LT_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_RN_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_RT_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint ssytrd_sy2sb_U(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint ssytrd_sy2sb_L(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dsytrd_sy2sb_U(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dsytrd_sy2sb_L(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint ssytrd_sb2st_U(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint ssytrd_sb2st_L(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dsytrd_sb2st_U(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dsytrd_sb2st_L(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
 blasint strtrs_UNU_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 blasint strtrs_UNN_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 blasint strtrs_UTU_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
@@ -57,6 +57,10 @@ int sgemm_direct_performant(BLASLONG M, BLASLONG N, BLASLONG K);
 
 int sbgemm_beta(BLASLONG, BLASLONG, BLASLONG, float,
 	       bfloat16 *, BLASLONG, bfloat16 *, BLASLONG, float *, BLASLONG);
+int shgemm_beta(BLASLONG, BLASLONG, BLASLONG, float,
+	       hfloat16 *, BLASLONG, hfloat16 *, BLASLONG, float *, BLASLONG);
+int i8gemm_beta(BLASLONG, BLASLONG, BLASLONG, float,
+	       int8_t *, BLASLONG, int8_t *, BLASLONG, float *, BLASLONG);
 int sgemm_beta(BLASLONG, BLASLONG, BLASLONG, float,
 	       float  *, BLASLONG, float   *, BLASLONG, float  *, BLASLONG);
 int dgemm_beta(BLASLONG, BLASLONG, BLASLONG, double,
@@ -82,6 +86,14 @@ int sbgemm_incopy(BLASLONG m, BLASLONG n, bfloat16 *a, BLASLONG lda, bfloat16 *b
 int sbgemm_itcopy(BLASLONG m, BLASLONG n, bfloat16 *a, BLASLONG lda, bfloat16 *b);
 int sbgemm_oncopy(BLASLONG m, BLASLONG n, bfloat16 *a, BLASLONG lda, bfloat16 *b);
 int sbgemm_otcopy(BLASLONG m, BLASLONG n, bfloat16 *a, BLASLONG lda, bfloat16 *b);
+int shgemm_incopy(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, hfloat16 *b);
+int shgemm_itcopy(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, hfloat16 *b);
+int shgemm_oncopy(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, hfloat16 *b);
+int shgemm_otcopy(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, hfloat16 *b);
+int i8gemm_incopy(BLASLONG m, BLASLONG n, int8_t *a, BLASLONG lda, int8_t *b);
+int i8gemm_itcopy(BLASLONG m, BLASLONG n, int8_t *a, BLASLONG lda, int8_t *b);
+int i8gemm_oncopy(BLASLONG m, BLASLONG n, int8_t *a, BLASLONG lda, int8_t *b);
+int i8gemm_otcopy(BLASLONG m, BLASLONG n, int8_t *a, BLASLONG lda, int8_t *b);
 int sgemm_incopy(BLASLONG m, BLASLONG n, float *a, BLASLONG lda, float *b);
 int sgemm_itcopy(BLASLONG m, BLASLONG n, float *a, BLASLONG lda, float *b);
 int sgemm_oncopy(BLASLONG m, BLASLONG n, float *a, BLASLONG lda, float *b);
@@ -506,6 +518,8 @@ int xher2k_kernel_LN(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdoubl
 int xher2k_kernel_LC(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble alpha_i, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset, int flag);
 
 int sbgemm_kernel(BLASLONG, BLASLONG, BLASLONG, float,  bfloat16 *, bfloat16 *, float *, BLASLONG);
+int shgemm_kernel(BLASLONG, BLASLONG, BLASLONG, float,  hfloat16 *, hfloat16 *, float *, BLASLONG);
+int i8gemm_kernel(BLASLONG, BLASLONG, BLASLONG, float,  int8_t *, int8_t *, float *, BLASLONG);
 int sgemm_kernel(BLASLONG, BLASLONG, BLASLONG, float,  float  *, float  *, float  *, BLASLONG);
 int dgemm_kernel(BLASLONG, BLASLONG, BLASLONG, double, double *, double *, double *, BLASLONG);
 
@@ -661,6 +675,14 @@ int sbgemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLAS
 int sbgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
 int sbgemm_tn(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
 int sbgemm_tt(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
+int shgemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_tn(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_tt(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int i8gemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, int8_t *, int8_t *, BLASLONG);
+int i8gemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, int8_t *, int8_t *, BLASLONG);
+int i8gemm_tn(blas_arg_t *, BLASLONG *, BLASLONG *, int8_t *, int8_t *, BLASLONG);
+int i8gemm_tt(blas_arg_t *, BLASLONG *, BLASLONG *, int8_t *, int8_t *, BLASLONG);
 
 int sgemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 int sgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
@@ -718,6 +740,15 @@ int zgemm_ct(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG)
 int zgemm_cr(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
 int zgemm_cc(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
 
+#ifdef DYNAMIC_ARCH
+/* NN drivers built with PARAMTEST for openblas_autotune, blocking */
+/* sizes are taken from args -> gemm_p, gemm_q and gemm_r          */
+int sgemm_tune(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int dgemm_tune(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int cgemm_tune(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int zgemm_tune(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+#endif
+
 #ifdef QUAD_PRECISION
 int xgemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, xidouble *, xidouble *, BLASLONG);
 int xgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, xidouble *, xidouble *, BLASLONG);
@@ -758,6 +789,14 @@ int sbgemm_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16
 int sbgemm_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
 int sbgemm_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
 int sbgemm_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
+int shgemm_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int i8gemm_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, int8_t *, int8_t *, BLASLONG);
+int i8gemm_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, int8_t *, int8_t *, BLASLONG);
+int i8gemm_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, int8_t *, int8_t *, BLASLONG);
+int i8gemm_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, int8_t *, int8_t *, BLASLONG);
 
 int sgemm_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 int sgemm_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
@@ -1945,6 +1984,81 @@ int cgemm_batch_thread(blas_arg_t * queue, BLASLONG nums);
 int zgemm_batch_thread(blas_arg_t * queue, BLASLONG nums);
 int sbgemm_batch_thread(blas_arg_t * queue, BLASLONG nums);
 
+int sgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG, int);
+int dgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG, int);
+int cgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG, int);
+int zgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG, int);
+int sbgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG, int);
+
+int blas_batch_thread(blas_arg_t *, BLASLONG, BLASLONG, int);
+
+/* Descriptor (gemm_pack_t) stored in front of a buffer filled by ?gemm_pack. The panels
+   follow at byte offset "offset"; the panels of the K block starting at ls
+   begin at element ls * ld, and inside a block the panel holding row (or
+   column) i starts at min_l * i.                                          */
+
+#define GEMM_PACK_MAGIC		0x4f425000L
+#define GEMM_PACK_ALIGN		0x3fL
+
+#define GEMM_PACK_INNER		0	/* built with ICOPY, used as sa */
+#define GEMM_PACK_OUTER		1	/* built with OCOPY, used as sb */
+
+/* routine_mode flags understood by ?gemm_packed */
+#define GEMM_PACKED_A		0x1
+#define GEMM_PACKED_B		0x2
+#define GEMM_PACKED_TRANSA	0x4
+#define GEMM_PACKED_TRANSB	0x8
+
+int sgemm_packed(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+int dgemm_packed(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int sgemm_packed_thread(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+int dgemm_packed_thread(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+/* GEMM drivers of cblas_sgemm_ex. args -> d points to a gemm_epilogue_t
+   that sgemm_epilogue applies to every tile of C right after the kernel
+   call that completes it.                                              */
+
+#define GEMM_ACT_NONE		0
+#define GEMM_ACT_RELU		1
+#define GEMM_ACT_GELU		2
+#define GEMM_ACT_GELU_TANH	3
+#define GEMM_ACT_SIGMOID	4
+
+int sgemm_ex_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_tn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_tt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+
+int sgemm_epilogue(BLASLONG, BLASLONG, BLASLONG, BLASLONG, float *, BLASLONG, void *);
+
+/* GEMM drivers of cblas_?gemm_multi_rhs. args -> d points to a
+   gemm_multi_rhs_t that splits n (or m, with split_m set) into the
+   members rhs[0 .. nrhs-1]: member j covers [rhs[j].offset,
+   rhs[j + 1].offset) and holds the operand B (A if split_m) and the C
+   of that range; args -> b (args -> a) is ignored. One packed block of
+   the shared operand is used for all members.                        */
+
+int sgemm_multi_rhs_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_multi_rhs_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_multi_rhs_tn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_multi_rhs_tt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_multi_rhs_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_multi_rhs_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_multi_rhs_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_multi_rhs_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int dgemm_multi_rhs_nn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_multi_rhs_nt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_multi_rhs_tn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_multi_rhs_tt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_multi_rhs_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_multi_rhs_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_multi_rhs_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_multi_rhs_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
 #ifdef __CUDACC__
 }
 #endif
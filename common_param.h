@@ -164,6 +164,35 @@ BLASLONG (*isbmin_k) (BLASLONG, float *, BLASLONG);
 #endif
 #endif
 
+#if BUILD_HFLOAT16 == 1
+  int shgemm_p, shgemm_q, shgemm_r;
+  int shgemm_unroll_m, shgemm_unroll_n, shgemm_unroll_mn;
+
+  int    (*shgemv_n) (BLASLONG, BLASLONG, float, hfloat16 *, BLASLONG, hfloat16 *, BLASLONG, float, float *, BLASLONG);
+  int    (*shgemv_t) (BLASLONG, BLASLONG, float, hfloat16 *, BLASLONG, hfloat16 *, BLASLONG, float, float *, BLASLONG);
+
+  int    (*shgemm_kernel   )(BLASLONG, BLASLONG, BLASLONG, float, hfloat16 *, hfloat16 *, float *, BLASLONG);
+  int    (*shgemm_beta     )(BLASLONG, BLASLONG, BLASLONG, float, hfloat16 *, BLASLONG, hfloat16 *, BLASLONG, float *, BLASLONG);
+
+  int    (*shgemm_incopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, hfloat16 *);
+  int    (*shgemm_itcopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, hfloat16 *);
+  int    (*shgemm_oncopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, hfloat16 *);
+  int    (*shgemm_otcopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, hfloat16 *);
+#endif
+
+#if BUILD_INT8 == 1
+  int i8gemm_p, i8gemm_q, i8gemm_r;
+  int i8gemm_unroll_m, i8gemm_unroll_n, i8gemm_unroll_mn;
+
+  int    (*i8gemm_kernel   )(BLASLONG, BLASLONG, BLASLONG, float, int8_t *, int8_t *, float *, BLASLONG);
+  int    (*i8gemm_beta     )(BLASLONG, BLASLONG, BLASLONG, float, int8_t *, BLASLONG, int8_t *, BLASLONG, float *, BLASLONG);
+
+  int    (*i8gemm_incopy   )(BLASLONG, BLASLONG, int8_t *, BLASLONG, int8_t *);
+  int    (*i8gemm_itcopy   )(BLASLONG, BLASLONG, int8_t *, BLASLONG, int8_t *);
+  int    (*i8gemm_oncopy   )(BLASLONG, BLASLONG, int8_t *, BLASLONG, int8_t *);
+  int    (*i8gemm_otcopy   )(BLASLONG, BLASLONG, int8_t *, BLASLONG, int8_t *);
+#endif
+
 #if (BUILD_SINGLE == 1) || (BUILD_DOUBLE == 1) || (BUILD_COMPLEX == 1) || (BUILD_COMPLEX16 == 1)
   int sgemm_p, sgemm_q, sgemm_r;
   int sgemm_unroll_m, sgemm_unroll_n, sgemm_unroll_mn;
@@ -1230,6 +1259,24 @@ extern gotoblas_t *gotoblas;
 #define	SBGEMM_UNROLL_MN	gotoblas -> sbgemm_unroll_mn
 #endif
 
+#if (BUILD_HFLOAT16==1)
+#define	SHGEMM_P		gotoblas -> shgemm_p
+#define	SHGEMM_Q		gotoblas -> shgemm_q
+#define	SHGEMM_R		gotoblas -> shgemm_r
+#define	SHGEMM_UNROLL_M	gotoblas -> shgemm_unroll_m
+#define	SHGEMM_UNROLL_N	gotoblas -> shgemm_unroll_n
+#define	SHGEMM_UNROLL_MN	gotoblas -> shgemm_unroll_mn
+#endif
+
+#if (BUILD_INT8==1)
+#define	I8GEMM_P		gotoblas -> i8gemm_p
+#define	I8GEMM_Q		gotoblas -> i8gemm_q
+#define	I8GEMM_R		gotoblas -> i8gemm_r
+#define	I8GEMM_UNROLL_M	gotoblas -> i8gemm_unroll_m
+#define	I8GEMM_UNROLL_N	gotoblas -> i8gemm_unroll_n
+#define	I8GEMM_UNROLL_MN	gotoblas -> i8gemm_unroll_mn
+#endif
+
 #if (BUILD_SINGLE==1)
 #define	SGEMM_P		gotoblas -> sgemm_p
 #define	SGEMM_Q		gotoblas -> sgemm_q
@@ -1362,6 +1409,28 @@ extern gotoblas_t *gotoblas;
 #endif
 #endif
 
+#if (BUILD_HFLOAT16 == 1)
+#define	SHGEMM_P		SHGEMM_DEFAULT_P
+#define	SHGEMM_Q		SHGEMM_DEFAULT_Q
+#define	SHGEMM_R		SHGEMM_DEFAULT_R
+#define SHGEMM_UNROLL_M	SHGEMM_DEFAULT_UNROLL_M
+#define SHGEMM_UNROLL_N	SHGEMM_DEFAULT_UNROLL_N
+#ifdef  SHGEMM_DEFAULT_UNROLL_MN
+#define SHGEMM_UNROLL_MN	SHGEMM_DEFAULT_UNROLL_MN
+#else
+#define SHGEMM_UNROLL_MN	MAX((SHGEMM_UNROLL_M), (SHGEMM_UNROLL_N))
+#endif
+#endif
+
+#if (BUILD_INT8 == 1)
+#define	I8GEMM_P		I8GEMM_DEFAULT_P
+#define	I8GEMM_Q		I8GEMM_DEFAULT_Q
+#define	I8GEMM_R		I8GEMM_DEFAULT_R
+#define I8GEMM_UNROLL_M	I8GEMM_DEFAULT_UNROLL_M
+#define I8GEMM_UNROLL_N	I8GEMM_DEFAULT_UNROLL_N
+#define I8GEMM_UNROLL_MN	MAX((I8GEMM_UNROLL_M), (I8GEMM_UNROLL_N))
+#endif
+
 #define	SGEMM_P		SGEMM_DEFAULT_P
 #define	SGEMM_Q		SGEMM_DEFAULT_Q
 #define	SGEMM_R		SGEMM_DEFAULT_R
@@ -1509,6 +1578,30 @@ extern gotoblas_t *gotoblas;
 #define GEMM_DEFAULT_R		SBGEMM_DEFAULT_R
 #define GEMM_DEFAULT_UNROLL_M	SBGEMM_DEFAULT_UNROLL_M
 #define GEMM_DEFAULT_UNROLL_N	SBGEMM_DEFAULT_UNROLL_N
+#elif defined(HFLOAT16)
+#define GEMM_P			SHGEMM_P
+#define GEMM_Q			SHGEMM_Q
+#define GEMM_R			SHGEMM_R
+#define GEMM_UNROLL_M		SHGEMM_UNROLL_M
+#define GEMM_UNROLL_N		SHGEMM_UNROLL_N
+#define GEMM_UNROLL_MN		SHGEMM_UNROLL_MN
+#define GEMM_DEFAULT_P		SHGEMM_DEFAULT_P
+#define GEMM_DEFAULT_Q		SHGEMM_DEFAULT_Q
+#define GEMM_DEFAULT_R		SHGEMM_DEFAULT_R
+#define GEMM_DEFAULT_UNROLL_M	SHGEMM_DEFAULT_UNROLL_M
+#define GEMM_DEFAULT_UNROLL_N	SHGEMM_DEFAULT_UNROLL_N
+#elif defined(INT8)
+#define GEMM_P			I8GEMM_P
+#define GEMM_Q			I8GEMM_Q
+#define GEMM_R			I8GEMM_R
+#define GEMM_UNROLL_M		I8GEMM_UNROLL_M
+#define GEMM_UNROLL_N		I8GEMM_UNROLL_N
+#define GEMM_UNROLL_MN		I8GEMM_UNROLL_MN
+#define GEMM_DEFAULT_P		I8GEMM_DEFAULT_P
+#define GEMM_DEFAULT_Q		I8GEMM_DEFAULT_Q
+#define GEMM_DEFAULT_R		I8GEMM_DEFAULT_R
+#define GEMM_DEFAULT_UNROLL_M	I8GEMM_DEFAULT_UNROLL_M
+#define GEMM_DEFAULT_UNROLL_N	I8GEMM_DEFAULT_UNROLL_N
 #else
 #define GEMM_P			SGEMM_P
 #define GEMM_Q			SGEMM_Q
@@ -1598,6 +1691,10 @@ extern gotoblas_t *gotoblas;
 #define SBGEMM_DEFAULT_R (((BUFFER_SIZE - ((SBGEMM_DEFAULT_P * SBGEMM_DEFAULT_Q *  4 + GEMM_DEFAULT_OFFSET_A + GEMM_DEFAULT_ALIGN) & ~GEMM_DEFAULT_ALIGN)) / (SBGEMM_DEFAULT_Q *  4) - 15) & ~15UL)
 #endif
 
+#ifndef SHGEMM_DEFAULT_R
+#define SHGEMM_DEFAULT_R (((BUFFER_SIZE - ((SHGEMM_DEFAULT_P * SHGEMM_DEFAULT_Q *  4 + GEMM_DEFAULT_OFFSET_A + GEMM_DEFAULT_ALIGN) & ~GEMM_DEFAULT_ALIGN)) / (SHGEMM_DEFAULT_Q *  4) - 15) & ~15UL)
+#endif
+
 #ifndef SGEMM_DEFAULT_R
 #define SGEMM_DEFAULT_R (((BUFFER_SIZE - ((SGEMM_DEFAULT_P * SGEMM_DEFAULT_Q *  4 + GEMM_DEFAULT_OFFSET_A + GEMM_DEFAULT_ALIGN) & ~GEMM_DEFAULT_ALIGN)) / (SGEMM_DEFAULT_Q *  4) - 15) & ~15UL)
 #endif
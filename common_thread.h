@@ -58,6 +58,8 @@ extern int blas_omp_linked;
 #define BLAS_LEGACY	0x8000U
 #define BLAS_PTHREAD	0x4000U
 #define BLAS_NODE	0x2000U
+#define BLAS_NODE_PIN	0x0040U	/* with BLAS_NODE, run on queue -> node */
+#define BLAS_CAPACITY	0x0080U	/* prefer a core of queue -> capacity */
 
 #define BLAS_PREC       0x000FU
 #define BLAS_INT8       0x0000U
@@ -120,6 +122,7 @@ typedef struct blas_queue {
 #endif
 
   int mode, status;
+  int node, capacity;
 
 #ifdef CONSISTENT_FPCSR
   unsigned int sse_mode, x87_mode;
@@ -139,12 +142,19 @@ extern int blas_server_avail;
 extern int blas_omp_number_max;
 extern int blas_omp_threads_local;
 
+int blas_context_num_threads(void);
+
 static __inline int num_cpu_avail(int level) {
 
 #ifdef USE_OPENMP
 int openmp_nthreads;
 	openmp_nthreads=omp_get_max_threads();
 	if (omp_in_parallel()) openmp_nthreads = blas_omp_threads_local;
+#else
+  int context_threads = blas_context_num_threads();
+
+  /* Calls from a thread with a current context use its pool */
+  if (context_threads) return context_threads;
 #endif
 
 #ifndef USE_OPENMP 
@@ -183,6 +193,14 @@ int exec_blas(BLASLONG, blas_queue_t *);
 int exec_blas_async(BLASLONG, blas_queue_t *);
 int exec_blas_async_wait(BLASLONG, blas_queue_t *);
 
+/* Capacities (driver/others/blas_capacity.c) to weight the jobs of a  */
+/* call with, job 0 being the caller's. Returns 0 if they are all equal */
+int blas_thread_capacities(BLASLONG, int *);
+
+/* Runs a function while no job runs on the default pool, pthreads */
+/* server only (blas_server.c)                                     */
+void blas_thread_quiesce(void (*)(void *), void *);
+
 #else
 int exec_blas_async(BLASLONG num_cpu, blas_param_t *param, pthread_t *);
 int exec_blas_async_wait(BLASLONG num_cpu, pthread_t *blas_threads);
@@ -196,12 +214,46 @@ int blas_level1_thread(int mode, BLASLONG m, BLASLONG n, BLASLONG k, void *alpha
 		       void *b, BLASLONG ldb,
 		       void *c, BLASLONG ldc, int (*function)(void), int threads);
 
+/* Threads for a level 3 call of size m x n x k, and how to split them over
+   m and n (see driver/others/blas_l3_nthreads.c)                          */
+#define BLAS_L3_SPLIT_M		1
+#define BLAS_L3_SPLIT_N		2
+#define BLAS_L3_SPLIT_MN	3
+
+int blas_level3_nthreads(double m, double n, double k, int split, int nthreads,
+			 BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q, int compsize,
+			 BLASLONG *nthreads_m, BLASLONG *nthreads_n);
+
+#define LEVEL3_NTHREADS(M, N, K, SPLIT) \
+  blas_level3_nthreads((double)(M), (double)(N), (double)(K), SPLIT, num_cpu_avail(3), \
+		       GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, COMPSIZE, NULL, NULL)
+
+/* Number of k slices for gemm_thread_k, 1 when an m/n split is cheaper */
+int blas_level3_nthreads_k(double m, double n, double k, int nthreads,
+			   BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q, int compsize);
+
+#define LEVEL3_NTHREADS_K(M, N, K) \
+  blas_level3_nthreads_k((double)(M), (double)(N), (double)(K), num_cpu_avail(3), \
+			 GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, COMPSIZE)
+
+/* Round and chunk or block of a task of the dynamic mode (blas_dynamic.c) */
+int blas_dynamic_task(BLASLONG task, BLASLONG tasks, BLASLONG chunks,
+		      BLASLONG *round, BLASLONG *index);
+
+/* Nodes, threads and cut of C for gemm_thread_node (blas_numa.c) */
+int blas_node_split(BLASLONG nthreads, BLASLONG size, int mynode, int nodes,
+		    int *node, int *threads, BLASLONG *range);
+
 int gemm_thread_m (int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG ), void *, void *, BLASLONG);
 
 int gemm_thread_n (int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT*, FLOAT*, BLASLONG), void *, void *, BLASLONG);
 
 int gemm_thread_mn(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG), void *, void *, BLASLONG);
 
+int gemm_thread_node(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG), void *, void *, BLASLONG);
+
+int gemm_thread_k (int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG), void *, void *, BLASLONG);
+
 int gemm_thread_variable(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG), void *, void *, BLASLONG, BLASLONG);
 
 int trsm_thread(int mode, BLASLONG m, BLASLONG n,
@@ -40,6 +40,14 @@
 #include <stdlib.h>
 #include "common.h"
 
+/* With threads bound to cores, the partial vectors of y get fresh pages
+   that the threads filling them touch first, so that each part lands on
+   its thread's memory node. Otherwise they come from the buffer pool. */
+#if defined(OS_LINUX) && !defined(NO_AFFINITY)
+#define GEMV_PARTIAL_MMAP
+#include <sys/mman.h>
+#endif
+
 #ifndef TRANSA
 #if   !defined(CONJ) && !defined(XCONJ)
 #define GEMV	GEMV_N
@@ -62,38 +70,21 @@
 #endif
 #endif
 
-#ifndef thread_local
-# if __STDC_VERSION__ >= 201112 && !defined __STDC_NO_THREADS__
-#  define thread_local _Thread_local
-# elif defined _WIN32 && ( \
-       defined _MSC_VER || \
-       defined __ICL || \
-       defined __DMC__ || \
-       defined __BORLANDC__ )
-#  define thread_local __declspec(thread) 
-/* note that ICC (linux) and Clang are covered by __GNUC__ */
-# elif (defined __GNUC__ || \
-       defined __SUNPRO_C || \
-       defined __xlC__) && !defined(__APPLE__)
-#  define thread_local __thread
-# else
-# define UNSAFE
-#endif
-#endif
-#if defined USE_OPENMP
-#undef UNSAFE
+/* Smallest share of y for one thread: contiguous runs of A long enough
+   to stream well for gemv_n, a few dot products for gemv_t */
+#ifndef TRANSA
+#define GEMV_OUT_MIN	(256 / COMPSIZE)
+#else
+#define GEMV_OUT_MIN	4
 #endif
 
-#if !defined(TRANSA) && !defined(UNSAFE)
-#define Y_DUMMY_NUM 1024
-#if defined(USE_OPENMP)
-static FLOAT y_dummy[Y_DUMMY_NUM];
-#pragma omp threadprivate(y_dummy)
-# else
-static thread_local FLOAT y_dummy[Y_DUMMY_NUM];
-# endif
-#endif
+/* Smallest share of the inner dimension for one thread */
+#define GEMV_INNER_MIN	64
 
+/* Each thread computes y[out_from:out_to] += alpha * op(A) x for one block of
+   the inner dimension (columns of A for gemv_n, rows for gemv_t). For blocks
+   after the first, args -> c is a partial vector (ldc = 1) that is cleared
+   first and args -> d is set. */
 static int gemv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *dummy1, FLOAT *buffer, BLASLONG pos){
 
   FLOAT *a, *x, *y;
@@ -118,6 +109,8 @@ static int gemv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, F
     a += m_from        * COMPSIZE;
 #ifndef TRANSA
     y += m_from * incy * COMPSIZE;
+#else
+    x += m_from * incx * COMPSIZE;
 #endif
   }
 
@@ -132,16 +125,19 @@ static int gemv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, F
 #ifdef TRANSA
     y += n_from * incy * COMPSIZE;
 #else
-# ifndef UNSAFE
-    //for split matrix row (n) direction and vector x of gemv_n
     x += n_from * incx * COMPSIZE;
-    //store partial result for every thread
-    y += (m_to - m_from) * 1 * COMPSIZE * pos;
-# endif
 #endif
   }
 
-  //fprintf(stderr, "M_From = %d  M_To = %d  N_From = %d  N_To = %d POS=%d\n", m_from, m_to, n_from, n_to, pos);
+  /* cleared by the thread that uses it, so that it is in that thread's
+     cache and, with GEMV_PARTIAL_MMAP, on that thread's memory node */
+  if (args -> d) {
+#ifndef TRANSA
+    memset(y, 0, sizeof(FLOAT) * (m_to - m_from) * COMPSIZE);
+#else
+    memset(y, 0, sizeof(FLOAT) * (n_to - n_from) * COMPSIZE);
+#endif
+  }
 
   GEMV(m_to - m_from, n_to - n_from, 0,
        *((FLOAT *)args -> alpha + 0),
@@ -153,21 +149,44 @@ static int gemv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, F
   return 0;
 }
 
+/* Splits the range [0, n) into num blocks of nearly equal size, or of
+   sizes proportional to weight if it is not NULL */
+static void gemv_split(BLASLONG n, BLASLONG num, int *weight, BLASLONG *range){
+
+  BLASLONG i, width, left = 0;
+
+  if (weight) for (i = 0; i < num; i++) left += weight[i];
+
+  range[0] = 0;
+  for (i = 0; i < num; i++) {
+    if (weight) {
+      width = ((n - range[i]) * weight[i] + left - 1) / left;
+      left -= weight[i];
+    } else {
+      width = blas_quickdivide(n - range[i] + num - i - 1, num - i);
+    }
+    range[i + 1] = range[i] + width;
+  }
+}
+
 #ifndef COMPLEX
 int CNAME(BLASLONG m, BLASLONG n, FLOAT  alpha, FLOAT *a, BLASLONG lda, FLOAT *x, BLASLONG incx, FLOAT *y, BLASLONG incy, FLOAT *buffer, int nthreads){
 #else
 int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x, BLASLONG incx, FLOAT *y, BLASLONG incy, FLOAT *buffer, int nthreads){
 #endif
 
-  blas_arg_t args;
+  blas_arg_t args[MAX_CPU_NUMBER];
   blas_queue_t queue[MAX_CPU_NUMBER];
-  BLASLONG range[MAX_CPU_NUMBER + 1];
-
-  BLASLONG width, i, num_cpu;
+  BLASLONG range_out[MAX_CPU_NUMBER + 1];
+  BLASLONG range_inner[MAX_CPU_NUMBER + 1];
 
-#if !defined(TRANSA) && !defined(UNSAFE)
-  int split_x=0;
+  BLASLONG out, inner, num_out, num_inner, i, j, num_cpu;
+  FLOAT *partial = NULL;
+#ifdef GEMV_PARTIAL_MMAP
+  size_t partial_size = 0;
 #endif
+  int capacity[MAX_CPU_NUMBER];
+  int weighted = 0;
 
 #ifdef SMP
 #ifndef COMPLEX
@@ -189,110 +208,97 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
 #endif
 #endif
 
-  args.m = m;
-  args.n = n;
-
-  args.a = (void *)a;
-  args.b = (void *)x;
-  args.c = (void *)y;
-
-  args.lda = lda;
-  args.ldb = incx;
-  args.ldc = incy;
-
-#ifndef COMPLEX
-  args.alpha = (void *)&alpha;
-#else
-  args.alpha = (void *) alpha;
-#endif
-
-  num_cpu  = 0;
-
-  range[0] = 0;
 #ifndef TRANSA
-  i        = m;
+  out   = m;
+  inner = n;
 #else
-  i        = n;
+  out   = n;
+  inner = m;
 #endif
 
-  while (i > 0){
-
-    width  = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
-    if (width < 4) width = 4;
-    if (i < width) width = i;
-
-    range[num_cpu + 1] = range[num_cpu] + width;
-
-    queue[num_cpu].mode    = mode;
-    queue[num_cpu].routine = gemv_kernel;
-    queue[num_cpu].args    = &args;
-#ifndef TRANSA
-    queue[num_cpu].range_m = &range[num_cpu];
-    queue[num_cpu].range_n = NULL;
+  /* The threads form a num_out x num_inner grid. Splitting y alone (a
+     single block of the inner dimension) needs no reduction and is used
+     whenever y is long enough to keep all threads busy; a short y, as for
+     wide gemv_n or tall gemv_t, is split over the inner dimension as well,
+     the threads of each further inner block working on a partial y. */
+  num_out = MAX(1, MIN(nthreads, out / GEMV_OUT_MIN));
+  num_inner = nthreads / num_out;
+  while (num_inner > 1 && inner < num_inner * GEMV_INNER_MIN) num_inner --;
+  while (num_inner > 1 && (num_inner - 1) * out * COMPSIZE * sizeof(FLOAT) > BUFFER_SIZE) num_inner --;
+  if (num_inner > 1) num_out = MAX(1, MIN(nthreads / num_inner, out));
+
+  if (num_inner > 1) {
+#ifdef GEMV_PARTIAL_MMAP
+    partial_size = (num_inner - 1) * out * COMPSIZE * sizeof(FLOAT);
+    partial = (FLOAT *)mmap(NULL, partial_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (partial == (FLOAT *)MAP_FAILED) partial = NULL;
 #else
-    queue[num_cpu].range_m = NULL;
-    queue[num_cpu].range_n = &range[num_cpu];
+    partial = (FLOAT *)blas_memory_alloc(1);
 #endif
-    queue[num_cpu].sa      = NULL;
-    queue[num_cpu].sb      = NULL;
-    queue[num_cpu].next    = &queue[num_cpu + 1];
 
-    num_cpu ++;
-    i -= width;
+    /* Without a buffer for the partial vectors only y is split */
+    if (partial == NULL) {
+      num_inner = 1;
+      num_out   = MAX(1, MIN(nthreads, out / GEMV_OUT_MIN));
+    }
   }
 
-#if !defined(TRANSA) && !defined(UNSAFE) 
-  //try to split matrix on row direction and x.
-  //Then, reduction.
-  if (num_cpu < nthreads) {
+  /* On hybrid cores a split of y alone follows the speed of the threads */
+  if (num_inner == 1) weighted = blas_thread_capacities(num_out, capacity);
 
-    //too small to split or bigger than the y_dummy buffer.
-    double MN = (double) m * (double) n;
-    if ( MN <= (24.0 * 24.0  * (double) (GEMM_MULTITHREAD_THRESHOLD*GEMM_MULTITHREAD_THRESHOLD))
-	 || m*COMPSIZE*nthreads > Y_DUMMY_NUM)
-      goto Outer;
+  gemv_split(out,   num_out,   weighted ? capacity : NULL, range_out);
+  gemv_split(inner, num_inner, NULL, range_inner);
 
-    num_cpu  = 0;
-    range[0] = 0;
+  num_cpu = 0;
 
-    memset(y_dummy, 0, sizeof(FLOAT) * m * COMPSIZE * nthreads);
+  for (j = 0; j < num_inner; j++) {
 
-    args.ldc = 1;
-    args.c = (void *)y_dummy;
+    args[j].m = m;
+    args[j].n = n;
 
-    //split on row (n) and x
-    i=n;
-    split_x=1;
-    while (i > 0){
+    args[j].a = (void *)a;
+    args[j].b = (void *)x;
+    args[j].c = (void *)y;
+    args[j].d = NULL;
 
-      width  = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
-      if (width < 4) width = 4;
-      if (i < width) width = i;
+    args[j].lda = lda;
+    args[j].ldb = incx;
+    args[j].ldc = incy;
 
-      range[num_cpu + 1] = range[num_cpu] + width;
-
-      queue[num_cpu].mode    = mode;
-      queue[num_cpu].routine = gemv_kernel;
-      queue[num_cpu].args    = &args;
+    if (j > 0) {
+      args[j].c = (void *)(partial + (j - 1) * out * COMPSIZE);
+      args[j].d = args[j].c;
+      args[j].ldc = 1;
+    }
 
-      queue[num_cpu].position = num_cpu;
+#ifndef COMPLEX
+    args[j].alpha = (void *)&alpha;
+#else
+    args[j].alpha = (void *) alpha;
+#endif
 
-      queue[num_cpu].range_m = NULL;
-      queue[num_cpu].range_n = &range[num_cpu];
+    for (i = 0; i < num_out; i++) {
 
+      queue[num_cpu].mode    = weighted ? (mode | BLAS_CAPACITY) : mode;
+      queue[num_cpu].capacity = weighted ? capacity[num_cpu] : 0;
+      queue[num_cpu].routine = gemv_kernel;
+      queue[num_cpu].args    = &args[j];
+#ifndef TRANSA
+      queue[num_cpu].range_m = &range_out[i];
+      queue[num_cpu].range_n = (num_inner > 1) ? &range_inner[j] : NULL;
+#else
+      queue[num_cpu].range_m = (num_inner > 1) ? &range_inner[j] : NULL;
+      queue[num_cpu].range_n = &range_out[i];
+#endif
+      queue[num_cpu].position = num_cpu;
       queue[num_cpu].sa      = NULL;
       queue[num_cpu].sb      = NULL;
       queue[num_cpu].next    = &queue[num_cpu + 1];
 
       num_cpu ++;
-      i -= width;
     }
-
   }
 
-  Outer:
-#endif
-
   if (num_cpu) {
     queue[0].sa = NULL;
     queue[0].sb = buffer;
@@ -301,21 +307,20 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
     exec_blas(num_cpu, queue);
   }
 
-#if !defined(TRANSA) && !defined(UNSAFE)
-  if(split_x==1){
-    //reduction
-    for(i=0; i<num_cpu; i++){
-
-      int j;
-      for(j=0; j<m; j++){
-	y[j*incy*COMPSIZE] +=y_dummy[i*m*COMPSIZE + j*COMPSIZE];
+  if (partial) {
+    for (j = 1; j < num_inner; j++)
+      AXPYU_K(out, 0, 0, ONE,
 #ifdef COMPLEX
-	y[j*incy*COMPSIZE+1] +=y_dummy[i*m*COMPSIZE + j*COMPSIZE+1];
+	      ZERO,
 #endif
-      }
-    }
-  }
+	      partial + (j - 1) * out * COMPSIZE, 1, y, incy, NULL, 0);
+
+#ifdef GEMV_PARTIAL_MMAP
+    munmap(partial, partial_size);
+#else
+    blas_memory_free(partial);
 #endif
+  }
 
   return 0;
 }
@@ -0,0 +1,418 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Scheduler for ?gemm_batch_strided. All members share m, n, k and the
+   leading dimensions; member i uses a + i * stride_a and so on.
+
+   - A shared A (stride_a == 0) with the B and C members stored back to
+     back is run as a single GEMM over nums * n columns.
+   - Any other shared operand is packed once (real single and double
+     precision only) and every member is computed with ?gemm_packed.
+   - Members the cost model would run on one thread each are handed out
+     to the threads in contiguous runs; larger members are computed one
+     after the other, each split over the threads.                     */
+
+#include "common.h"
+
+#if !defined(COMPLEX) && !defined(XDOUBLE) && !defined(BFLOAT16)
+#define PACK_SHARED
+#ifdef DOUBLE
+#define GEMM_PACKED		dgemm_packed
+#define GEMM_PACKED_THREAD	dgemm_packed_thread
+#else
+#define GEMM_PACKED		sgemm_packed
+#define GEMM_PACKED_THREAD	sgemm_packed_thread
+#endif
+#endif
+
+typedef int (*gemm_routine_t)(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG);
+
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG) = {
+  GEMM_NN, GEMM_TN, GEMM_RN, GEMM_CN,
+  GEMM_NT, GEMM_TT, GEMM_RT, GEMM_CT,
+  GEMM_NR, GEMM_TR, GEMM_RR, GEMM_CR,
+  GEMM_NC, GEMM_TC, GEMM_RC, GEMM_CC,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  GEMM_THREAD_NN, GEMM_THREAD_TN, GEMM_THREAD_RN, GEMM_THREAD_CN,
+  GEMM_THREAD_NT, GEMM_THREAD_TT, GEMM_THREAD_RT, GEMM_THREAD_CT,
+  GEMM_THREAD_NR, GEMM_THREAD_TR, GEMM_THREAD_RR, GEMM_THREAD_CR,
+  GEMM_THREAD_NC, GEMM_THREAD_TC, GEMM_THREAD_RC, GEMM_THREAD_CC,
+#endif
+};
+
+#if defined(SMALL_MATRIX_OPT) && !defined(XDOUBLE)
+#define USE_SMALL_MATRIX_OPT 1
+#else
+#define USE_SMALL_MATRIX_OPT 0
+#endif
+
+#if USE_SMALL_MATRIX_OPT
+#ifndef DYNAMIC_ARCH
+#define SMALL_KERNEL_ADDR(table, idx) ((void *)(table[idx]))
+#else
+#define SMALL_KERNEL_ADDR(table, idx) ((void *)(*(uintptr_t *)((char *)gotoblas + (size_t)(table[idx]))))
+#endif
+
+#ifndef COMPLEX
+static size_t gemm_small_kernel[] = {
+	GEMM_SMALL_KERNEL_NN, GEMM_SMALL_KERNEL_TN, 0, 0,
+	GEMM_SMALL_KERNEL_NT, GEMM_SMALL_KERNEL_TT, 0, 0,
+};
+
+static size_t gemm_small_kernel_b0[] = {
+	GEMM_SMALL_KERNEL_B0_NN, GEMM_SMALL_KERNEL_B0_TN, 0, 0,
+	GEMM_SMALL_KERNEL_B0_NT, GEMM_SMALL_KERNEL_B0_TT, 0, 0,
+};
+#else
+static size_t gemm_small_kernel[] = {
+	GEMM_SMALL_KERNEL_NN, GEMM_SMALL_KERNEL_TN, GEMM_SMALL_KERNEL_RN, GEMM_SMALL_KERNEL_CN,
+	GEMM_SMALL_KERNEL_NT, GEMM_SMALL_KERNEL_TT, GEMM_SMALL_KERNEL_RT, GEMM_SMALL_KERNEL_CT,
+	GEMM_SMALL_KERNEL_NR, GEMM_SMALL_KERNEL_TR, GEMM_SMALL_KERNEL_RR, GEMM_SMALL_KERNEL_CR,
+	GEMM_SMALL_KERNEL_NC, GEMM_SMALL_KERNEL_TC, GEMM_SMALL_KERNEL_RC, GEMM_SMALL_KERNEL_CC,
+};
+
+static size_t gemm_small_kernel_b0[] = {
+	GEMM_SMALL_KERNEL_B0_NN, GEMM_SMALL_KERNEL_B0_TN, GEMM_SMALL_KERNEL_B0_RN, GEMM_SMALL_KERNEL_B0_CN,
+	GEMM_SMALL_KERNEL_B0_NT, GEMM_SMALL_KERNEL_B0_TT, GEMM_SMALL_KERNEL_B0_RT, GEMM_SMALL_KERNEL_B0_CT,
+	GEMM_SMALL_KERNEL_B0_NR, GEMM_SMALL_KERNEL_B0_TR, GEMM_SMALL_KERNEL_B0_RR, GEMM_SMALL_KERNEL_B0_CR,
+	GEMM_SMALL_KERNEL_B0_NC, GEMM_SMALL_KERNEL_B0_TC, GEMM_SMALL_KERNEL_B0_RC, GEMM_SMALL_KERNEL_B0_CC,
+};
+#endif
+#endif
+
+/* Computes one member with args -> routine, which is either a GEMM
+   driver or, with BLAS_SMALL_OPT set in routine_mode, a small kernel */
+static void gemm_member(blas_arg_t *args, IFLOAT *sa, IFLOAT *sb){
+
+#if USE_SMALL_MATRIX_OPT
+  FLOAT *alpha = (FLOAT *)args -> alpha;
+  FLOAT *beta  = (FLOAT *)args -> beta;
+
+  if ((args -> routine_mode & BLAS_SMALL_B0_OPT) == BLAS_SMALL_B0_OPT) {
+#ifndef COMPLEX
+    ((int (*)(BLASLONG, BLASLONG, BLASLONG, IFLOAT *, BLASLONG, FLOAT, IFLOAT *, BLASLONG, FLOAT *, BLASLONG))args -> routine)
+      (args -> m, args -> n, args -> k, args -> a, args -> lda, alpha[0], args -> b, args -> ldb, args -> c, args -> ldc);
+#else
+    ((int (*)(BLASLONG, BLASLONG, BLASLONG, FLOAT *, BLASLONG, FLOAT, FLOAT, FLOAT *, BLASLONG, FLOAT *, BLASLONG))args -> routine)
+      (args -> m, args -> n, args -> k, args -> a, args -> lda, alpha[0], alpha[1], args -> b, args -> ldb, args -> c, args -> ldc);
+#endif
+    return;
+  }
+
+  if (args -> routine_mode & BLAS_SMALL_OPT) {
+#ifndef COMPLEX
+    ((int (*)(BLASLONG, BLASLONG, BLASLONG, IFLOAT *, BLASLONG, FLOAT, IFLOAT *, BLASLONG, FLOAT, FLOAT *, BLASLONG))args -> routine)
+      (args -> m, args -> n, args -> k, args -> a, args -> lda, alpha[0], args -> b, args -> ldb, beta[0], args -> c, args -> ldc);
+#else
+    ((int (*)(BLASLONG, BLASLONG, BLASLONG, FLOAT *, BLASLONG, FLOAT, FLOAT, FLOAT *, BLASLONG, FLOAT, FLOAT, FLOAT *, BLASLONG))args -> routine)
+      (args -> m, args -> n, args -> k, args -> a, args -> lda, alpha[0], alpha[1], args -> b, args -> ldb, beta[0], beta[1], args -> c, args -> ldc);
+#endif
+    return;
+  }
+#endif
+
+  ((gemm_routine_t)args -> routine)(args, NULL, NULL, sa, sb, 0);
+}
+
+/* Members range_m[0] .. range_m[1] - 1; range_n holds the three strides */
+static int inner_members(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			 IFLOAT *sa, IFLOAT *sb, BLASLONG mypos){
+
+  blas_arg_t member = *args;
+  BLASLONG i;
+
+  for (i = range_m[0]; i < range_m[1]; i++) {
+    member.a = (void *)((IFLOAT *)args -> a + i * range_n[0]);
+    member.b = (void *)((IFLOAT *)args -> b + i * range_n[1]);
+    member.c = (void *)((FLOAT  *)args -> c + i * range_n[2]);
+
+    gemm_member(&member, sa, sb);
+  }
+
+  return 0;
+}
+
+#ifdef PACK_SHARED
+/* Copies op(A) (side GEMM_PACK_INNER) or op(B) (GEMM_PACK_OUTER)
+   once into the ?gemm_pack layout, unscaled; alpha is kept in the
+   header and applied by the ?gemm_packed driver. Returns NULL if the
+   buffer can not be allocated.                                      */
+static gemm_pack_t *pack_shared(int side, int trans, BLASLONG rows, BLASLONG k,
+				FLOAT alpha, FLOAT *src, BLASLONG ld){
+
+  gemm_pack_t *pack;
+  FLOAT *buffer;
+  BLASLONG unroll, ldp, ls, min_l;
+
+  unroll = (side == GEMM_PACK_INNER) ? GEMM_UNROLL_M : GEMM_UNROLL_N;
+  ldp    = ((rows + unroll - 1) / unroll) * unroll;
+
+  pack = (gemm_pack_t *)malloc(((sizeof(gemm_pack_t) + GEMM_PACK_ALIGN) & ~GEMM_PACK_ALIGN) + GEMM_PACK_ALIGN + 1
+			       + (size_t)k * (size_t)ldp * sizeof(FLOAT));
+  if (pack == NULL) return NULL;
+
+  buffer = (FLOAT *)(((BLASLONG)pack + sizeof(gemm_pack_t) + GEMM_PACK_ALIGN) & ~GEMM_PACK_ALIGN);
+
+  pack -> magic  = GEMM_PACK_MAGIC | SIZE;
+  pack -> side   = side;
+  pack -> rows   = rows;
+  pack -> k      = k;
+  pack -> ld     = ldp;
+  pack -> q      = GEMM_Q;
+  pack -> alpha  = (double)alpha;
+  pack -> offset = (BLASLONG)buffer - (BLASLONG)pack;
+
+  for(ls = 0; ls < k; ls += min_l){
+    min_l = k - ls;
+    if (min_l > GEMM_Q) min_l = GEMM_Q;
+
+    if (side == GEMM_PACK_INNER) {
+      if (trans)
+	GEMM_INCOPY(min_l, rows, src + ls, ld, buffer);
+      else
+	GEMM_ITCOPY(min_l, rows, src + ls * ld, ld, buffer);
+    } else {
+      if (trans)
+	GEMM_OTCOPY(min_l, rows, src + ls * ld, ld, buffer);
+      else
+	GEMM_ONCOPY(min_l, rows, src + ls, ld, buffer);
+    }
+
+    buffer += min_l * ldp;
+  }
+
+  return pack;
+}
+#endif
+
+int CNAME(blas_arg_t *args, BLASLONG stride_a, BLASLONG stride_b, BLASLONG stride_c,
+	  BLASLONG nums, int trans){
+
+  int transa = trans & 3, transb = (trans >> 2) & 3;
+  BLASLONG strides[3], range[2];
+  XFLOAT *buffer;
+  IFLOAT *sa, *sb;
+  void *pack = NULL;
+
+#ifdef SMP
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range_M[MAX_CPU_NUMBER + 1];
+  BLASLONG nthreads, split, co, width, num_cpu, i;
+  gemm_routine_t thread_routine = NULL;
+  int mode;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  if ((nums <= 0) || (args -> m == 0) || (args -> n == 0)) return 0;
+
+  /* op(B) and C of consecutive members continue each other column by column */
+  if ((stride_a == 0) && !(transb & 1) && (nums > 1) &&
+      (stride_b == args -> ldb * args -> n) && (stride_c == args -> ldc * args -> n)) {
+    args -> n *= nums;
+    nums = 1;
+  }
+
+  strides[0] = stride_a * COMPSIZE;
+  strides[1] = stride_b * COMPSIZE;
+  strides[2] = stride_c * COMPSIZE;
+
+  args -> routine      = (void *)gemm[trans];
+  args -> routine_mode = 0;
+
+#if USE_SMALL_MATRIX_OPT
+#ifndef COMPLEX
+  if (GEMM_SMALL_MATRIX_PERMIT(transa, transb, args -> m, args -> n, args -> k,
+			       *(FLOAT *)args -> alpha, *(FLOAT *)args -> beta)) {
+    if (*(FLOAT *)args -> beta == ZERO) {
+#else
+  if (GEMM_SMALL_MATRIX_PERMIT(transa, transb, args -> m, args -> n, args -> k,
+			       ((FLOAT *)args -> alpha)[0], ((FLOAT *)args -> alpha)[1],
+			       ((FLOAT *)args -> beta)[0], ((FLOAT *)args -> beta)[1])) {
+    if ((((FLOAT *)args -> beta)[0] == ZERO) && (((FLOAT *)args -> beta)[1] == ZERO)) {
+#endif
+      args -> routine_mode = BLAS_SMALL_B0_OPT;
+      args -> routine      = SMALL_KERNEL_ADDR(gemm_small_kernel_b0, trans);
+    } else {
+      args -> routine_mode = BLAS_SMALL_OPT;
+      args -> routine      = SMALL_KERNEL_ADDR(gemm_small_kernel, trans);
+    }
+  }
+#endif
+
+#ifdef SMP
+  nthreads = num_cpu_avail(3);
+
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+
+  /* Small kernels run each member on one thread */
+  split = 1;
+  if ((nthreads > 1) && !args -> routine_mode)
+    split = LEVEL3_NTHREADS(args -> m, args -> n, args -> k, BLAS_L3_SPLIT_MN);
+#endif
+
+  buffer = (XFLOAT *)blas_workspace_alloc();
+
+  sa = (IFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (IFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef PACK_SHARED
+  if ((nums > 1) && (args -> k > 0) && !args -> routine_mode) {
+    if (stride_a == 0) {
+      pack = pack_shared(GEMM_PACK_INNER, transa, args -> m, args -> k,
+			 *(FLOAT *)args -> alpha, (FLOAT *)args -> a, args -> lda);
+      if (pack) {
+	args -> a = pack;
+	args -> routine_mode = GEMM_PACKED_A | (transb ? GEMM_PACKED_TRANSB : 0);
+      }
+    } else if (stride_b == 0) {
+      pack = pack_shared(GEMM_PACK_OUTER, transb, args -> n, args -> k,
+			 *(FLOAT *)args -> alpha, (FLOAT *)args -> b, args -> ldb);
+      if (pack) {
+	args -> b = pack;
+	args -> routine_mode = GEMM_PACKED_B | (transa ? GEMM_PACKED_TRANSA : 0);
+      }
+    }
+
+    if (pack) {
+      args -> routine = (void *)GEMM_PACKED;
+#ifdef SMP
+      thread_routine  = (gemm_routine_t)GEMM_PACKED_THREAD;
+#endif
+    }
+  }
+#endif
+
+  range[0] = 0;
+  range[1] = nums;
+
+#ifdef SMP
+  /* Running members side by side needs no synchronisation inside a member,
+     so it is preferred while it keeps at least as many threads busy as
+     splitting a member would. A remainder that would leave threads idle
+     is split instead.                                                   */
+  co = 0;
+  if ((nthreads > 1) && (nums > 1)) {
+    if (nums >= nthreads) {
+      co = nums;
+      if (split > 1) co -= nums % nthreads;
+    } else if (nums >= split) {
+      co = nums;
+    }
+  }
+
+  if (co > 0) {
+    range_M[0] = 0;
+    num_cpu    = 0;
+    i          = co;
+
+    while (i > 0) {
+      width = blas_quickdivide(i + MIN(nthreads, co) - num_cpu - 1, MIN(nthreads, co) - num_cpu);
+      i -= width;
+
+      range_M[num_cpu + 1] = range_M[num_cpu] + width;
+
+      queue[num_cpu].mode    = mode;
+      queue[num_cpu].routine = (void *)inner_members;
+      queue[num_cpu].args    = args;
+      queue[num_cpu].range_m = &range_M[num_cpu];
+      queue[num_cpu].range_n = &strides[0];
+      queue[num_cpu].sa      = NULL;
+      queue[num_cpu].sb      = NULL;
+      queue[num_cpu].next    = &queue[num_cpu + 1];
+      num_cpu ++;
+    }
+
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[num_cpu - 1].next = NULL;
+
+    exec_blas(num_cpu, queue);
+
+    range[0] = co;
+  }
+
+  if (split > 1) {
+    blas_arg_t member = *args;
+
+    member.nthreads = split;
+    member.common   = NULL;
+
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+    if (!pack) thread_routine = gemm[16 | trans];
+#endif
+
+    mode |= (transa << BLAS_TRANSA_SHIFT);
+    mode |= (transb << BLAS_TRANSB_SHIFT);
+
+    for (i = range[0]; i < range[1]; i++) {
+      member.a = (void *)((IFLOAT *)args -> a + i * strides[0]);
+      member.b = (void *)((IFLOAT *)args -> b + i * strides[1]);
+      member.c = (void *)((FLOAT  *)args -> c + i * strides[2]);
+
+      if (thread_routine) {
+	(thread_routine)(&member, NULL, NULL, sa, sb, 0);
+      } else {
+	GEMM_THREAD(mode, &member, NULL, NULL, (void *)args -> routine, sa, sb, split);
+      }
+    }
+
+    range[0] = range[1];
+  }
+#endif
+
+  inner_members(args, range, strides, sa, sb, 0);
+
+  blas_workspace_free(buffer);
+
+  if (pack) free(pack);
+
+  return 0;
+}
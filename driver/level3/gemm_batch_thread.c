@@ -89,7 +89,7 @@ int CNAME(blas_arg_t * args_array, BLASLONG nums){
   
   if(nums <=0 ) return 0;
 
-  buffer = (XFLOAT *)blas_memory_alloc(0);
+  buffer = (XFLOAT *)blas_workspace_alloc();
   sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
   sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
   
@@ -151,6 +151,6 @@ int CNAME(blas_arg_t * args_array, BLASLONG nums){
     free(queue);
   }
 #endif
-  blas_memory_free(buffer);
+  blas_workspace_free(buffer);
   return 0;
 }
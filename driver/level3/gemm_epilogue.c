@@ -0,0 +1,116 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/* Epilogue of cblas_sgemm_ex for one tile of C. Called by the sgemm_ex
+   drivers right after the kernel call that completes the tile, so that
+   the bias, the activation and the conversion are done while the tile
+   is still in cache.                                                  */
+
+#include <math.h>
+#include "common.h"
+
+/* Same rounding as sbstobf16: to nearest even, denormals to zero and
+   quiet NaNs                                                          */
+static inline bfloat16 float_to_bf16(float x){
+
+  union { float f; uint32_t u; } v;
+
+  v.f = x;
+
+  switch (v.u & 0xff800000u) {
+  case 0x00000000u:
+    return 0x0000u;
+  case 0x80000000u:
+    return 0x8000u;
+  case 0x7f800000u:
+  case 0xff800000u:
+    if (v.u & 0x007fffffu) return (bfloat16)((v.u >> 16) | 0x0040u);
+    return (bfloat16)(v.u >> 16);
+  default:
+    v.u += ((v.u >> 16) & 1u) + 0x7fffu;
+    return (bfloat16)(v.u >> 16);
+  }
+}
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG offset_m, BLASLONG offset_n,
+	  FLOAT *c, BLASLONG ldc, void *epilogue){
+
+  gemm_epilogue_t *epi = (gemm_epilogue_t *)epilogue;
+  FLOAT *bias_m = NULL;
+  FLOAT *cc, x, bias;
+  BLASLONG i, j;
+
+  if (epi -> bias_m) bias_m = epi -> bias_m + offset_m;
+
+  for (j = 0; j < n; j++) {
+    cc = c + j * ldc;
+
+    bias = ZERO;
+    if (epi -> bias_n) bias = epi -> bias_n[offset_n + j];
+
+    if (bias_m) {
+      for (i = 0; i < m; i++) cc[i] += bias_m[i] + bias;
+    } else if (bias != ZERO) {
+      for (i = 0; i < m; i++) cc[i] += bias;
+    }
+
+    switch (epi -> activation) {
+    case GEMM_ACT_RELU:
+      for (i = 0; i < m; i++) cc[i] = (cc[i] > ZERO) ? cc[i] : ZERO;
+      break;
+    case GEMM_ACT_GELU:
+      for (i = 0; i < m; i++) {
+	x = cc[i];
+	cc[i] = 0.5f * x * (ONE + erff(x * 0.70710678118654752f));
+      }
+      break;
+    case GEMM_ACT_GELU_TANH:
+      for (i = 0; i < m; i++) {
+	x = cc[i];
+	cc[i] = 0.5f * x * (ONE + tanhf(0.79788456080286536f * (x + 0.044715f * x * x * x)));
+      }
+      break;
+    case GEMM_ACT_SIGMOID:
+      for (i = 0; i < m; i++) cc[i] = ONE / (ONE + expf(-cc[i]));
+      break;
+    }
+
+    if (epi -> out) {
+      bfloat16 *out = epi -> out + offset_m + (offset_n + j) * epi -> ldo;
+
+      for (i = 0; i < m; i++) out[i] = float_to_bf16(cc[i]);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,198 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/* Driver of cblas_?gemm_multi_rhs: the GEMM drivers with the columns of B
+   and C (rows of A and C if split_m is set) taken from the member that
+   holds them. Blocks of the split dimension are cut at the boundaries of
+   the members, so that every copy and kernel call stays inside one of
+   them, while each packed block of the shared operand serves all.     */
+
+#include <stdio.h>
+#include "common.h"
+
+#undef  TIMING
+
+#define MULTI	((gemm_multi_rhs_t *)args -> d)
+
+/* Member that holds row or column x of the split dimension */
+static inline gemm_rhs_t *multi_find(gemm_multi_rhs_t *multi, BLASLONG x){
+
+  BLASLONG lo = 0, hi = multi -> nrhs - 1, mid;
+
+  while (lo < hi) {
+    mid = (lo + hi + 1) / 2;
+    if (multi -> rhs[mid].offset <= x) lo = mid; else hi = mid - 1;
+  }
+
+  return multi -> rhs + lo;
+}
+
+/* Length of the block [x, x + min_x) up to the end of its member */
+static inline BLASLONG multi_clip(gemm_multi_rhs_t *multi, BLASLONG x, BLASLONG min_x){
+
+  gemm_rhs_t *r = multi_find(multi, x);
+
+  return MIN(min_x, r[1].offset - x);
+}
+
+#define MULTI_CLIP_M(X, MIN_X)	(MULTI -> split_m ? multi_clip(MULTI, X, MIN_X) : (MIN_X))
+#define MULTI_CLIP_N(X, MIN_X)	(MULTI -> split_m ? (MIN_X) : multi_clip(MULTI, X, MIN_X))
+
+static void multi_beta(blas_arg_t *args, BLASLONG m_from, BLASLONG m_to,
+		       BLASLONG n_from, BLASLONG n_to, FLOAT *beta){
+
+  gemm_rhs_t *r;
+  BLASLONG from, to, len;
+
+  from = MULTI -> split_m ? m_from : n_from;
+  to   = MULTI -> split_m ? m_to   : n_to;
+
+  if ((m_from >= m_to) || (n_from >= n_to)) return;
+
+  for (r = multi_find(MULTI, from); from < to; from += len, r++) {
+    len = MIN(to, r[1].offset) - from;
+
+    if (MULTI -> split_m) {
+      GEMM_BETA(len, n_to - n_from, 0, beta[0], NULL, 0, NULL, 0,
+		(FLOAT *)r -> c + (from - r -> offset) + n_from * r -> ldc, r -> ldc);
+    } else {
+      GEMM_BETA(m_to - m_from, len, 0, beta[0], NULL, 0, NULL, 0,
+		(FLOAT *)r -> c + m_from + (from - r -> offset) * r -> ldc, r -> ldc);
+    }
+  }
+}
+
+static void multi_icopy(blas_arg_t *args, BLASLONG min_l, BLASLONG min_i,
+			BLASLONG ls, BLASLONG is, IFLOAT *buffer){
+
+  IFLOAT *a = (IFLOAT *)args -> a;
+  BLASLONG lda = args -> lda;
+  gemm_rhs_t *r;
+
+  if (MULTI -> split_m) {
+    r   = multi_find(MULTI, is);
+    a   = (IFLOAT *)r -> b;
+    lda = r -> ldb;
+    is -= r -> offset;
+  }
+
+#if defined(NN) || defined(NT)
+  GEMM_ITCOPY(min_l, min_i, a + is + ls * lda, lda, buffer);
+#else
+  GEMM_INCOPY(min_l, min_i, a + ls + is * lda, lda, buffer);
+#endif
+}
+
+static void multi_ocopy(blas_arg_t *args, BLASLONG min_l, BLASLONG min_jj,
+			BLASLONG ls, BLASLONG jjs, IFLOAT *buffer){
+
+  IFLOAT *b = (IFLOAT *)args -> b;
+  BLASLONG ldb = args -> ldb;
+  gemm_rhs_t *r;
+
+  if (!MULTI -> split_m) {
+    r    = multi_find(MULTI, jjs);
+    b    = (IFLOAT *)r -> b;
+    ldb  = r -> ldb;
+    jjs -= r -> offset;
+  }
+
+#if defined(NN) || defined(TN)
+  GEMM_ONCOPY(min_l, min_jj, b + ls + jjs * ldb, ldb, buffer);
+#else
+  GEMM_OTCOPY(min_l, min_jj, b + jjs + ls * ldb, ldb, buffer);
+#endif
+}
+
+/* The packed columns of B follow each other at a distance of min_l, so
+   a range over several members is done one member at a time           */
+static void multi_kernel(blas_arg_t *args, BLASLONG min_i, BLASLONG min_j, BLASLONG min_l,
+			 FLOAT *alpha, IFLOAT *sa, IFLOAT *sb, BLASLONG is, BLASLONG js){
+
+  gemm_rhs_t *r;
+  BLASLONG len;
+
+  if (MULTI -> split_m) {
+    r = multi_find(MULTI, is);
+    GEMM_KERNEL_N(min_i, min_j, min_l, alpha[0], sa, sb,
+		  (FLOAT *)r -> c + (is - r -> offset) + js * r -> ldc, r -> ldc);
+    return;
+  }
+
+  for (r = multi_find(MULTI, js); min_j > 0; min_j -= len, js += len, r++) {
+    len = MIN(min_j, r[1].offset - js);
+    GEMM_KERNEL_N(min_i, len, min_l, alpha[0], sa, sb,
+		  (FLOAT *)r -> c + is + (js - r -> offset) * r -> ldc, r -> ldc);
+    sb += min_l * len;
+  }
+}
+
+/* The drivers' own a, b, c and leading dimensions are not used, the */
+/* operands come from the list in args -> d                          */
+#define BETA_OPERATION(M_FROM, M_TO, N_FROM, N_TO, BETA, C, LDC) \
+	((void)(C), (void)(LDC), multi_beta(args, M_FROM, M_TO, N_FROM, N_TO, BETA))
+#define ICOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) \
+	((void)(A), (void)(LDA), multi_icopy(args, M, N, X, Y, BUFFER))
+#define OCOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) \
+	((void)(A), (void)(LDA), multi_ocopy(args, M, N, X, Y, BUFFER))
+#define KERNEL_OPERATION(M, N, K, ALPHA, SA, SB, C, LDC, X, Y) \
+	((void)(C), (void)(LDC), multi_kernel(args, M, N, K, ALPHA, SA, SB, X, Y))
+
+#ifdef THREADED_LEVEL3
+
+#ifndef DOUBLE
+#if   defined(NN)
+#define GEMM_LOCAL	sgemm_multi_rhs_nn
+#elif defined(NT)
+#define GEMM_LOCAL	sgemm_multi_rhs_nt
+#elif defined(TN)
+#define GEMM_LOCAL	sgemm_multi_rhs_tn
+#else
+#define GEMM_LOCAL	sgemm_multi_rhs_tt
+#endif
+#else
+#if   defined(NN)
+#define GEMM_LOCAL	dgemm_multi_rhs_nn
+#elif defined(NT)
+#define GEMM_LOCAL	dgemm_multi_rhs_nt
+#elif defined(TN)
+#define GEMM_LOCAL	dgemm_multi_rhs_tn
+#else
+#define GEMM_LOCAL	dgemm_multi_rhs_tt
+#endif
+#endif
+
+#include "level3_thread.c"
+#else
+#include "level3.c"
+#endif
@@ -0,0 +1,234 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/* GEMM driver for ?gemm_compute. Either operand may come pre-packed by
+   ?gemm_pack (args -> a / args -> b then point to a gemm_pack_t), an
+   operand that is not packed is copied block by block as in level3.c.   */
+
+#include "common.h"
+
+#ifndef THREADED_LEVEL3
+
+#define PACKED_DATA(p)	((FLOAT *)((char *)(p) + (p) -> offset))
+
+int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+	  FLOAT *sa, FLOAT *sb, BLASLONG dummy){
+
+  gemm_pack_t *pack_a = NULL, *pack_b = NULL;
+  FLOAT *a, *b, *c, *beta, *aa, *bb;
+  FLOAT alpha;
+  BLASLONG k, lda, ldb, ldc;
+  BLASLONG m_from, m_to, n_from, n_to;
+  BLASLONG ls, is, js;
+  BLASLONG min_l, min_i, min_j;
+  BLASLONG gemm_q, step_p, step_r;
+  int mode = args -> routine_mode;
+
+  k = args -> k;
+
+  a = (FLOAT *)args -> a;
+  b = (FLOAT *)args -> b;
+  c = (FLOAT *)args -> c;
+
+  lda = args -> lda;
+  ldb = args -> ldb;
+  ldc = args -> ldc;
+
+  beta = (FLOAT *)args -> beta;
+
+  if (mode & GEMM_PACKED_A) pack_a = (gemm_pack_t *)a;
+  if (mode & GEMM_PACKED_B) pack_b = (gemm_pack_t *)b;
+
+  m_from = 0;
+  m_to   = args -> m;
+
+  if (range_m) {
+    m_from = range_m[0];
+    m_to   = range_m[1];
+  }
+
+  n_from = 0;
+  n_to   = args -> n;
+
+  if (range_n) {
+    n_from = range_n[0];
+    n_to   = range_n[1];
+  }
+
+  if (beta && (beta[0] != ONE)) {
+    GEMM_BETA(m_to - m_from, n_to - n_from, 0, beta[0], NULL, 0, NULL, 0,
+	      c + m_from + n_from * ldc, ldc);
+  }
+
+  if (k == 0) return 0;
+
+  alpha = ONE;
+  if (pack_a) alpha *= (FLOAT)pack_a -> alpha;
+  if (pack_b) alpha *= (FLOAT)pack_b -> alpha;
+
+  if (alpha == ZERO) return 0;
+
+  /* the K blocking is fixed by the packed operand(s) */
+  gemm_q = GEMM_Q;
+  if (pack_a) gemm_q = pack_a -> q;
+  if (pack_b) gemm_q = pack_b -> q;
+
+  /* packed panels can only be entered on an unroll boundary */
+  step_p = GEMM_P - GEMM_P % GEMM_UNROLL_M;
+  step_r = GEMM_R - GEMM_R % GEMM_UNROLL_N;
+  if (step_p <= 0) step_p = GEMM_UNROLL_M;
+  if (step_r <= 0) step_r = GEMM_UNROLL_N;
+
+  for(js = n_from; js < n_to; js += min_j){
+    min_j = n_to - js;
+    if (min_j > step_r) min_j = step_r;
+
+    for(ls = 0; ls < k; ls += min_l){
+      min_l = k - ls;
+      if (min_l > gemm_q) min_l = gemm_q;
+
+      if (pack_b) {
+	bb = PACKED_DATA(pack_b) + ls * pack_b -> ld + min_l * js;
+      } else {
+	if (mode & GEMM_PACKED_TRANSB)
+	  GEMM_OTCOPY(min_l, min_j, b + js + ls * ldb, ldb, sb);
+	else
+	  GEMM_ONCOPY(min_l, min_j, b + ls + js * ldb, ldb, sb);
+	bb = sb;
+      }
+
+      for(is = m_from; is < m_to; is += min_i){
+	min_i = m_to - is;
+	if (min_i > step_p) min_i = step_p;
+
+	if (pack_a) {
+	  aa = PACKED_DATA(pack_a) + ls * pack_a -> ld + min_l * is;
+	} else {
+	  if (mode & GEMM_PACKED_TRANSA)
+	    GEMM_INCOPY(min_l, min_i, a + ls + is * lda, lda, sa);
+	  else
+	    GEMM_ITCOPY(min_l, min_i, a + is + ls * lda, lda, sa);
+	  aa = sa;
+	}
+
+	GEMM_KERNEL_N(min_i, min_j, min_l, alpha, aa, bb, c + is + js * ldc, ldc);
+      }
+    }
+  }
+
+  return 0;
+}
+
+#else
+
+#ifdef DOUBLE
+#define GEMM_PACKED	dgemm_packed
+#else
+#define GEMM_PACKED	sgemm_packed
+#endif
+
+/* Splits C over the threads. Boundaries are kept on unroll multiples so
+   that every thread enters the packed panels at a panel start.         */
+
+int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+	  FLOAT *sa, FLOAT *sb, BLASLONG dummy){
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range_M[MAX_CPU_NUMBER + 1];
+  BLASLONG range_N[MAX_CPU_NUMBER + 1];
+
+  BLASLONG nthreads = args -> nthreads;
+  BLASLONG m = args -> m, n = args -> n;
+  BLASLONG width, i, unroll, num_cpu;
+  BLASLONG *range, *range_fix;
+  int split_n;
+  int mode;
+
+#ifdef DOUBLE
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+  mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+
+  split_n = (n >= nthreads * GEMM_UNROLL_N) || (n * GEMM_UNROLL_M >= m * GEMM_UNROLL_N);
+
+  if (split_n) {
+    range  = range_N;  range_fix = range_M;
+    unroll = GEMM_UNROLL_N;
+    i = n;
+  } else {
+    range  = range_M;  range_fix = range_N;
+    unroll = GEMM_UNROLL_M;
+    i = m;
+  }
+
+  range_fix[0] = 0;
+  range_fix[1] = split_n ? m : n;
+
+  range[0] = 0;
+  num_cpu  = 0;
+
+  while (i > 0) {
+    width = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
+    width = ((width + unroll - 1) / unroll) * unroll;
+    if (width > i) width = i;
+
+    i -= width;
+
+    range[num_cpu + 1] = range[num_cpu] + width;
+
+    queue[num_cpu].mode    = mode;
+    queue[num_cpu].routine = (void *)GEMM_PACKED;
+    queue[num_cpu].args    = args;
+    queue[num_cpu].range_m = split_n ? &range_M[0]       : &range_M[num_cpu];
+    queue[num_cpu].range_n = split_n ? &range_N[num_cpu] : &range_N[0];
+    queue[num_cpu].sa      = NULL;
+    queue[num_cpu].sb      = NULL;
+    queue[num_cpu].next    = &queue[num_cpu + 1];
+    num_cpu ++;
+  }
+
+  if (num_cpu) {
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[num_cpu - 1].next = NULL;
+
+    exec_blas(num_cpu, queue);
+  }
+
+  return 0;
+}
+
+#endif
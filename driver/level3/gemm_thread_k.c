@@ -0,0 +1,197 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/* Threaded GEMM over slices of k, for a small C and a long inner
+   dimension. "function" is the single threaded driver. Thread 0 updates C
+   with the caller's beta over the first slice; the others compute their
+   slices with beta = 0 into private m x n copies of C, which are then
+   added into C by all threads, each over its own columns.             */
+
+static const double zero[2] = {0.0, 0.0};
+
+/* The reduction treats complex matrices as real ones of twice the rows:
+   m and ldc are in real elements, a holds lda copies of size ldb */
+static int reduce_s(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, void *sa, void *sb, BLASLONG mypos){
+
+  float *c = (float *)args -> c;
+  float *p = (float *)args -> a;
+  BLASLONG i, j, l;
+
+  for (j = range_n[0]; j < range_n[1]; j++) {
+    for (l = 0; l < args -> lda; l++) {
+      for (i = 0; i < args -> m; i++) c[i + j * args -> ldc] += p[i + j * args -> m + l * args -> ldb];
+    }
+  }
+
+  return 0;
+}
+
+static int reduce_d(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, void *sa, void *sb, BLASLONG mypos){
+
+  double *c = (double *)args -> c;
+  double *p = (double *)args -> a;
+  BLASLONG i, j, l;
+
+  for (j = range_n[0]; j < range_n[1]; j++) {
+    for (l = 0; l < args -> lda; l++) {
+      for (i = 0; i < args -> m; i++) c[i + j * args -> ldc] += p[i + j * args -> m + l * args -> ldb];
+    }
+  }
+
+  return 0;
+}
+
+int CNAME(int mode, blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG), void *sa, void *sb, BLASLONG nthreads) {
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  blas_arg_t   args[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  blas_arg_t   rargs;
+
+  BLASLONG width, i, num_cpu, size, compsize, m, n, k;
+  int transa, transb;
+  char *buffer;
+
+  m = arg -> m;
+  n = arg -> n;
+  k = arg -> k;
+
+  compsize = (mode & BLAS_COMPLEX) ? 2 : 1;
+  size     = ((mode & BLAS_PREC) == BLAS_DOUBLE) ? sizeof(double) : sizeof(float);
+  size    *= compsize;
+
+  transa = (mode & BLAS_TRANSA) >> BLAS_TRANSA_SHIFT;
+  transb = (mode & BLAS_TRANSB) >> BLAS_TRANSB_SHIFT;
+
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+  if (nthreads > k) nthreads = k;
+
+  buffer = NULL;
+  if (nthreads > 1) buffer = (char *)malloc((nthreads - 1) * m * n * size);
+
+  if (buffer == NULL) {
+    (function)(arg, range_m, range_n, sa, sb, 0);
+    return 0;
+  }
+
+  /* Partial products over slices of k */
+  range[0] = 0;
+  i        = k;
+  num_cpu  = 0;
+
+  while (i > 0){
+
+    width  = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
+
+    i -= width;
+    if (i < 0) width = width + i;
+
+    range[num_cpu + 1] = range[num_cpu] + width;
+
+    args[num_cpu]   = *arg;
+    args[num_cpu].k = width;
+    args[num_cpu].a = (char *)arg -> a + range[num_cpu] * ((transa & 1) ? 1 : arg -> lda) * size;
+    args[num_cpu].b = (char *)arg -> b + range[num_cpu] * ((transb & 1) ? arg -> ldb : 1) * size;
+
+    if (num_cpu > 0) {
+      args[num_cpu].c    = buffer + (num_cpu - 1) * m * n * size;
+      args[num_cpu].ldc  = m;
+      args[num_cpu].beta = (void *)zero;
+    }
+
+    queue[num_cpu].mode    = mode;
+    queue[num_cpu].routine = function;
+    queue[num_cpu].args    = &args[num_cpu];
+    queue[num_cpu].range_m = NULL;
+    queue[num_cpu].range_n = NULL;
+    queue[num_cpu].sa      = NULL;
+    queue[num_cpu].sb      = NULL;
+    queue[num_cpu].next    = &queue[num_cpu + 1];
+    num_cpu ++;
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[num_cpu - 1].next = NULL;
+
+  exec_blas(num_cpu, queue);
+
+  /* Reduction of the partial products into C */
+  rargs.a   = buffer;
+  rargs.c   = arg -> c;
+  rargs.m   = m * compsize;
+  rargs.lda = num_cpu - 1;
+  rargs.ldb = m * n * compsize;
+  rargs.ldc = arg -> ldc * compsize;
+
+  nthreads = MIN(num_cpu, n);
+
+  range[0] = 0;
+  i        = n;
+  num_cpu  = 0;
+
+  while (i > 0){
+
+    width  = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
+
+    i -= width;
+    if (i < 0) width = width + i;
+
+    range[num_cpu + 1] = range[num_cpu] + width;
+
+    queue[num_cpu].mode    = mode;
+    queue[num_cpu].routine = ((mode & BLAS_PREC) == BLAS_DOUBLE) ? (void *)reduce_d : (void *)reduce_s;
+    queue[num_cpu].args    = &rargs;
+    queue[num_cpu].range_m = NULL;
+    queue[num_cpu].range_n = &range[num_cpu];
+    queue[num_cpu].sa      = NULL;
+    queue[num_cpu].sb      = NULL;
+    queue[num_cpu].next    = &queue[num_cpu + 1];
+    num_cpu ++;
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[num_cpu - 1].next = NULL;
+
+  exec_blas(num_cpu, queue);
+
+  free(buffer);
+
+  return 0;
+}
@@ -0,0 +1,108 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* NUMA split of a threaded GEMM. C is cut into one part per node, in
+   proportion to the threads bound to the node, and each part is run by
+   function (the level 3 threaded driver) on a thread of that node. The
+   nested driver only takes threads of its own node, so the packed panels
+   of B are shared inside a node and replicated across nodes, and packed A
+   stays in the buffer of the thread that packed it. The longer side of C
+   is cut, so that the operand packed again by every node is the smaller
+   one. A call whose threads fit on the caller's node is not split. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#define MAX_SPLIT_NODES 16
+
+int CNAME(int mode, blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*, FLOAT *, FLOAT *, BLASLONG), void *sa, void *sb, BLASLONG nthreads) {
+
+  blas_queue_t queue[MAX_SPLIT_NODES];
+  blas_arg_t   newarg[MAX_SPLIT_NODES];
+  BLASLONG     range[MAX_SPLIT_NODES + 1];
+  int node[MAX_SPLIT_NODES], threads[MAX_SPLIT_NODES];
+
+  BLASLONG from, m, n;
+  int nodes = 0, procs, split_m, i;
+
+  m = arg -> m;
+  n = arg -> n;
+  if (range_m) m = range_m[1] - range_m[0];
+  if (range_n) n = range_n[1] - range_n[0];
+
+  split_m = (m >= n);
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY)
+  nodes = get_node_threads(node, threads, MAX_SPLIT_NODES);
+#endif
+
+  procs = blas_node_split(nthreads, split_m ? m : n, blas_memory_node(), nodes, node, threads, range);
+
+  if (procs <= 1) {
+    arg -> nthreads = nthreads;
+    return function(arg, range_m, range_n, sa, sb, 0);
+  }
+
+  if (split_m)
+    from = range_m ? range_m[0] : 0;
+  else
+    from = range_n ? range_n[0] : 0;
+
+  for (i = 0; i <= procs; i ++) range[i] += from;
+
+  for (i = 0; i < procs; i ++) {
+
+    newarg[i] = *arg;
+    newarg[i].nthreads = threads[i];
+
+    queue[i].mode    = mode | BLAS_NODE | BLAS_NODE_PIN;
+    queue[i].node    = node[i];
+    queue[i].routine = function;
+    queue[i].args    = &newarg[i];
+    queue[i].range_m = split_m ? &range[i] : range_m;
+    queue[i].range_n = split_m ? range_n   : &range[i];
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[procs - 1].next = NULL;
+
+  exec_blas(procs, queue);
+
+  return 0;
+}
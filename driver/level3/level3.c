@@ -133,6 +133,11 @@
 #endif
 #endif
 
+#if defined(GEMM_EPILOGUE) && !defined(EPILOGUE_OPERATION)
+#define EPILOGUE_OPERATION(M, N, C, LDC, X, Y) \
+	sgemm_epilogue(M, N, X, Y, (FLOAT *)(C) + (X) + (Y) * (LDC), LDC, args -> d)
+#endif
+
 #ifndef A
 #define A	args -> a
 #endif
@@ -327,6 +332,13 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	}
       }
 
+#ifdef GEMM_MULTI_RHS
+      /* A block of A may not run into the next member; if that leaves
+	 further blocks, sb has to keep all of its B panels              */
+      min_i = MULTI_CLIP_M(m_from, min_i);
+      if (m_from + min_i < m_to) l1stride = 1;
+#endif
+
       START_RPCC();
 
       ICOPY_OPERATION(min_l, min_i, a, lda, ls, m_from, sa);
@@ -338,6 +350,9 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
       FUSED_KERNEL_OPERATION(min_i, min_j, min_l, alpha,
 			     sa, sb, b, ldb, c, ldc, m_from, js, ls);
 
+#ifdef GEMM_EPILOGUE
+      if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_j, c, ldc, m_from, js);
+#endif
 
 #else
       for(jjs = js; jjs < js + min_j; jjs += min_jj){
@@ -355,6 +370,9 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
           		if (min_jj > GEMM_UNROLL_N) min_jj = GEMM_UNROLL_N;
 #endif
 
+#ifdef GEMM_MULTI_RHS
+	min_jj = MULTI_CLIP_N(jjs, min_jj);
+#endif
 
 	START_RPCC();
 
@@ -374,6 +392,10 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 #endif
 
 	STOP_RPCC(kernelcost);
+
+#ifdef GEMM_EPILOGUE
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_jj, c, ldc, m_from, jjs);
+#endif
       }
 #endif
 
@@ -387,6 +409,10 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	    min_i = ((min_i / 2 + GEMM_UNROLL_M - 1)/GEMM_UNROLL_M) * GEMM_UNROLL_M;
 	  }
 
+#ifdef GEMM_MULTI_RHS
+	min_i = MULTI_CLIP_M(is, min_i);
+#endif
+
 	START_RPCC();
 
 	ICOPY_OPERATION(min_l, min_i, a, lda, ls, is, sa);
@@ -403,6 +429,10 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
 	STOP_RPCC(kernelcost);
 
+#ifdef GEMM_EPILOGUE
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_j, c, ldc, is, js);
+#endif
+
       } /* end of is */
     } /* end of js */
   } /* end of ls */
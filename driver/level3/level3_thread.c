@@ -180,6 +180,11 @@ typedef struct {
 #endif
 #endif
 
+#if defined(GEMM_EPILOGUE) && !defined(EPILOGUE_OPERATION)
+#define EPILOGUE_OPERATION(M, N, C, LDC, X, Y) \
+	sgemm_epilogue(M, N, X, Y, (FLOAT *)(C) + (X) + (Y) * (LDC), LDC, args -> d)
+#endif
+
 #ifndef A
 #define A	args -> a
 #endif
@@ -347,6 +352,13 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
       }
     }
 
+#ifdef GEMM_MULTI_RHS
+    /* A block of A may not run into the next member; if that leaves
+       further blocks, the B panels have to be kept                  */
+    min_i = MULTI_CLIP_M(m_from, min_i);
+    if (m_from + min_i < m_to) l1stride = 1;
+#endif
+
     /* Copy local region of A into workspace */
     START_RPCC();
     ICOPY_OPERATION(min_l, min_i, a, lda, ls, m_from, sa);
@@ -369,6 +381,10 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
       FUSED_KERNEL_OPERATION(min_i, MIN(n_to, js + div_n) - js, min_l, alpha,
 			     sa, buffer[bufferside], b, ldb, c, ldc, m_from, js, ls);
 
+#ifdef GEMM_EPILOGUE
+      if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(n_to, js + div_n) - js, c, ldc, m_from, js);
+#endif
+
 #else
 
       /* Split local region of B into parts */
@@ -385,6 +401,9 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
           else
 */
             if (min_jj > GEMM_UNROLL_N) min_jj = GEMM_UNROLL_N;
+#endif
+#ifdef GEMM_MULTI_RHS
+	min_jj = MULTI_CLIP_N(jjs, min_jj);
 #endif
         /* Copy part of local region of B into workspace */
 	START_RPCC();
@@ -399,6 +418,10 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 			 c, ldc, m_from, jjs);
 	STOP_RPCC(kernel);
 
+#ifdef GEMM_EPILOGUE
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_jj, c, ldc, m_from, jjs);
+#endif
+
 #ifdef TIMING
         ops += 2 * min_i * min_jj * min_l;
 #endif
@@ -439,6 +462,10 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 			   c, ldc, m_from, js);
           STOP_RPCC(kernel);
 
+#ifdef GEMM_EPILOGUE
+	  if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), c, ldc, m_from, js);
+#endif
+
 #ifdef TIMING
 	  ops += 2 * min_i * MIN(range_n[current + 1]  - js,  div_n) * min_l;
 #endif
@@ -462,6 +489,9 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	if (min_i > GEMM_P) {
 	  min_i = (((min_i + 1) / 2 + GEMM_UNROLL_M - 1)/GEMM_UNROLL_M) * GEMM_UNROLL_M;
 	}
+#ifdef GEMM_MULTI_RHS
+      min_i = MULTI_CLIP_M(is, min_i);
+#endif
 
       /* Copy local region of A into workspace */
       START_RPCC();
@@ -482,6 +512,10 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 			   sa, (IFLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
 			   c, ldc, is, js);
           STOP_RPCC(kernel);
+
+#ifdef GEMM_EPILOGUE
+	  if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), c, ldc, is, js);
+#endif
           
 #ifdef TIMING
           ops += 2 * min_i * MIN(range_n[current + 1]  - js, div_n) * min_l;
@@ -531,6 +565,166 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   return 0;
 }
 
+#ifndef GEMM_MULTI_RHS
+/* State of the dynamic mode, shared by the threads of a call.
+ * The work is cut into rounds, one per step in k and panel of n (k
+ * outer), and each round into tasks: first the chunks of the panel of
+ * B to pack into one of two shared slots, then the blocks of C to
+ * update from it. Threads take tasks in order from one counter, so a
+ * thread that is held up only delays the task it holds. A round may
+ * start once the rounds `slots` back have retired, which frees its slot
+ * and, as there are at least `slots` panels, the blocks of C it writes */
+typedef struct {
+  volatile BLASULONG lock;
+  volatile BLASLONG next;
+  volatile BLASLONG retired;
+  volatile BLASLONG packed[2], done[2];
+
+  BLASLONG m_from, m_to, n_from, n_to;
+  BLASLONG min_l, min_i, blocks;
+  BLASLONG width, panels;
+  BLASLONG part, parts;
+  BLASLONG chunk, chunks;
+  BLASLONG slots, rounds, tasks;
+  IFLOAT *buffer[2];
+} dynamic_t;
+
+/* Takes the next task with one atomic add where the compiler has one */
+static inline BLASLONG dynamic_claim(dynamic_t *dyn){
+
+  BLASLONG task;
+
+#if defined(__GNUC__)
+  task = __sync_fetch_and_add(&dyn -> next, 1);
+#else
+  blas_lock(&dyn -> lock);
+  task = dyn -> next ++;
+  blas_unlock(&dyn -> lock);
+#endif
+
+  return task;
+}
+
+static int inner_dynamic(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IFLOAT *sb, BLASLONG mypos){
+
+  dynamic_t *dyn = (dynamic_t *)args -> common;
+
+  BLASLONG k, lda, ldb, ldc;
+
+  FLOAT *alpha, *beta;
+  IFLOAT *a, *b;
+  FLOAT *c;
+
+  BLASLONG task, round, slot, i;
+  int block;
+  BLASLONG ls, min_l, pad_min_l, js, min_j, is, min_i, jjs, min_jj;
+
+  k = K;
+
+  a = (IFLOAT *)A;
+  b = (IFLOAT *)B;
+  c = (FLOAT *)C;
+
+  lda = LDA;
+  ldb = LDB;
+  ldc = LDC;
+
+  alpha = (FLOAT *)args -> alpha;
+  beta  = (FLOAT *)args -> beta;
+
+  while (1) {
+
+    task = dynamic_claim(dyn);
+
+    if (task >= dyn -> rounds * dyn -> tasks) break;
+
+    block = blas_dynamic_task(task, dyn -> tasks, dyn -> chunks, &round, &task);
+    slot  = round % dyn -> slots;
+
+    ls    = (round / dyn -> panels) * dyn -> min_l;
+    min_l = MIN(dyn -> min_l, k - ls);
+    js    = dyn -> n_from + (round % dyn -> panels) * dyn -> width;
+    min_j = MIN(dyn -> width, dyn -> n_to - js);
+
+    pad_min_l = min_l;
+#if defined(HALF)
+#if defined(DYNAMIC_ARCH)
+    pad_min_l = (min_l + gotoblas->sbgemm_align_k - 1) & ~(gotoblas->sbgemm_align_k-1);
+#else
+    pad_min_l = (min_l + SBGEMM_ALIGN_K - 1) & ~(SBGEMM_ALIGN_K - 1);
+#endif
+#endif
+
+    /* Wait until the round that used the slot before has retired */
+    while (dyn -> retired + dyn -> slots <= round) {YIELDING;};
+    MB;
+
+    if (!block) {
+
+      /* Copy a chunk of the panel of B into the slot */
+      jjs    = js + task * dyn -> chunk;
+      min_jj = MIN(dyn -> chunk, js + min_j - jjs);
+      if (min_jj > 0)
+	OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs,
+			dyn -> buffer[slot] + pad_min_l * (jjs - js) * COMPSIZE);
+
+      WMB;
+      blas_lock(&dyn -> lock);
+      dyn -> packed[slot] ++;
+      blas_unlock(&dyn -> lock);
+
+    } else {
+
+      is     = dyn -> m_from + (task / dyn -> parts) * dyn -> min_i;
+      min_i  = MIN(dyn -> min_i, dyn -> m_to - is);
+      jjs    = js + (task % dyn -> parts) * dyn -> part;
+      min_jj = MIN(dyn -> part, js + min_j - jjs);
+
+      if (min_jj > 0) {
+
+	/* Wait until the whole panel of B is packed */
+	while (dyn -> packed[slot] < dyn -> chunks) {YIELDING;};
+	MB;
+
+	if (beta && (ls == 0)) {
+#ifndef COMPLEX
+	  if (beta[0] != ONE)
+#else
+	  if ((beta[0] != ONE) || (beta[1] != ZERO))
+#endif
+	    BETA_OPERATION(is, is + min_i, jjs, jjs + min_jj, beta, c, ldc);
+	}
+
+	ICOPY_OPERATION(min_l, min_i, a, lda, ls, is, sa);
+
+	KERNEL_OPERATION(min_i, min_jj, min_l, alpha,
+			 sa, dyn -> buffer[slot] + pad_min_l * (jjs - js) * COMPSIZE,
+			 c, ldc, is, jjs);
+
+#ifdef GEMM_EPILOGUE
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_jj, c, ldc, is, jjs);
+#endif
+      }
+
+      /* Retire the rounds that are complete, in order */
+      WMB;
+      blas_lock(&dyn -> lock);
+      dyn -> done[slot] ++;
+      while ((dyn -> retired < dyn -> rounds) &&
+	     (dyn -> done[dyn -> retired % dyn -> slots] == dyn -> blocks * dyn -> parts)) {
+	i = dyn -> retired % dyn -> slots;
+	dyn -> packed[i] = 0;
+	dyn -> done[i]   = 0;
+	dyn -> retired ++;
+      }
+      blas_unlock(&dyn -> lock);
+    }
+  }
+
+  return 0;
+}
+#endif
+
 static int round_up(int remainder, int width, int multiple)
 {
 	if (multiple > remainder || width <= multiple)
@@ -572,10 +766,22 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
   static pthread_mutex_t  level3_lock    = PTHREAD_MUTEX_INITIALIZER;
   static pthread_cond_t  level3_wakeup    = PTHREAD_COND_INITIALIZER;
   volatile static BLASLONG CPU_AVAILABLE = MAX_CPU_NUMBER;
+  /* Calls running on a context's own threads do not share the default pool */
+  int use_pool = (blas_context_num_threads() == 0);
 #endif
 
   blas_arg_t newarg;
 
+  int capacity[MAX_CPU_NUMBER];
+  BLASLONG weight_m, weight_n[MAX_CPU_NUMBER], weight_left;
+  int weighted;
+
+  int dynamic = 0;
+#ifndef GEMM_MULTI_RHS
+  dynamic_t dyn;
+  FLOAT *alpha = (FLOAT *)args -> alpha;
+#endif
+
 #ifndef USE_ALLOC_HEAP
   job_t          job[MAX_CPU_NUMBER];
 #else
@@ -640,13 +846,15 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
 #elif defined(OS_WINDOWS)
   EnterCriticalSection((PCRITICAL_SECTION)&level3_lock);
 #else
-  pthread_mutex_lock(&level3_lock);
-  while(CPU_AVAILABLE < nthreads) { 
-    pthread_cond_wait(&level3_wakeup, &level3_lock);
-  } 
-  CPU_AVAILABLE -= nthreads;
-  WMB;
-  pthread_mutex_unlock(&level3_lock);
+  if (use_pool) {
+    pthread_mutex_lock(&level3_lock);
+    while(CPU_AVAILABLE < nthreads) {
+      pthread_cond_wait(&level3_wakeup, &level3_lock);
+    }
+    CPU_AVAILABLE -= nthreads;
+    WMB;
+    pthread_mutex_unlock(&level3_lock);
+  }
 #endif
 
 #ifdef USE_ALLOC_HEAP
@@ -670,6 +878,9 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
   newarg.ldc      = args -> ldc;
   newarg.alpha    = args -> alpha;
   newarg.beta     = args -> beta;
+#if defined(GEMM_EPILOGUE) || defined(GEMM_MULTI_RHS)
+  newarg.d        = args -> d;
+#endif
   newarg.nthreads = args -> nthreads;
   newarg.common   = (void *)job;
 #ifdef PARAMTEST
@@ -678,6 +889,35 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
   newarg.gemm_r   = args -> gemm_r;
 #endif
 
+#ifndef GEMM_MULTI_RHS
+  /* The dynamic mode shares the panels of B through the caller's buffer */
+  dynamic = openblas_get_dynamic_gemm() && (sb != NULL) && (K > 0) && alpha &&
+    ((alpha[0] != ZERO)
+#ifdef COMPLEX
+     || (alpha[1] != ZERO)
+#endif
+     );
+#endif
+
+  /* On hybrid cores the shares follow the speed of the threads: over m
+   * if all threads form one column group, else over n with each group
+   * going at the pace of its slowest thread */
+  weighted = dynamic ? 0 : blas_thread_capacities(nthreads, capacity);
+  weight_m = 0;
+  if (weighted) {
+    for (i = 0; i < nthreads; i++) {
+      weight_n[i] = capacity[i];
+      if (nthreads_n > 1) {
+	j = i - i % nthreads_m;
+	for (k = j; k < j + nthreads_m; k++)
+	  if (capacity[k] < weight_n[i]) weight_n[i] = capacity[k];
+      } else {
+	weight_m += capacity[i];
+	weight_n[i] = 1;
+      }
+    }
+  }
+
   /* Initialize partitions in m and n
    * Note: The number of CPU partitions is stored in the -1 entry */
   range_M = &range_M_buffer[1];
@@ -694,8 +934,14 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
 
   /* Partition m into nthreads_m regions */
   num_parts = 0;
+  weight_left = weight_m;
   while (m > 0){
-    width = blas_quickdivide(m + nthreads_m - num_parts - 1, nthreads_m - num_parts);
+    if (weight_left > 0) {
+      width = (m * capacity[num_parts] + weight_left - 1) / weight_left;
+      weight_left -= capacity[num_parts];
+    } else {
+      width = blas_quickdivide(m + nthreads_m - num_parts - 1, nthreads_m - num_parts);
+    }
 
     width = round_up(m, width, GEMM_PREFERED_SIZE);
 
@@ -724,6 +970,12 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
   queue[0].sa = sa;
   queue[0].sb = sb;
   queue[nthreads - 1].next = NULL;
+  if (weighted) {
+    for (i = 0; i < nthreads; i++) {
+      queue[i].mode    |= BLAS_CAPACITY;
+      queue[i].capacity = capacity[i];
+    }
+  }
 
   /* Iterate through steps of n */
   if (!range_n) {
@@ -733,6 +985,69 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
     n_from = range_n[0];
     n_to   = range_n[1];
   }
+
+#ifndef GEMM_MULTI_RHS
+  if (dynamic) {
+
+    /* Steps in k of at most GEMM_Q and panels of n of at most half of
+     * GEMM_R, so that the two slots fit where the caller packs B */
+    dyn.m_from = range_M[0];
+    dyn.m_to   = range_M[0] + (range_m ? range_m[1] - range_m[0] : args -> m);
+    dyn.n_from = n_from;
+    dyn.n_to   = n_to;
+
+    k = (K + GEMM_Q - 1) / GEMM_Q;
+    dyn.min_l = (K + k - 1) / k;
+
+    width = MAX(GEMM_R / 2 / GEMM_UNROLL_N, 1) * GEMM_UNROLL_N;
+    dyn.panels = (n_to - n_from + width - 1) / width;
+    width = (n_to - n_from + dyn.panels - 1) / dyn.panels;
+    dyn.width = ((width + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+
+    m = dyn.m_to - dyn.m_from;
+    dyn.blocks = (m + GEMM_P - 1) / GEMM_P;
+    width = (m + dyn.blocks - 1) / dyn.blocks;
+    dyn.min_i = ((width + GEMM_UNROLL_M - 1) / GEMM_UNROLL_M) * GEMM_UNROLL_M;
+    dyn.blocks = (m + dyn.min_i - 1) / dyn.min_i;
+
+    /* Cut the panel between threads as well when m has few blocks */
+    dyn.parts = (nthreads + dyn.blocks - 1) / dyn.blocks;
+    width = (dyn.width + dyn.parts - 1) / dyn.parts;
+    dyn.part  = ((width + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+    dyn.parts = (dyn.width + dyn.part - 1) / dyn.part;
+
+    width = (dyn.width + nthreads - 1) / nthreads;
+    dyn.chunk  = ((width + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+    dyn.chunks = (dyn.width + dyn.chunk - 1) / dyn.chunk;
+
+    dyn.slots  = (dyn.panels > 1) ? 2 : 1;
+    dyn.rounds = k * dyn.panels;
+    dyn.tasks  = dyn.chunks + dyn.blocks * dyn.parts;
+
+    width = dyn.min_l;
+#if defined(HALF)
+#if defined(DYNAMIC_ARCH)
+    width = (width + gotoblas->sbgemm_align_k - 1) & ~(gotoblas->sbgemm_align_k-1);
+#else
+    width = (width + SBGEMM_ALIGN_K - 1) & ~(SBGEMM_ALIGN_K - 1);
+#endif
+#endif
+    dyn.buffer[0] = sb;
+    dyn.buffer[1] = sb + width * dyn.width * COMPSIZE;
+
+    dyn.lock      = 0;
+    dyn.next      = 0;
+    dyn.retired   = 0;
+    dyn.packed[0] = dyn.packed[1] = 0;
+    dyn.done[0]   = dyn.done[1]   = 0;
+
+    newarg.common = (void *)&dyn;
+    for (i = 0; i < nthreads; i++) queue[i].routine = inner_dynamic;
+
+    WMB;
+    exec_blas(nthreads, queue);
+  } else
+#endif
   for(js = n_from; js < n_to; js += GEMM_R * nthreads){
     n = n_to - js;
     if (n > GEMM_R * nthreads) n = GEMM_R * nthreads;
@@ -740,8 +1055,15 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
     /* Partition (a step of) n into nthreads regions */
     range_N[0] = js;
     num_parts  = 0;
+    weight_left = 0;
+    if (weighted) for (i = 0; i < nthreads; i++) weight_left += weight_n[i];
     while (n > 0){
-      width = blas_quickdivide(n + nthreads - num_parts - 1, nthreads - num_parts);
+      if (weight_left > 0) {
+	width = (n * weight_n[num_parts] + weight_left - 1) / weight_left;
+	weight_left -= weight_n[num_parts];
+      } else {
+	width = blas_quickdivide(n + nthreads - num_parts - 1, nthreads - num_parts);
+      }
       if (width < switch_ratio) {
         width = switch_ratio;
       }
@@ -791,11 +1113,14 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
 #elif defined(OS_WINDOWS)
   LeaveCriticalSection((PCRITICAL_SECTION)&level3_lock);
 #else
-  pthread_mutex_lock(&level3_lock);
-  CPU_AVAILABLE += nthreads;
-  WMB;
-  pthread_cond_signal(&level3_wakeup);
-  pthread_mutex_unlock(&level3_lock);
+  if (use_pool) {
+    pthread_mutex_lock(&level3_lock);
+    CPU_AVAILABLE += nthreads;
+    WMB;
+    /* Waiters may need different numbers of threads, wake all of them */
+    pthread_cond_broadcast(&level3_wakeup);
+    pthread_mutex_unlock(&level3_lock);
+  }
 #endif
 
   return 0;
@@ -806,11 +1131,6 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IF
   BLASLONG m = args -> m;
   BLASLONG n = args -> n;
   BLASLONG nthreads_m, nthreads_n;
-#if defined(DYNAMIC_ARCH)
-  int switch_ratio = gotoblas->switch_ratio;
-#else
-  int switch_ratio = SWITCH_RATIO;
-#endif
 
   /* Get dimensions from index ranges if available */
   if (range_m) {
@@ -820,35 +1140,11 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IF
     n = range_n[1] - range_n[0];
   }
 
-  /* Partitions in m should have at least switch_ratio rows */
-  if (m < 2 * switch_ratio) {
-    nthreads_m = 1;
-  } else {
-    nthreads_m = args -> nthreads;
-    while (m < nthreads_m * switch_ratio) {
-      nthreads_m = nthreads_m / 2;
-    }
-  }
-
-  /* Partitions in n should have at most switch_ratio * nthreads_m columns */
-  if (n < switch_ratio * nthreads_m) {
-    nthreads_n = 1;
-  } else {
-    nthreads_n = (n + switch_ratio * nthreads_m - 1) / (switch_ratio * nthreads_m);
-    if (nthreads_m * nthreads_n > args -> nthreads) {
-      nthreads_n = blas_quickdivide(args -> nthreads, nthreads_m);
-    }
-    /* The nthreads_m and nthreads_n are adjusted so that the submatrix       */
-    /* to be handled by each thread preferably becomes a square matrix        */
-    /* by minimizing an objective function 'n * nthreads_m + m * nthreads_n'. */
-    /* Objective function come from sum of partitions in m and n.             */
-    /* (n / nthreads_n) + (m / nthreads_m)                                    */
-    /* = (n * nthreads_m + m * nthreads_n) / (nthreads_n * nthreads_m)        */
-    while (nthreads_m % 2 == 0 && n * nthreads_m + m * nthreads_n > n * (nthreads_m / 2) + m * (nthreads_n * 2)) {
-      nthreads_m /= 2;
-      nthreads_n *= 2;
-    }
-  }
+  /* Split the threads the interface settled on over m and n with the same
+     cost model, so that the blocks of C suit the kernel's register block
+     and A is not packed again by more column groups than it pays for */
+  blas_level3_nthreads((double)m, (double)n, (double)K, BLAS_L3_SPLIT_MN, args -> nthreads,
+		       GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, COMPSIZE, &nthreads_m, &nthreads_n);
 
   /* Execute serial or parallel computation */
   if (nthreads_m * nthreads_n <= 1) {
@@ -0,0 +1,474 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Opt-in runtime tuning of the GEMM blocking sizes. Candidate P, Q and R
+   values around the defaults of the selected core are timed on a
+   single-threaded GEMM and the fastest ones are written into the gotoblas
+   table. Candidates are timed with the PARAMTEST builds of the NN drivers
+   (?gemm_tune), which take the sizes from blas_arg_t, so the live table is
+   only written once the search is over. Results are kept in a cache file keyed by the CPU model and are
+   loaded again at startup when OPENBLAS_AUTOTUNE is set. Only DYNAMIC_ARCH
+   builds can change the blocking sizes at runtime. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* blas_arg_t with gemm_p, gemm_q and gemm_r as used by ?gemm_tune */
+#define PARAMTEST
+#include "common.h"
+
+#ifdef DYNAMIC_ARCH
+
+#if !defined(OS_WINDOWS) || defined(OS_CYGWIN_NT)
+#include <time.h>
+#endif
+
+/* Order of the square GEMM that candidates are timed on. It can be */
+/* lowered with OPENBLAS_AUTOTUNE_SIZE, down to TUNE_SIZE_MIN.        */
+#define TUNE_SIZE	768
+#define TUNE_SIZE_MIN	64
+#define TUNE_REPEAT	2
+#define TUNE_ROUTINES	4
+#define TUNE_PATH	1024
+#define TUNE_CANDIDATES	4
+
+typedef int (*tune_driver_t)(blas_arg_t *, BLASLONG *, BLASLONG *, void *, void *, BLASLONG);
+
+typedef struct {
+  const char *name;
+  int *p, *q, *r;
+  int best_p, best_q, best_r;
+  int unroll;
+  int size;
+  int dbl;
+  tune_driver_t driver;
+} tune_gemm_t;
+
+extern char *gotoblas_corename(void);
+extern int openblas_autotune_env(void);
+extern void openblas_warning(int verbose, const char *msg);
+
+static void tune_add(tune_gemm_t *t, const char *name, int *p, int *q, int *r,
+		     int unroll, int size, int dbl, void *driver){
+
+  t -> name   = name;
+  t -> p      = p;
+  t -> q      = q;
+  t -> r      = r;
+  t -> best_p = *p;
+  t -> best_q = *q;
+  t -> best_r = *r;
+  t -> unroll = unroll;
+  t -> size   = size;
+  t -> dbl    = dbl;
+  t -> driver = (tune_driver_t)driver;
+}
+
+static int tune_setup(tune_gemm_t *t){
+
+  int n = 0;
+
+#ifdef BUILD_SINGLE
+  tune_add(&t[n++], "sgemm", &gotoblas -> sgemm_p, &gotoblas -> sgemm_q, &gotoblas -> sgemm_r,
+	   gotoblas -> sgemm_unroll_m, sizeof(float), 0, (void *)sgemm_tune);
+#endif
+#ifdef BUILD_DOUBLE
+  tune_add(&t[n++], "dgemm", &gotoblas -> dgemm_p, &gotoblas -> dgemm_q, &gotoblas -> dgemm_r,
+	   gotoblas -> dgemm_unroll_m, sizeof(double), 1, (void *)dgemm_tune);
+#endif
+#ifdef BUILD_COMPLEX
+  tune_add(&t[n++], "cgemm", &gotoblas -> cgemm_p, &gotoblas -> cgemm_q, &gotoblas -> cgemm_r,
+	   gotoblas -> cgemm_unroll_m, 2 * sizeof(float), 0, (void *)cgemm_tune);
+#endif
+#ifdef BUILD_COMPLEX16
+  tune_add(&t[n++], "zgemm", &gotoblas -> zgemm_p, &gotoblas -> zgemm_q, &gotoblas -> zgemm_r,
+	   gotoblas -> zgemm_unroll_m, 2 * sizeof(double), 1, (void *)zgemm_tune);
+#endif
+
+  return n;
+}
+
+/* Largest R for which the packed panels still fit into one buffer. */
+/* The square GEMM_PQ panel of the LAPACK drivers is allowed for.    */
+static int tune_max_r(tune_gemm_t *t, int p, int q){
+
+  BLASLONG pq = MAX(p, q);
+  BLASLONG a  = ((pq * pq * t -> size + GEMM_OFFSET_A + GEMM_ALIGN) & ~GEMM_ALIGN) + GEMM_OFFSET_B;
+
+  if (a >= BUFFER_SIZE) return 0;
+
+  return ((((BUFFER_SIZE - a) / (q * t -> size)) - 15) & ~15);
+}
+
+static int tune_valid(tune_gemm_t *t, int p, int q, int r){
+
+  if ((p <= 0) || (q <= 0) || (r < 16)) return 0;
+  if (p % t -> unroll) return 0;
+
+  return (r <= tune_max_r(t, p, q));
+}
+
+static double tune_seconds(void){
+
+#if defined(OS_WINDOWS) && !defined(OS_CYGWIN_NT)
+  LARGE_INTEGER freq, now;
+
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&now);
+
+  return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (double)now.tv_sec + (double)now.tv_nsec * 1.e-9;
+#endif
+}
+
+/* Best time of a GEMM of order size with the given blocking sizes */
+static double tune_time(tune_gemm_t *t, void *a, void *b, void *c, void *buffer, int size, int p, int q, int r){
+
+  blas_arg_t args;
+  float  sone[2] = {1.f, 0.f}, szero[2] = {0.f, 0.f};
+  double done[2] = {1.0, 0.0}, dzero[2] = {0.0, 0.0};
+  void *sa, *sb;
+  double start, elapsed, best = 0.;
+  int i;
+
+  sa = (void *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (void *)(((BLASLONG)sa + (((BLASLONG)p * q * t -> size + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+  args.m   = size;
+  args.n   = size;
+  args.k   = size;
+  args.a   = a;
+  args.b   = b;
+  args.c   = c;
+  args.lda = size;
+  args.ldb = size;
+  args.ldc = size;
+  args.gemm_p = p;
+  args.gemm_q = q;
+  args.gemm_r = r;
+  args.alpha    = t -> dbl ? (void *)done  : (void *)sone;
+  args.beta     = t -> dbl ? (void *)dzero : (void *)szero;
+#ifdef SMP
+  args.nthreads = 1;
+  args.common   = NULL;
+#endif
+
+  for (i = 0; i < TUNE_REPEAT; i++) {
+    start = tune_seconds();
+    (t -> driver)(&args, NULL, NULL, sa, sb, 0);
+    elapsed = tune_seconds() - start;
+    if ((i == 0) || (elapsed < best)) best = elapsed;
+  }
+
+  return best;
+}
+
+/* Coordinate search over P, then Q, then R. A candidate has to beat the */
+/* current choice by 1% so that timing noise keeps the defaults. The    */
+/* result is left in best_p, best_q and best_r.                         */
+static void tune_gemm(tune_gemm_t *t, void *a, void *b, void *c, void *buffer, int size){
+
+  static const int quarters[TUNE_CANDIDATES] = {2, 3, 5, 6};
+
+  int p0 = *t -> p, q0 = *t -> q, r0 = *t -> r;
+  int p, q, r, rmax, i;
+  int best_p = p0, best_q = q0, best_r = r0;
+  double best, elapsed;
+
+  best = tune_time(t, a, b, c, buffer, size, p0, q0, r0);
+
+  for (i = 0; i < TUNE_CANDIDATES; i++) {
+    p = ((p0 * quarters[i] / 4 + t -> unroll - 1) / t -> unroll) * t -> unroll;
+    rmax = tune_max_r(t, p, best_q);
+    r = MIN(best_r, rmax);
+    if (!tune_valid(t, p, best_q, r)) continue;
+    elapsed = tune_time(t, a, b, c, buffer, size, p, best_q, r);
+    if (elapsed < best * 0.99) { best = elapsed; best_p = p; best_r = r; }
+  }
+
+  for (i = 0; i < TUNE_CANDIDATES; i++) {
+    q = ((q0 * quarters[i] / 4) + 7) & ~7;
+    rmax = tune_max_r(t, best_p, q);
+    r = MIN(best_r, rmax);
+    if (!tune_valid(t, best_p, q, r)) continue;
+    elapsed = tune_time(t, a, b, c, buffer, size, best_p, q, r);
+    if (elapsed < best * 0.99) { best = elapsed; best_q = q; best_r = r; }
+  }
+
+  rmax = tune_max_r(t, best_p, best_q);
+  for (i = 0; i < 2; i++) {
+    r = (i == 0) ? ((r0 / 2) & ~15) : rmax;
+    if ((r == best_r) || !tune_valid(t, best_p, best_q, r)) continue;
+    elapsed = tune_time(t, a, b, c, buffer, size, best_p, best_q, r);
+    if (elapsed < best * 0.99) { best = elapsed; best_r = r; }
+  }
+
+  t -> best_p = best_p;
+  t -> best_q = best_q;
+  t -> best_r = best_r;
+}
+
+typedef struct {
+  tune_gemm_t *t;
+  int n;
+} tune_list_t;
+
+static void tune_write(void *arg){
+
+  tune_list_t *list = (tune_list_t *)arg;
+  int i;
+
+  for (i = 0; i < list -> n; i++) {
+    *list -> t[i].p = list -> t[i].best_p;
+    *list -> t[i].q = list -> t[i].best_q;
+    *list -> t[i].r = list -> t[i].best_r;
+  }
+}
+
+/* Writes the tuned sizes into the gotoblas table. A GEMM that sized its */
+/* buffer with the old P and Q must not pack with the new ones, so with  */
+/* the pthreads server the table is written while no job runs on the    */
+/* pool. The startup hook runs in the library constructor, before any   */
+/* call can.                                                            */
+static void tune_publish(tune_gemm_t *t, int n){
+
+  tune_list_t list;
+
+  list.t = t;
+  list.n = n;
+
+#if defined(SMP_SERVER) && !defined(USE_OPENMP) && !defined(OS_WINDOWS)
+  blas_thread_quiesce(tune_write, &list);
+#else
+  tune_write(&list);
+  WMB;
+#endif
+}
+
+/* Core name and, on x86, the processor brand string without blanks */
+static void tune_key(char *key, int len){
+
+  char brand[49];
+  int i;
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+  int eax, ebx, ecx, edx, regs[12];
+
+  brand[0] = 0;
+  cpuid(0x80000000, &eax, &ebx, &ecx, &edx);
+  if ((unsigned int)eax >= 0x80000004) {
+    for (i = 0; i < 3; i++)
+      cpuid(0x80000002 + i, &regs[i * 4], &regs[i * 4 + 1], &regs[i * 4 + 2], &regs[i * 4 + 3]);
+    memcpy(brand, regs, 48);
+    brand[48] = 0;
+  }
+#else
+  brand[0] = 0;
+#endif
+
+  snprintf(key, len, "%s:%s", gotoblas_corename(), brand);
+
+  for (i = 0; key[i]; i++)
+    if ((key[i] == ' ') || (key[i] == '\t') || (key[i] == '\n')) key[i] = '_';
+}
+
+static int tune_path(char *path, int len){
+
+  env_var_t p;
+
+  if (readenv(p, "OPENBLAS_AUTOTUNE_FILE") && p[0]) {
+    snprintf(path, len, "%s", p);
+    return 0;
+  }
+  if (readenv(p, "HOME") && p[0]) {
+    snprintf(path, len, "%s/.openblas_autotune", p);
+    return 0;
+  }
+#if defined(OS_WINDOWS) && !defined(OS_CYGWIN_NT)
+  if (readenv(p, "USERPROFILE") && p[0]) {
+    snprintf(path, len, "%s\\.openblas_autotune", p);
+    return 0;
+  }
+#endif
+
+  return -1;
+}
+
+/* Applies the cached sizes for this CPU, returns how many routines had an entry */
+static int tune_load(const char *path, const char *key, tune_gemm_t *t, int n){
+
+  FILE *fp;
+  char line[512], k[256], name[16];
+  int p, q, r, i, found = 0;
+
+  fp = fopen(path, "r");
+  if (fp == NULL) return 0;
+
+  while (fgets(line, sizeof(line), fp)) {
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%255s %15s %d %d %d", k, name, &p, &q, &r) != 5) continue;
+    if (strcmp(k, key)) continue;
+
+    for (i = 0; i < n; i++) {
+      if (strcmp(name, t[i].name) || !tune_valid(&t[i], p, q, r)) continue;
+      t[i].best_p = p;
+      t[i].best_q = q;
+      t[i].best_r = r;
+      found ++;
+    }
+  }
+
+  fclose(fp);
+
+  if (found) tune_publish(t, n);
+
+  return found;
+}
+
+/* Replaces the entries of this CPU in the cache file */
+static void tune_store(const char *path, const char *key, tune_gemm_t *t, int n){
+
+  FILE *in, *out;
+  char line[512], k[256], tmp[TUNE_PATH + 8];
+  int i;
+
+  snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+  out = fopen(tmp, "w");
+  if (out == NULL) return;
+
+  fprintf(out, "# OpenBLAS GEMM blocking sizes: cpu routine P Q R\n");
+
+  in = fopen(path, "r");
+  if (in != NULL) {
+    while (fgets(line, sizeof(line), in)) {
+      if (line[0] == '#') continue;
+      if ((sscanf(line, "%255s", k) == 1) && !strcmp(k, key)) continue;
+      fputs(line, out);
+    }
+    fclose(in);
+  }
+
+  for (i = 0; i < n; i++)
+    fprintf(out, "%s %s %d %d %d\n", key, t[i].name, t[i].best_p, t[i].best_q, t[i].best_r);
+
+  fclose(out);
+
+#if defined(OS_WINDOWS) && !defined(OS_CYGWIN_NT)
+  remove(path);
+#endif
+  if (rename(tmp, path)) remove(tmp);
+}
+
+int openblas_autotune(void){
+
+  tune_gemm_t t[TUNE_ROUTINES];
+  char key[320], path[TUNE_PATH], msg[128];
+  void *a, *b, *c, *buffer;
+  int i, n, size = TUNE_SIZE;
+  env_var_t e;
+
+  if (gotoblas == NULL) return -1;
+
+  if (readenv(e, "OPENBLAS_AUTOTUNE_SIZE") && (atoi(e) > 0))
+    size = MAX(MIN(atoi(e), TUNE_SIZE), TUNE_SIZE_MIN);
+
+  n = tune_setup(t);
+
+  a = calloc((size_t)size * size, 2 * sizeof(double));
+  b = calloc((size_t)size * size, 2 * sizeof(double));
+  c = calloc((size_t)size * size, 2 * sizeof(double));
+  if ((a == NULL) || (b == NULL) || (c == NULL)) {
+    free(a);
+    free(b);
+    free(c);
+    return -1;
+  }
+
+  buffer = blas_memory_alloc(0);
+
+  for (i = 0; i < n; i++) {
+    tune_gemm(&t[i], a, b, c, buffer, size);
+    snprintf(msg, sizeof(msg), "Autotune: %s P=%d Q=%d R=%d\n", t[i].name, t[i].best_p, t[i].best_q, t[i].best_r);
+    openblas_warning(2, msg);
+  }
+
+  blas_memory_free(buffer);
+
+  tune_publish(t, n);
+
+  free(c);
+  free(b);
+  free(a);
+
+  tune_key(key, sizeof(key));
+  if (!tune_path(path, sizeof(path))) tune_store(path, key, t, n);
+
+  return 0;
+}
+
+/* Startup hook: OPENBLAS_AUTOTUNE=1 loads the sizes cached for this CPU */
+/* and tunes (and caches) them when there are none yet.                  */
+void blas_autotune_init(void){
+
+  tune_gemm_t t[TUNE_ROUTINES];
+  char key[320], path[TUNE_PATH];
+  int n;
+
+  if (openblas_autotune_env() <= 0) return;
+
+  n = tune_setup(t);
+  tune_key(key, sizeof(key));
+
+  if (!tune_path(path, sizeof(path)) && (tune_load(path, key, t, n) == n)) {
+    openblas_warning(2, "Autotune: using cached blocking sizes\n");
+    return;
+  }
+
+  openblas_autotune();
+}
+
+#else
+
+/* The blocking sizes are compile-time constants without DYNAMIC_ARCH */
+int openblas_autotune(void){
+  return -1;
+}
+
+#endif
@@ -0,0 +1,140 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "common.h"
+
+/* Runs a batch of independent small problems (level 1 and 2 batch calls).
+   Each args[i].routine has the blas_arg_t signature of a level 3 driver,
+   and args[i].m * args[i].n stands for the work of the member. The batch is
+   cut into one contiguous run of members per thread, of about equal work,
+   and the runs are started with a single exec_blas call. min_per_thread is
+   the least work worth giving a thread of its own. use_buffer asks for a
+   work buffer for the members run by the caller, as gemv members need;
+   each member's nthreads is set to the number of threads the batch is
+   spread over.                                                            */
+
+typedef int (*batch_routine_t)(blas_arg_t *, BLASLONG *, BLASLONG *, void *, void *, BLASLONG);
+
+static int batch_run(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		     void *sa, void *sb, BLASLONG mypos){
+
+  BLASLONG i;
+
+  for (i = range_m[0]; i < range_m[1]; i++)
+    ((batch_routine_t)args[i].routine)(&args[i], NULL, NULL, sa, sb, mypos);
+
+  return 0;
+}
+
+int blas_batch_thread(blas_arg_t *args, BLASLONG nums, BLASLONG min_per_thread, int use_buffer){
+
+  void *buffer = NULL;
+  BLASLONG range[2];
+#ifdef SMP
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG ranges[MAX_CPU_NUMBER + 1];
+  double work, done, share;
+  BLASLONG i, num_cpu;
+  int nthreads;
+#endif
+
+  if (nums <= 0) return 0;
+
+  /* for the members run by the calling thread, the other threads take
+     their buffers from the server */
+  if (use_buffer) buffer = blas_memory_alloc(1);
+
+#ifdef SMP
+  work = 0.;
+  for (i = 0; i < nums; i++)
+    work += (double)MAX(args[i].m, 1) * (double)MAX(args[i].n, 1);
+
+  nthreads = num_cpu_avail(2);
+  if ((double)nthreads * (double)min_per_thread > work)
+    nthreads = (int)(work / (double)MAX(min_per_thread, 1));
+  if (nthreads > nums) nthreads = nums;
+
+  for (i = 0; i < nums; i++) args[i].nthreads = MAX(nthreads, 1);
+
+  if (nthreads > 1) {
+
+    /* each thread takes members until it holds its share of what is left,
+       leaving at least one member for every thread still to come */
+    num_cpu = 0;
+    done = 0.;
+    i = 0;
+    ranges[0] = 0;
+
+    while (i < nums) {
+      share = done + (work - done) / (double)(nthreads - num_cpu);
+
+      do {
+	done += (double)MAX(args[i].m, 1) * (double)MAX(args[i].n, 1);
+	i++;
+      } while ((i < nums) && (done < share) && (nums - i > nthreads - num_cpu - 1));
+
+      if (num_cpu == nthreads - 1) i = nums;
+
+      queue[num_cpu].mode    = args[0].routine_mode;
+      queue[num_cpu].routine = (void *)batch_run;
+      queue[num_cpu].args    = args;
+      queue[num_cpu].range_m = &ranges[num_cpu];
+      queue[num_cpu].range_n = NULL;
+      queue[num_cpu].sa      = NULL;
+      queue[num_cpu].sb      = NULL;
+      queue[num_cpu].next    = &queue[num_cpu + 1];
+
+      num_cpu++;
+      ranges[num_cpu] = i;
+    }
+
+    queue[0].sb = buffer;
+    queue[num_cpu - 1].next = NULL;
+
+    exec_blas(num_cpu, queue);
+
+    if (buffer) blas_memory_free(buffer);
+    return 0;
+  }
+#endif
+
+  range[0] = 0;
+  range[1] = nums;
+
+  batch_run(args, range, NULL, NULL, buffer, 0);
+
+  if (buffer) blas_memory_free(buffer);
+
+  return 0;
+}
@@ -0,0 +1,258 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Relative speed of the cores of hybrid machines (P-cores and E-cores,
+   big.LITTLE), on the 0 to 1024 scale of the Linux cpu_capacity files.
+
+   The values come from /sys/devices/system/cpu/cpuN/cpu_capacity where
+   the kernel provides them (arm64). On x86 with the hybrid flag of cpuid
+   leaf 7, the CPUs in the cpu_atom PMU list are E-cores and get
+   BLAS_CAPACITY_ATOM; without that list, a thread types the CPU it runs
+   on with cpuid leaf 0x1A (blas_capacity_probe). The thread server uses
+   them to weight the share of each thread in a call. */
+
+#include "common.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Throughput of an E-core in GEMM kernels, relative to a P-core */
+#ifndef BLAS_CAPACITY_ATOM
+#define BLAS_CAPACITY_ATOM 410
+#endif
+
+#if defined(OS_LINUX) && defined(SMP)
+
+#define CAPACITY_CPUS CPU_SETSIZE
+
+/* 0 where not known */
+static short capacity[CAPACITY_CPUS];
+static int capacity_cpus = 0;
+static int capacity_hybrid = 0;
+static int capacity_cpuid = 0;
+static volatile int capacity_ready = 0;
+static BLASULONG capacity_lock = 0UL;
+
+static int capacity_read(int cpu){
+
+  char path[64];
+  FILE *fp;
+  int value = 0;
+
+  snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpu_capacity", cpu);
+
+  fp = fopen(path, "r");
+  if (fp == NULL) return 0;
+  if (fscanf(fp, "%d", &value) != 1) value = 0;
+  fclose(fp);
+
+  if (value < 0) value = 0;
+  if (value > BLAS_CAPACITY_FULL) value = BLAS_CAPACITY_FULL;
+
+  return value;
+}
+
+/* Sets the CPUs of a list such as "16-23" or "8-11,20-23" to value */
+static int capacity_read_list(const char *path, int value){
+
+  FILE *fp;
+  int first, last, cpu, found = 0;
+  char sep;
+
+  fp = fopen(path, "r");
+  if (fp == NULL) return 0;
+
+  while (fscanf(fp, "%d", &first) == 1) {
+    last = first;
+    if (fscanf(fp, "%c", &sep) == 1 && sep == '-') {
+      if (fscanf(fp, "%d", &last) != 1) break;
+      if (fscanf(fp, "%c", &sep) != 1) sep = '\n';
+    }
+    for (cpu = first; (cpu <= last) && (cpu < capacity_cpus); cpu ++) {
+      if (cpu >= 0) capacity[cpu] = value;
+    }
+    found = 1;
+    if (sep != ',') break;
+  }
+
+  fclose(fp);
+
+  return found;
+}
+
+static void capacity_check(void){
+
+  int cpu, known = 0;
+
+  for (cpu = 0; cpu < capacity_cpus; cpu ++) {
+    if (capacity[cpu] == 0) continue;
+    if (known && (capacity[cpu] != known)) capacity_hybrid = 1;
+    known = capacity[cpu];
+  }
+}
+
+static void capacity_init(void){
+
+  int cpu, found = 0;
+#ifdef ARCH_X86_64
+  int eax, ebx, ecx, edx;
+#endif
+
+  if (capacity_ready) return;
+
+  blas_lock(&capacity_lock);
+
+  if (!capacity_ready) {
+
+    capacity_cpus = sysconf(_SC_NPROCESSORS_CONF);
+    if (capacity_cpus > CAPACITY_CPUS) capacity_cpus = CAPACITY_CPUS;
+    if (capacity_cpus < 1) capacity_cpus = 1;
+
+    for (cpu = 0; cpu < capacity_cpus; cpu ++) {
+      capacity[cpu] = capacity_read(cpu);
+      if (capacity[cpu]) found = 1;
+    }
+
+#ifdef ARCH_X86_64
+    if (!found) {
+      cpuid(0, &eax, &ebx, &ecx, &edx);
+      if (eax >= 0x1a) {
+	cpuid_count(7, 0, &eax, &ebx, &ecx, &edx);
+	capacity_cpuid = (edx >> 15) & 1;
+      }
+      if (capacity_cpuid &&
+	  capacity_read_list("/sys/devices/cpu_atom/cpus", BLAS_CAPACITY_ATOM)) {
+	for (cpu = 0; cpu < capacity_cpus; cpu ++)
+	  if (capacity[cpu] == 0) capacity[cpu] = BLAS_CAPACITY_FULL;
+      }
+    }
+#endif
+
+    capacity_check();
+
+    WMB;
+    capacity_ready = 1;
+  }
+
+  blas_unlock(&capacity_lock);
+}
+
+/* Types the CPU the calling thread runs on, if the tables had nothing */
+void blas_capacity_probe(void){
+
+#ifdef ARCH_X86_64
+  int eax, ebx, ecx, edx, cpu, value;
+
+  capacity_init();
+
+  if (!capacity_cpuid) return;
+
+  cpu = sched_getcpu();
+  if ((cpu < 0) || (cpu >= capacity_cpus) || capacity[cpu]) return;
+
+  cpuid_count(0x1a, 0, &eax, &ebx, &ecx, &edx);
+
+  switch ((eax >> 24) & 0xff) {
+  case 0x20 : value = BLAS_CAPACITY_ATOM; break;
+  case 0x40 : value = BLAS_CAPACITY_FULL; break;
+  default   : return;
+  }
+
+  blas_lock(&capacity_lock);
+  capacity[cpu] = value;
+  capacity_check();
+  blas_unlock(&capacity_lock);
+#endif
+}
+
+int blas_hybrid_cores(void){
+
+  capacity_init();
+
+  return capacity_hybrid;
+}
+
+/* Mean capacity of the CPUs of a mask, so that a thread free to move
+   over all of them counts as an average core */
+int blas_cpuset_capacity(size_t size, const cpu_set_t *set){
+
+  int cpu, count = 0, all = 0;
+  long sum = 0, total = 0;
+
+  capacity_init();
+
+  if (!capacity_hybrid) return BLAS_CAPACITY_FULL;
+
+  for (cpu = 0; cpu < capacity_cpus; cpu ++) {
+    if (capacity[cpu] == 0) continue;
+    total += capacity[cpu];
+    all ++;
+    if (CPU_ISSET_S(cpu, size, set)) {
+      sum += capacity[cpu];
+      count ++;
+    }
+  }
+
+  if (count) return (int)(sum / count);
+  if (all)   return (int)(total / all);
+
+  return BLAS_CAPACITY_FULL;
+}
+
+#else
+
+void blas_capacity_probe(void){
+}
+
+int blas_hybrid_cores(void){
+  return 0;
+}
+
+#endif
+
+/* The OpenMP and Windows servers do not weight their threads */
+#if !defined(SMP_SERVER) || defined(USE_OPENMP) || defined(OS_WINDOWS)
+
+int openblas_set_thread_capacity(int thread_idx, int capacity){
+  return -1;
+}
+
+int openblas_get_thread_capacity(int thread_idx){
+  return BLAS_CAPACITY_FULL;
+}
+
+int blas_thread_capacities(BLASLONG num, int *capacity){
+  return 0;
+}
+
+#endif
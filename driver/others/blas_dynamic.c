@@ -0,0 +1,84 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+
+/* Switch for the dynamic mode of the threaded level 3 driver
+   (driver/level3/level3_thread.c). It is read from OPENBLAS_DYNAMIC_GEMM
+   unless openblas_set_dynamic_gemm() has been called. */
+
+#include "common.h"
+
+extern int openblas_dynamic_gemm_env(void);
+
+/* Negative while OPENBLAS_DYNAMIC_GEMM has not been consulted; the
+   first threaded level 3 call or the first get/set settles it */
+static volatile int dynamic_gemm = -1;
+
+int openblas_get_dynamic_gemm(void){
+
+  int mode = dynamic_gemm;
+
+  if (mode < 0) {
+    mode = (openblas_dynamic_gemm_env() != 0);
+    dynamic_gemm = mode;
+  }
+
+  return mode;
+}
+
+int openblas_set_dynamic_gemm(int enable){
+
+  int old = openblas_get_dynamic_gemm();
+
+  dynamic_gemm = (enable != 0);
+  WMB;
+
+  return old;
+}
+
+/* Decodes task number task of the dynamic mode of level3_thread.c. The
+   threads claim the tasks in order: round after round, tasks of them per
+   round, and in each round the chunks of B to pack before the blocks of
+   C that use them. Sets the round and the number of the chunk or block
+   in it; returns 0 for a chunk and 1 for a block. */
+int blas_dynamic_task(BLASLONG task, BLASLONG tasks, BLASLONG chunks, BLASLONG *round, BLASLONG *index){
+
+  *round = task / tasks;
+  *index = task - *round * tasks;
+
+  if (*index < chunks) return 0;
+
+  *index -= chunks;
+  return 1;
+}
@@ -0,0 +1,248 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Optional huge page backend for the BUFFER_SIZE buffers of memory.c.
+   The backend is picked at run time with OPENBLAS_HUGEPAGES or
+   openblas_set_hugepages(); a backend that cannot map a buffer falls
+   back to the next smaller page size and finally to the regular
+   allocators of memory.c. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#if defined(OS_LINUX) && !defined(OS_EMBEDDED)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HUGEPAGE_LINUX
+#endif
+
+#ifndef MAP_HUGETLB
+#define MAP_HUGETLB    0x40000
+#endif
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MADV_HUGEPAGE
+#define MADV_HUGEPAGE  14
+#endif
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+
+#define HUGEPAGE_2M_SHIFT 21
+#define HUGEPAGE_1G_SHIFT 30
+
+#define NUM_BACKENDS (OPENBLAS_HUGEPAGES_1G + 1)
+
+extern int openblas_hugepages_env(void);
+
+/* Selected backend; OPENBLAS_HUGEPAGES is only looked at when the first
+   buffer is mapped or the mode is first queried or set */
+static volatile int hugepage_mode = -1;
+
+static BLASULONG hugepage_lock = 0UL;
+static BLASULONG hugepage_count[NUM_BACKENDS];
+
+static int hugepage_get_mode(void){
+
+  int mode = hugepage_mode;
+
+  if (mode < 0) {
+    mode = openblas_hugepages_env();
+    if (mode > OPENBLAS_HUGEPAGES_1G) mode = OPENBLAS_HUGEPAGES_1G;
+    hugepage_mode = mode;
+  }
+
+  return mode;
+}
+
+int openblas_set_hugepages(int mode){
+
+  int old;
+
+  if ((mode < OPENBLAS_HUGEPAGES_NONE) || (mode > OPENBLAS_HUGEPAGES_1G)) return -1;
+
+  old = hugepage_get_mode();
+  hugepage_mode = mode;
+  WMB;
+
+  return old;
+}
+
+int openblas_get_hugepages(void){
+  return hugepage_get_mode();
+}
+
+void openblas_get_hugepage_stats(size_t *counts){
+
+  int i;
+
+  if (counts == NULL) return;
+
+  blas_lock(&hugepage_lock);
+  for (i = 0; i < NUM_BACKENDS; i ++) counts[i] = (size_t)hugepage_count[i];
+  blas_unlock(&hugepage_lock);
+}
+
+void blas_hugepage_account(int backend){
+
+  blas_lock(&hugepage_lock);
+  hugepage_count[backend] ++;
+  blas_unlock(&hugepage_lock);
+}
+
+#if defined(HUGEPAGE_LINUX) && defined(__GNUC__)
+/* getcpu is a system call and blas_memory_alloc asks on every call, so a
+   thread keeps the node it first ran on. The server threads are bound to
+   their cores when affinity is enabled; a thread the scheduler moves to
+   another node merely gets buffers placed on the old one. */
+static __thread int memory_node = -1;
+#endif
+
+int blas_memory_node(void){
+
+#ifdef HUGEPAGE_LINUX
+  unsigned int cpu, node;
+
+#ifdef __GNUC__
+  if (memory_node >= 0) return memory_node;
+#endif
+
+  if (syscall(SYS_getcpu, &cpu, &node, NULL) == 0) {
+#ifdef __GNUC__
+    memory_node = (int)node;
+#endif
+    return (int)node;
+  }
+#endif
+
+  return 0;
+}
+
+#ifdef HUGEPAGE_LINUX
+
+static void *hugepage_map_hugetlb(BLASULONG size, int shift){
+
+  return mmap(NULL, size, MMAP_ACCESS, MMAP_POLICY | MAP_HUGETLB | (shift << MAP_HUGE_SHIFT), -1, 0);
+}
+
+/* Transparent huge pages only back 2MB aligned ranges, so map one extra
+   huge page and trim the unaligned head and tail */
+static void *hugepage_map_thp(BLASULONG size){
+
+  BLASULONG align = 1UL << HUGEPAGE_2M_SHIFT;
+  BLASULONG start, head;
+  void *map_address;
+
+  map_address = mmap(NULL, size + align, MMAP_ACCESS, MMAP_POLICY, -1, 0);
+  if (map_address == (void *)-1) return map_address;
+
+  start = ((BLASULONG)map_address + align - 1) & ~(align - 1);
+  head  = start - (BLASULONG)map_address;
+
+  if (head) munmap(map_address, head);
+  munmap((void *)(start + size), align - head);
+
+  map_address = (void *)start;
+
+  if (madvise(map_address, size, MADV_HUGEPAGE)) {
+    munmap(map_address, size);
+    return (void *)-1;
+  }
+
+  return map_address;
+}
+
+#endif
+
+/* Maps at least size bytes with the selected backend, or with the next
+   smaller one if that fails. The pages are preferably placed on the
+   NUMA node node. Returns (void *)-1 if no huge page backend is selected
+   or none of them could map the buffer; otherwise *mapped is the length
+   to pass to blas_hugepage_unmap(). */
+void *blas_hugepage_map(BLASULONG size, int node, BLASULONG *mapped){
+
+  void *map_address = (void *)-1;
+
+#ifdef HUGEPAGE_LINUX
+  BLASULONG length = 0;
+  unsigned long nodemask;
+  int backend;
+
+  for (backend = hugepage_get_mode(); backend > OPENBLAS_HUGEPAGES_NONE; backend --) {
+
+    switch (backend) {
+    case OPENBLAS_HUGEPAGES_1G :
+      length = (size + (1UL << HUGEPAGE_1G_SHIFT) - 1) & ~((1UL << HUGEPAGE_1G_SHIFT) - 1);
+      map_address = hugepage_map_hugetlb(length, HUGEPAGE_1G_SHIFT);
+      break;
+    case OPENBLAS_HUGEPAGES_2M :
+      length = (size + (1UL << HUGEPAGE_2M_SHIFT) - 1) & ~((1UL << HUGEPAGE_2M_SHIFT) - 1);
+      map_address = hugepage_map_hugetlb(length, HUGEPAGE_2M_SHIFT);
+      break;
+    default :
+      length = (size + (1UL << HUGEPAGE_2M_SHIFT) - 1) & ~((1UL << HUGEPAGE_2M_SHIFT) - 1);
+      map_address = hugepage_map_thp(length);
+      break;
+    }
+
+    if (map_address != (void *)-1) break;
+  }
+
+  if (map_address == (void *)-1) return map_address;
+
+  /* No page has been touched yet, so the policy decides where they go */
+  if ((node >= 0) && (node < (int)(sizeof(nodemask) * 8) - 1)) {
+    nodemask = 1UL << node;
+    my_mbind(map_address, length, MPOL_PREFERRED, &nodemask, sizeof(nodemask) * 8, 0);
+  }
+
+  blas_hugepage_account(backend);
+
+  *mapped = length;
+#endif
+
+  return map_address;
+}
+
+void blas_hugepage_unmap(void *address, BLASULONG mapped){
+
+#ifdef HUGEPAGE_LINUX
+  if (munmap(address, mapped)) {
+    printf("OpenBLAS : munmap of huge page buffer failed\n");
+  }
+#endif
+}
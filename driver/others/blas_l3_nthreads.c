@@ -0,0 +1,211 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Thread count and m/n partition of level 3 operations.
+
+   The time of a call on nthreads_m x nthreads_n threads is estimated in
+   units of one multiply-add of the kernel, for the slowest thread:
+
+     compute  the thread's block of C, with its m and n extents rounded up
+              to the register block of the kernel (edge waste);
+     packing  its rows of A, which every one of the nthreads_n column
+              groups packs again, and its share of the B panels of its
+              group, weighted by the flops the kernel does per element
+              it loads;
+     sync     waking the threads, and the handshake over the B panels of
+              each Q block among the nthreads_m threads of a group.
+
+   A small C with a long inner dimension can instead be computed by threads
+   that each take a slice of k into a private copy of C (gemm_thread_k.c);
+   that costs one pass over all copies of C for the reduction, and no
+   handshakes per Q block.
+
+   The sync cost is calibrated so that a square operation starts to use
+   two threads at the size where the interfaces used to switch, i.e.
+   GEMM_MULTITHREAD_THRESHOLD times 65536 multiply-adds, so that knob keeps
+   its meaning. Everything else comes from the blocking parameters of the
+   core the library runs on.
+
+   The model is not calibrated per core: there is no measured flop rate
+   or memory bandwidth. Packing is priced through the register block of
+   the kernel, whose ratio of flops to loads stands in for the balance of
+   compute and bandwidth that the block was chosen for. Measuring both
+   would take a benchmark at startup, which the library does not run
+   unless asked to (see openblas_autotune).                              */
+
+#include <math.h>
+#include "common.h"
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+#define L3_SERIAL_SIZE   (65536.0 * (double)GEMM_MULTITHREAD_THRESHOLD)
+#define L3_SYNC_COST     (L3_SERIAL_SIZE / 8.0)
+
+/* A larger thread count has to be this much faster to be chosen */
+#define L3_MIN_GAIN      0.98
+
+static double level3_cost(double m, double n, double k, BLASLONG nthreads_m, BLASLONG nthreads_n,
+			  BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q, int compsize){
+
+  double mt, nt, pack, cost;
+
+  mt = ceil(ceil(m / (double)nthreads_m) / (double)unroll_m) * (double)unroll_m;
+  nt = ceil(ceil(n / (double)nthreads_n) / (double)unroll_n) * (double)unroll_n;
+
+  pack = (double)(unroll_m * unroll_n) / (double)(unroll_m + unroll_n);
+
+  cost  = (double)(compsize * compsize) * mt * nt * k;
+  cost += (double)compsize * pack * k * (mt + nt / (double)nthreads_m);
+
+  if (nthreads_m * nthreads_n > 1)
+    cost += L3_SYNC_COST * ((double)(nthreads_m * nthreads_n) + ceil(k / (double)q) * (double)nthreads_m);
+
+  return cost;
+}
+
+static double level3_search(double m, double n, double k, int split, int nthreads,
+			    BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q, int compsize,
+			    BLASLONG *nthreads_m, BLASLONG *nthreads_n){
+
+  BLASLONG tm, tn, max_m, max_n, best_m, best_n;
+  double cost, best;
+
+#if defined(DYNAMIC_ARCH)
+  int switch_ratio = gotoblas->switch_ratio;
+#else
+  int switch_ratio = SWITCH_RATIO;
+#endif
+
+  max_m = (split & BLAS_L3_SPLIT_M) ? nthreads : 1;
+  max_n = (split & BLAS_L3_SPLIT_N) ? nthreads : 1;
+
+  /* Partitions in m should have at least switch_ratio rows */
+  if (max_m > m / (double)switch_ratio) max_m = MAX(1, (BLASLONG)(m / (double)switch_ratio));
+  if (max_n > n) max_n = (BLASLONG)n;
+
+  best_m = 1;
+  best_n = 1;
+  best   = level3_cost(m, n, k, 1, 1, unroll_m, unroll_n, q, compsize);
+
+  for (tm = 1; tm <= max_m; tm++) {
+    for (tn = 1; tn <= max_n && tm * tn <= nthreads; tn++) {
+      cost = level3_cost(m, n, k, tm, tn, unroll_m, unroll_n, q, compsize);
+      if (cost < best * ((tm * tn > best_m * best_n) ? L3_MIN_GAIN : 1.0)) {
+	best   = cost;
+	best_m = tm;
+	best_n = tn;
+      }
+    }
+  }
+
+  *nthreads_m = best_m;
+  *nthreads_n = best_n;
+
+  return best;
+}
+
+static int level3_parallel(double m, double n, double k, int nthreads, int compsize){
+
+  return nthreads > 1 && m > 0 && n > 0 && k > 0 &&
+    m * n * k * (double)(compsize * compsize * compsize) > L3_SERIAL_SIZE;
+}
+
+int blas_level3_nthreads(double m, double n, double k, int split, int nthreads,
+			 BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q, int compsize,
+			 BLASLONG *nthreads_m, BLASLONG *nthreads_n){
+
+  BLASLONG best_m, best_n;
+
+  best_m = 1;
+  best_n = 1;
+
+  if (level3_parallel(m, n, k, nthreads, compsize)) {
+
+    if (unroll_m < 1) unroll_m = 1;
+    if (unroll_n < 1) unroll_n = 1;
+    if (q < 1) q = 1;
+
+    level3_search(m, n, k, split, nthreads, unroll_m, unroll_n, q, compsize, &best_m, &best_n);
+  }
+
+  if (nthreads_m) *nthreads_m = best_m;
+  if (nthreads_n) *nthreads_n = best_n;
+
+  return (int)(best_m * best_n);
+}
+
+int blas_level3_nthreads_k(double m, double n, double k, int nthreads,
+			   BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q, int compsize){
+
+  BLASLONG tk, best_k, tm, tn;
+  double mt, nt, kt, pack, cost, best;
+
+  if (!level3_parallel(m, n, k, nthreads, compsize)) return 1;
+
+  if (unroll_m < 1) unroll_m = 1;
+  if (unroll_n < 1) unroll_n = 1;
+  if (q < 1) q = 1;
+
+  if (nthreads > k) nthreads = (int)k;
+
+  best   = level3_search(m, n, k, BLAS_L3_SPLIT_MN, nthreads, unroll_m, unroll_n, q, compsize, &tm, &tn);
+  best_k = 1;
+
+  mt   = ceil(m / (double)unroll_m) * (double)unroll_m;
+  nt   = ceil(n / (double)unroll_n) * (double)unroll_n;
+  pack = (double)(unroll_m * unroll_n) / (double)(unroll_m + unroll_n);
+
+  for (tk = 2; tk <= nthreads; tk++) {
+
+    kt = ceil(k / (double)tk);
+
+    cost  = (double)(compsize * compsize) * mt * nt * kt;
+    cost += (double)compsize * pack * kt * (mt + nt);
+
+    /* Each thread adds the tk copies of its share of C */
+    cost += (double)compsize * pack * m * n;
+
+    /* Two parallel phases */
+    cost += L3_SYNC_COST * 2.0 * (double)tk;
+
+    if (cost < best * L3_MIN_GAIN) {
+      best   = cost;
+      best_k = tk;
+    }
+  }
+
+  return (int)best_k;
+}
@@ -0,0 +1,111 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Switch for the NUMA mode of threaded GEMM (interface/gemm.c and
+   driver/level3/gemm_thread_node.c). It is read from OPENBLAS_NUMA_GEMM
+   unless openblas_set_numa_gemm() has been called. */
+
+#include "common.h"
+
+extern int openblas_numa_gemm_env(void);
+
+/* 0 or 1 once openblas_get_numa_gemm() or openblas_set_numa_gemm() has
+   run, negative before that */
+static volatile int numa_gemm = -1;
+
+int openblas_get_numa_gemm(void){
+
+  int mode = numa_gemm;
+
+  if (mode < 0) {
+    mode = (openblas_numa_gemm_env() != 0);
+    numa_gemm = mode;
+  }
+
+  return mode;
+}
+
+int openblas_set_numa_gemm(int enable){
+
+  int old = openblas_get_numa_gemm();
+
+  numa_gemm = (enable != 0);
+  WMB;
+
+  return old;
+}
+
+/* Plan of gemm_thread_node. node and threads hold the table of
+   get_node_threads() on entry; on return their first entries are the
+   nodes the call uses, the caller's node (mynode) first, and the threads
+   it takes on each. size elements of C are cut between them in
+   proportion, range[i] to range[i + 1] going to node i. Returns the
+   number of nodes used. */
+int blas_node_split(BLASLONG nthreads, BLASLONG size, int mynode, int nodes, int *node, int *threads, BLASLONG *range){
+
+  BLASLONG width, left;
+  int procs, i, t;
+
+  /* The caller runs the first part, so it goes to the caller's node */
+  for (i = 1; i < nodes; i ++) {
+    if (node[i] == mynode) {
+      t = node[i];    node[i]    = node[0];    node[0]    = t;
+      t = threads[i]; threads[i] = threads[0]; threads[0] = t;
+      break;
+    }
+  }
+
+  /* Fill the nodes in turn with the threads the call may use */
+  left = nthreads;
+  for (procs = 0; (procs < nodes) && (left > 0); procs ++) {
+    if (threads[procs] > left) threads[procs] = left;
+    left -= threads[procs];
+  }
+  if (procs > 0) threads[0] += left;
+
+  range[0] = 0;
+  left     = nthreads;
+
+  for (i = 0; i < procs; i ++) {
+
+    width = (BLASLONG)((double)size * (double)threads[i] / (double)left);
+    if (i == procs - 1) width = size;
+
+    size -= width;
+    left -= threads[i];
+    range[i + 1] = range[i] + width;
+  }
+
+  return procs;
+}
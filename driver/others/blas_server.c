@@ -137,12 +137,17 @@ typedef struct {
 #if defined(OS_LINUX) && !defined(NO_AFFINITY)
   int	node;
 #endif
+  /* Relative speed of the core(s) the thread runs on, and the one set */
+  /* with openblas_set_thread_capacity() if not 0                     */
+  int	capacity, capacity_user;
 
   volatile long		 status;
 
   pthread_mutex_t	 lock;
   pthread_cond_t	 wakeup;
 
+  struct openblas_context *pool;
+
 } thread_status_t;
 
 #ifdef HAVE_C11
@@ -153,10 +158,69 @@ typedef struct {
 #define	atomic_store_queue(p, v)	(*(volatile blas_queue_t* volatile*)(p) = (v))
 #endif
 
+/* Callers reserve an idle thread by swapping its queue slot from NULL.  */
+/* Without a compare-and-swap every caller takes the queue lock.       */
+#if defined(HAVE_C11) || defined(__GNUC__)
+#define THREAD_CLAIM
+#ifdef HAVE_C11
+#define	atomic_cas_queue(p, o, v)	__atomic_compare_exchange_n(p, &(o), v, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)
+#else
+#define	atomic_cas_queue(p, o, v)	__sync_bool_compare_and_swap(p, o, v)
+#endif
+#else
+#define	atomic_cas_queue(p, o, v)	((atomic_load_queue(p) == (o)) ? (atomic_store_queue(p, v), 1) : 0)
+#endif
+
+#define THREAD_QUEUE_RESERVED	((blas_queue_t *)2)
+
+#ifndef THREAD_CLAIM_RETRIES
+#define THREAD_CLAIM_RETRIES	4
+#endif
+
 
 
 static thread_status_t thread_status[MAX_CPU_NUMBER] __attribute__((aligned(ATTRIBUTE_SIZE)));
 
+/* A pool of server threads. The default pool is made of the static   */
+/* arrays above and sized by blas_num_threads, further pools are      */
+/* created by openblas_context_create() and used by the threads that  */
+/* made them current.                                                 */
+
+struct openblas_context {
+  thread_status_t   *status;
+  pthread_t         *threads;
+  void             **buffer;
+  int                num_threads;
+  BLASULONG          queue_lock;
+  /* Start of the next search for idle threads, spreads concurrent callers */
+  volatile BLASLONG  queue_hint;
+};
+
+static struct openblas_context blas_pool = {
+  thread_status, blas_threads, blas_thread_buffer, 0, 0UL, 0,
+};
+
+static pthread_key_t  context_key;
+static pthread_once_t context_once = PTHREAD_ONCE_INIT;
+
+static void context_key_init(void){
+  pthread_key_create(&context_key, NULL);
+}
+
+static __inline struct openblas_context *current_pool(void){
+
+  struct openblas_context *context;
+
+  pthread_once(&context_once, context_key_init);
+  context = (struct openblas_context *)pthread_getspecific(context_key);
+
+  return context ? context : &blas_pool;
+}
+
+static __inline int pool_threads(struct openblas_context *pool){
+  return (pool == &blas_pool) ? blas_num_threads : pool -> num_threads;
+}
+
 #ifndef THREAD_TIMEOUT
 #define THREAD_TIMEOUT	28
 #endif
@@ -194,6 +258,7 @@ BLASLONG	exit_time[MAX_CPU_NUMBER];
 
 //Prototypes
 static void exec_threads(int , blas_queue_t *, int);
+static void exec_pool_threads(struct openblas_context *, BLASLONG, blas_queue_t *);
 static void adjust_thread_buffers();
 
 static void legacy_exec(void *func, int mode, blas_arg_t *args, void *sb){
@@ -343,8 +408,28 @@ int get_node(void);
 
 static int increased_threads = 0;
 
+/* Capacity of the calling thread set by openblas_set_thread_capacity() */
+static int caller_capacity = 0;
+static int capacity_user   = 0;
+
+/* Capacity of the cores in the affinity mask of the calling thread */
+static int thread_capacity(void){
+
+#ifdef OS_LINUX
+  cpu_set_t mask;
+
+  blas_capacity_probe();
+
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+    return blas_cpuset_capacity(sizeof(mask), &mask);
+#endif
+
+  return BLAS_CAPACITY_FULL;
+}
+
+extern int openblas_get_num_threads(void);
+
 #ifdef OS_LINUX
-extern int openblas_get_num_threads(void);  
 
 int openblas_setaffinity(int thread_idx, size_t cpusetsize, cpu_set_t* cpu_set) {
   const int active_threads = openblas_get_num_threads();
@@ -358,7 +443,12 @@ int openblas_setaffinity(int thread_idx, size_t cpusetsize, cpu_set_t* cpu_set)
       ? pthread_self()
       : blas_threads[thread_idx];
 
-  return pthread_setaffinity_np(thread, cpusetsize, cpu_set);
+  int ret = pthread_setaffinity_np(thread, cpusetsize, cpu_set);
+
+  if ((ret == 0) && (thread_idx < active_threads - 1) && !thread_status[thread_idx].capacity_user)
+    thread_status[thread_idx].capacity = blas_cpuset_capacity(cpusetsize, cpu_set);
+
+  return ret;
 }
 int openblas_getaffinity(int thread_idx, size_t cpusetsize, cpu_set_t* cpu_set) {
   const int active_threads = openblas_get_num_threads();
@@ -376,10 +466,60 @@ int openblas_getaffinity(int thread_idx, size_t cpusetsize, cpu_set_t* cpu_set)
 }
 #endif
 
+/* Relative speed of the core an OpenBLAS thread runs on, 0 to detect it again */
+int openblas_set_thread_capacity(int thread_idx, int capacity) {
+  const int active_threads = openblas_get_num_threads();
+  int i;
+
+  if (thread_idx < 0 || thread_idx >= active_threads || capacity < 0) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  if (capacity > BLAS_CAPACITY_FULL) capacity = BLAS_CAPACITY_FULL;
+
+  if (thread_idx == active_threads - 1) {
+    caller_capacity = capacity;
+  } else {
+    thread_status[thread_idx].capacity_user = capacity;
+    thread_status[thread_idx].capacity = capacity ? capacity : BLAS_CAPACITY_FULL;
+
+#ifdef OS_LINUX
+    if (!capacity) {
+      cpu_set_t mask;
+      if (pthread_getaffinity_np(blas_threads[thread_idx], sizeof(mask), &mask) == 0)
+	thread_status[thread_idx].capacity = blas_cpuset_capacity(sizeof(mask), &mask);
+    }
+#endif
+  }
+
+  /* Once every capacity is back to 0 the calls stop weighing them */
+  capacity_user = (caller_capacity != 0);
+  for (i = 0; (i < MAX_CPU_NUMBER) && !capacity_user; i ++)
+    if (thread_status[i].capacity_user) capacity_user = 1;
+
+  return 0;
+}
+
+int openblas_get_thread_capacity(int thread_idx) {
+  const int active_threads = openblas_get_num_threads();
+
+  if (thread_idx < 0 || thread_idx >= active_threads) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  if (thread_idx == active_threads - 1)
+    return caller_capacity ? caller_capacity : thread_capacity();
+
+  return thread_status[thread_idx].capacity ? thread_status[thread_idx].capacity : BLAS_CAPACITY_FULL;
+}
+
 static void* blas_thread_server(void *arg){
 
   /* Thread identifier */
-  BLASLONG  cpu = (BLASLONG)arg;
+  thread_status_t *ts = (thread_status_t *)arg;
+  BLASLONG  cpu = ts - ts -> pool -> status;
   unsigned int last_tick;
   blas_queue_t	*queue;
 
@@ -390,12 +530,20 @@ blas_queue_t *tscq;
 #endif
 
 #if defined(OS_LINUX) && !defined(NO_AFFINITY)
-  if (!increased_threads)
-    thread_status[cpu].node = gotoblas_set_affinity(cpu + 1);
+  if (!increased_threads && (ts -> pool == &blas_pool))
+    ts -> node = gotoblas_set_affinity(cpu + 1);
   else
-    thread_status[cpu].node = gotoblas_set_affinity(-1);
+    ts -> node = gotoblas_set_affinity(-1);
 #endif
 
+  ts -> capacity = ts -> capacity_user ? ts -> capacity_user : thread_capacity();
+
+  /* openblas_context_create() waits for this before it returns */
+  if (ts -> pool != &blas_pool) {
+    MB;
+    ts -> status = THREAD_STATUS_WAKEUP;
+  }
+
 #ifdef MONITOR
   main_status[cpu] = MAIN_ENTER;
 #endif
@@ -416,37 +564,37 @@ blas_queue_t *tscq;
 
       last_tick = (unsigned int)rpcc();
 
-      tscq = atomic_load_queue(&thread_status[cpu].queue);
+      tscq = atomic_load_queue(&ts -> queue);
 
-	while(!tscq || tscq == 0x1) {
+	while(!tscq || tscq == 0x1 || tscq == THREAD_QUEUE_RESERVED) {
 	YIELDING;
 
 	if ((unsigned int)rpcc() - last_tick > thread_timeout) {
 
 
-	  if (!atomic_load_queue(&thread_status[cpu].queue)) {
-	    pthread_mutex_lock  (&thread_status[cpu].lock);
-	    thread_status[cpu].status = THREAD_STATUS_SLEEP;
-	    while (thread_status[cpu].status == THREAD_STATUS_SLEEP && 
-			    !atomic_load_queue(&thread_status[cpu].queue)) {
+	  if (!atomic_load_queue(&ts -> queue)) {
+	    pthread_mutex_lock  (&ts -> lock);
+	    ts -> status = THREAD_STATUS_SLEEP;
+	    while (ts -> status == THREAD_STATUS_SLEEP && 
+			    !atomic_load_queue(&ts -> queue)) {
 
 #ifdef MONITOR
 	      main_status[cpu] = MAIN_SLEEPING;
 #endif
 
-	      pthread_cond_wait(&thread_status[cpu].wakeup, &thread_status[cpu].lock);
+	      pthread_cond_wait(&ts -> wakeup, &ts -> lock);
 	    }
-	    pthread_mutex_unlock(&thread_status[cpu].lock);
+	    pthread_mutex_unlock(&ts -> lock);
 	  }
 
 	  last_tick = (unsigned int)rpcc();
 	}
 
-	tscq = atomic_load_queue(&thread_status[cpu].queue);
+	tscq = atomic_load_queue(&ts -> queue);
 
       }
 
-      queue = atomic_load_queue(&thread_status[cpu].queue);
+      queue = atomic_load_queue(&ts -> queue);
       MB;
 
     if ((long)queue == -1) break;
@@ -460,7 +608,7 @@ blas_queue_t *tscq;
 #endif
 
   if(queue) {
-    exec_threads(cpu, queue, 0);
+    exec_pool_threads(ts -> pool, cpu, queue);
   }
 
 #ifdef MONITOR
@@ -583,13 +731,14 @@ int blas_thread_init(void){
 
       pthread_mutex_init(&thread_status[i].lock, NULL);
       pthread_cond_init (&thread_status[i].wakeup, NULL);
+      thread_status[i].pool = &blas_pool;
 
 #ifdef NEED_STACKATTR
       ret=pthread_create(&blas_threads[i], &attr,
-		     &blas_thread_server, (void *)i);
+		     &blas_thread_server, (void *)&thread_status[i]);
 #else
       ret=pthread_create(&blas_threads[i], NULL,
-		     &blas_thread_server, (void *)i);
+		     &blas_thread_server, (void *)&thread_status[i]);
 #endif
       if(ret!=0){
 	struct rlimit rlim;
@@ -631,7 +780,107 @@ int blas_thread_init(void){
      exec_blas       ... returns after jobs are finished.
 */
 
-static BLASULONG exec_queue_lock = 0;
+/* Capacities to weight the num jobs of a call with: the calling     */
+/* thread's for job 0, which it runs itself, then the fastest of the  */
+/* pool's threads, idle ones first. exec_blas() places a job tagged   */
+/* BLAS_CAPACITY on a thread of its capacity when it can.             */
+int blas_thread_capacities(BLASLONG num, int *capacity){
+
+  struct openblas_context *pool = current_pool();
+  thread_status_t *status = pool -> status;
+  BLASLONG nthreads = pool_threads(pool) - 1;
+  BLASLONG i, j, k, n = 1;
+  int pass, c;
+
+  if ((num <= 1) || (!capacity_user && !blas_hybrid_cores())) return 0;
+
+  capacity[0] = caller_capacity ? caller_capacity : thread_capacity();
+
+  for (pass = 0; (pass < 2) && (n < num); pass ++) {
+    k = n;
+    for (i = 0; (i < nthreads) && (n < num); i ++) {
+      if ((atomic_load_queue(&status[i].queue) == NULL) != (pass == 0)) continue;
+      c = status[i].capacity;
+      if (c <= 0) c = BLAS_CAPACITY_FULL;
+      /* insertion into the descending run of this pass */
+      for (j = n; (j > k) && (capacity[j - 1] < c); j --) capacity[j] = capacity[j - 1];
+      capacity[j] = c;
+      n ++;
+    }
+  }
+
+  for (; n < num; n ++) capacity[n] = BLAS_CAPACITY_FULL;
+
+  for (i = 1; i < num; i ++) if (capacity[i] != capacity[0]) return 1;
+
+  return 0;
+}
+
+/* The jobs of one call may wait on each other (level 3 threads share  */
+/* their packed panels), so they are only queued once every job has a */
+/* thread of its own. Returns 0 and releases the reserved threads when */
+/* not enough of them are idle right now.                              */
+
+static int exec_claim_threads(struct openblas_context *pool, blas_queue_t *queue, int node){
+
+  thread_status_t *status = pool -> status;
+  BLASLONG nthreads = pool_threads(pool) - 1;
+  BLASLONG num = 0, start, i, k;
+  blas_queue_t *current, *idle;
+  int pass, want, first, ok;
+
+  for (current = queue; current; current = current -> next) num ++;
+
+  if ((num == 0) || (num > nthreads)) return 0;
+
+  start = pool -> queue_hint;
+  if ((start < 0) || (start >= nthreads)) start = 0;
+  pool -> queue_hint = (start + num) % nthreads;
+
+  for (current = queue; current; current = current -> next) {
+
+    want = node;
+    if ((current -> mode & BLAS_NODE_PIN) && (node >= 0)) want = current -> node;
+
+    /* BLAS_NODE jobs take a thread on their node first, BLAS_CAPACITY */
+    /* jobs one of their capacity; pass 2 takes any idle thread        */
+    first = 2;
+    if ((want >= 0) && (current -> mode & BLAS_NODE)) first = 0;
+    else if (current -> mode & BLAS_CAPACITY) first = 1;
+
+    k = 0;
+    for (pass = first; pass < 3; pass ++) {
+      if ((pass == 1) && !(current -> mode & BLAS_CAPACITY)) continue;
+      for (i = 0; i < nthreads; i ++) {
+	k = start + i;
+	if (k >= nthreads) k -= nthreads;
+
+	ok = 1;
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+	if ((pass == 0) && (status[k].node != want)) ok = 0;
+#endif
+	if ((pass < 2) && (current -> mode & BLAS_CAPACITY) && (status[k].capacity != current -> capacity)) ok = 0;
+	if (!ok || atomic_load_queue(&status[k].queue)) continue;
+
+	idle = (blas_queue_t *)0;
+	if (atomic_cas_queue(&status[k].queue, idle, THREAD_QUEUE_RESERVED)) break;
+      }
+      if (i < nthreads) break;
+    }
+
+    if (pass == 3) break;
+
+    current -> assigned = k;
+    start = (k + 1 < nthreads) ? k + 1 : 0;
+  }
+
+  if (current == NULL) return 1;
+
+  for (; queue != current; queue = queue -> next)
+    atomic_store_queue(&status[queue -> assigned].queue, (blas_queue_t *)0);
+
+  return 0;
+}
 
 int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
 
@@ -642,9 +891,19 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
   BLASLONG i = 0;
   blas_queue_t *current = queue;
   blas_queue_t *tsiq,*tspq;
+  struct openblas_context *pool = current_pool();
+  thread_status_t *thread_status = pool -> status;
+  int blas_num_threads = pool_threads(pool);
+  int claimed = 0;
+#ifdef THREAD_CLAIM
+  int retry;
+#endif
 #if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
-  int node  = get_node();
+  /* Node mapping follows the affinity of the default threads only */
+  int node  = (pool == &blas_pool) ? get_node() : -1;
   int nodes = get_num_nodes();
+#else
+  int node  = -1;
 #endif
 
 #ifdef SMP_DEBUG
@@ -652,7 +911,15 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
   fprintf(STDERR, "Exec_blas_async is called. Position = %d\n", pos);
 #endif
 
-  blas_lock(&exec_queue_lock);
+#ifdef THREAD_CLAIM
+  /* A caller waiting on the queue lock has precedence */
+  for (retry = 0; (retry < THREAD_CLAIM_RETRIES) && !pool -> queue_lock; retry ++) {
+    if ((claimed = exec_claim_threads(pool, queue, node))) break;
+    YIELDING;
+  }
+#endif
+
+  if (!claimed) blas_lock(&pool -> queue_lock);
 
     while (queue) {
       queue -> position  = pos;
@@ -666,11 +933,20 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
 #endif
 #endif
 
+      if (claimed) {
+
+	MB;
+	atomic_store_queue(&thread_status[queue -> assigned].queue, queue);
+
+      } else do {
+
 #if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
 
       /* Node Mapping Mode */
 
-      if (queue -> mode & BLAS_NODE) {
+      if ((queue -> mode & BLAS_NODE) && (node >= 0)) {
+
+	if (queue -> mode & BLAS_NODE_PIN) node = queue -> node;
 
 	do {
       
@@ -707,7 +983,9 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
       queue -> assigned = i;
       MB;
 
-      atomic_store_queue(&thread_status[i].queue, queue);
+      /* Lost the thread to a concurrent caller, look again */
+      tsiq = (blas_queue_t *)0;
+      } while (!atomic_cas_queue(&thread_status[i].queue, tsiq, queue));
 
       queue = queue -> next;
       pos ++;
@@ -717,7 +995,7 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
 
     }
 
-    blas_unlock(&exec_queue_lock);
+  if (!claimed) blas_unlock(&pool -> queue_lock);
 
 #ifdef SMP_DEBUG
     fprintf(STDERR, "Done(Number of threads = %2ld).\n", exec_count);
@@ -756,6 +1034,7 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
 
 int exec_blas_async_wait(BLASLONG num, blas_queue_t *queue){
   blas_queue_t * tsqq;
+  thread_status_t *thread_status = current_pool() -> status;
 
     while ((num > 0) && queue) {
 
@@ -900,13 +1179,14 @@ void goto_set_num_threads(int num_threads) {
 
       pthread_mutex_init(&thread_status[i].lock, NULL);
       pthread_cond_init (&thread_status[i].wakeup, NULL);
+      thread_status[i].pool = &blas_pool;
 
 #ifdef NEED_STACKATTR
       pthread_create(&blas_threads[i], &attr,
-		     &blas_thread_server, (void *)i);
+		     &blas_thread_server, (void *)&thread_status[i]);
 #else
       pthread_create(&blas_threads[i], NULL,
-		     &blas_thread_server, (void *)i);
+		     &blas_thread_server, (void *)&thread_status[i]);
 #endif
     }
 
@@ -975,6 +1255,40 @@ int gotoblas_pthread(int numthreads, void *function, void *args, int stride) {
   return 0;
 }
 
+/* Runs func with the default pool quiesced: under the server lock and */
+/* the queue lock, with every thread of the pool reserved once it has  */
+/* finished its job, so that no job runs on the pool until func is done. */
+void blas_thread_quiesce(void (*func)(void *), void *arg){
+
+  blas_queue_t *idle;
+  int i;
+
+  LOCK_COMMAND(&server_lock);
+  blas_lock(&blas_pool.queue_lock);
+
+  if (blas_server_avail) {
+    for (i = 0; i < blas_num_threads - 1; i++) {
+      while (1) {
+	idle = (blas_queue_t *)0;
+	if (atomic_cas_queue(&thread_status[i].queue, idle, THREAD_QUEUE_RESERVED)) break;
+	YIELDING;
+      }
+    }
+  }
+
+  MB;
+  func(arg);
+  WMB;
+
+  if (blas_server_avail) {
+    for (i = 0; i < blas_num_threads - 1; i++)
+      atomic_store_queue(&thread_status[i].queue, (blas_queue_t *)0);
+  }
+
+  blas_unlock(&blas_pool.queue_lock);
+  UNLOCK_COMMAND(&server_lock);
+}
+
 /* Shutdown procedure, but user don't have to call this routine. The */
 /* kernel automatically kill threads.                                */
 
@@ -1028,13 +1342,173 @@ int BLASFUNC(blas_thread_shutdown)(void){
   return 0;
 }
 
+/* Contexts: separate pools of num_threads - 1 server threads, each   */
+/* with its own buffers. A context serves the threads that made it    */
+/* current; it must not be destroyed while one of them is inside a    */
+/* BLAS call.                                                         */
+
+struct openblas_context *openblas_context_create(int num_threads){
+
+  struct openblas_context *context;
+  int i;
+
+  if (num_threads < 1) num_threads = 1;
+  if (num_threads > MAX_CPU_NUMBER) num_threads = MAX_CPU_NUMBER;
+
+  if (blas_cpu_number == 0) blas_get_cpu_number();
+  if (unlikely(blas_server_avail == 0)) blas_thread_init();
+
+  context = (struct openblas_context *)calloc(1, sizeof(struct openblas_context));
+  if (context == NULL) return NULL;
+
+  if (num_threads > 1) {
+    if (posix_memalign((void **)&context -> status, ATTRIBUTE_SIZE, (num_threads - 1) * sizeof(thread_status_t))) {
+      free(context);
+      return NULL;
+    }
+    context -> threads = (pthread_t *)calloc(num_threads - 1, sizeof(pthread_t));
+    context -> buffer  = (void **)    calloc(num_threads - 1, sizeof(void *));
+    if ((context -> threads == NULL) || (context -> buffer == NULL)) {
+      free(context -> buffer);
+      free(context -> threads);
+      free(context -> status);
+      free(context);
+      return NULL;
+    }
+  }
+
+  context -> num_threads = 1;
+
+  for (i = 0; i < num_threads - 1; i++) {
+
+    atomic_store_queue(&context -> status[i].queue, (blas_queue_t *)0);
+    context -> status[i].status = 0;
+    context -> status[i].capacity = BLAS_CAPACITY_FULL;
+    context -> status[i].capacity_user = 0;
+    context -> status[i].pool   = context;
+    pthread_mutex_init(&context -> status[i].lock, NULL);
+    pthread_cond_init (&context -> status[i].wakeup, NULL);
+
+    if (pthread_create(&context -> threads[i], NULL, &blas_thread_server, (void *)&context -> status[i])) {
+      pthread_mutex_destroy(&context -> status[i].lock);
+      pthread_cond_destroy (&context -> status[i].wakeup);
+      fprintf(STDERR, "OpenBLAS warning: could only start %d of the %d threads of a context\n", i + 1, num_threads);
+      break;
+    }
+
+    context -> num_threads ++;
+  }
+
+  /* The thread may already have gone to sleep, any status will do */
+  for (i = 0; i < context -> num_threads - 1; i++) {
+    while (context -> status[i].status == 0) YIELDING;
+  }
+
+  return context;
+}
+
+void openblas_context_destroy(struct openblas_context *context){
+
+  int i;
+
+  if ((context == NULL) || (context == &blas_pool)) return;
+
+  pthread_once(&context_once, context_key_init);
+  if (pthread_getspecific(context_key) == context) pthread_setspecific(context_key, NULL);
+
+  for (i = 0; i < context -> num_threads - 1; i++) {
+
+    pthread_mutex_lock (&context -> status[i].lock);
+
+    atomic_store_queue(&context -> status[i].queue, (blas_queue_t *)-1);
+    context -> status[i].status = THREAD_STATUS_WAKEUP;
+    pthread_cond_signal (&context -> status[i].wakeup);
+
+    pthread_mutex_unlock(&context -> status[i].lock);
+  }
+
+  for (i = 0; i < context -> num_threads - 1; i++) {
+    pthread_join(context -> threads[i], NULL);
+    pthread_mutex_destroy(&context -> status[i].lock);
+    pthread_cond_destroy (&context -> status[i].wakeup);
+    if (context -> buffer[i] != NULL) blas_memory_free(context -> buffer[i]);
+  }
+
+  free(context -> buffer);
+  free(context -> threads);
+  free(context -> status);
+  free(context);
+}
+
+struct openblas_context *openblas_context_set_current(struct openblas_context *context){
+
+  struct openblas_context *previous;
+
+  pthread_once(&context_once, context_key_init);
+
+  previous = (struct openblas_context *)pthread_getspecific(context_key);
+  pthread_setspecific(context_key, context);
+
+  return previous;
+}
+
+struct openblas_context *openblas_context_get_current(void){
+
+  pthread_once(&context_once, context_key_init);
+
+  return (struct openblas_context *)pthread_getspecific(context_key);
+}
+
+int openblas_context_get_num_threads(struct openblas_context *context){
+
+  if (context == NULL) {
+    if (blas_cpu_number == 0) blas_get_cpu_number();
+    return blas_cpu_number;
+  }
+
+  return context -> num_threads;
+}
+
+/* Thread count of the calling thread's context, 0 for the default pool */
+int blas_context_num_threads(void){
+
+  struct openblas_context *pool = current_pool();
+
+  return (pool == &blas_pool) ? 0 : pool -> num_threads;
+}
+
+#ifdef OS_LINUX
+/* Binds the server threads of a context; the calling thread, which  */
+/* takes the first share of every call, keeps its own mask.          */
+int openblas_context_setaffinity(struct openblas_context *context, size_t cpusetsize, cpu_set_t *cpu_set){
+
+  int i, ret;
+
+  if (context == NULL) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  for (i = 0; i < context -> num_threads - 1; i++) {
+    ret = pthread_setaffinity_np(context -> threads[i], cpusetsize, cpu_set);
+    if (ret) return ret;
+    context -> status[i].capacity = blas_cpuset_capacity(cpusetsize, cpu_set);
+  }
+
+  return 0;
+}
+#endif
+
 static void adjust_thread_buffers() {
 
   int i=0;
+  /* With the NUMA mode of GEMM each thread maps its buffer itself on first
+     use, so that its packed A is on its own node */
+  int numa = openblas_get_numa_gemm();
 
   //adjust buffer for each thread
   for(i=0; i < blas_cpu_number; i++){
-    if(blas_thread_buffer[i] == NULL){
+    if(blas_thread_buffer[i] == NULL && !numa){
       blas_thread_buffer[i] = blas_memory_alloc(2);
     }
   }
@@ -1047,12 +1521,16 @@ static void adjust_thread_buffers() {
 }
 
 static void exec_threads(int cpu, blas_queue_t *queue, int buf_index) {
+  exec_pool_threads(&blas_pool, cpu, queue);
+}
+
+static void exec_pool_threads(struct openblas_context *pool, BLASLONG cpu, blas_queue_t *queue) {
 
   int (*routine)(blas_arg_t *, void *, void *, void *, void *, BLASLONG) = (int (*)(blas_arg_t *, void *, void *, void *, void *, BLASLONG))queue -> routine;
 
-  atomic_store_queue(&thread_status[cpu].queue, (blas_queue_t *)1);
+  atomic_store_queue(&pool -> status[cpu].queue, (blas_queue_t *)1);
 
-  void *buffer = blas_thread_buffer[cpu];
+  void *buffer = pool -> buffer[cpu];
   void *sa = queue -> sa;
   void *sb = queue -> sb;
 
@@ -1077,8 +1555,8 @@ fprintf(STDERR, "Server[%2ld] Calculation started.  Mode = 0x%03x M = %3ld N=%3l
 #endif
 
 if (buffer == NULL) {
-	blas_thread_buffer[cpu] = blas_memory_alloc(2);
-	buffer = blas_thread_buffer[cpu];
+	pool -> buffer[cpu] = blas_memory_alloc(2);
+	buffer = pool -> buffer[cpu];
 }      
 
 	
@@ -1158,7 +1636,7 @@ if (queue -> mode & BLAS_PTHREAD) {
     // arm: make sure all results are written out _before_
     // thread is marked as done and other threads use them
     MB;
-    atomic_store_queue(&thread_status[cpu].queue, (blas_queue_t *)0);
+    atomic_store_queue(&pool -> status[cpu].queue, (blas_queue_t *)0);
 
 }
 
@@ -0,0 +1,262 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Level 3 interfaces need one BUFFER_SIZE workspace per call. Instead of
+   taking it from the shared memory table (under alloc_lock) every time,
+   each calling thread keeps the buffer of its first call and reuses it
+   until the thread exits. Each kept buffer holds a slot of the memory
+   table, so only WORKSPACE_CACHED threads keep one; calls from further
+   threads take and return a buffer as before. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#if !defined(OS_WINDOWS) && (defined(SMP) || defined(USE_LOCKING))
+#define WORKSPACE_PER_THREAD
+#endif
+
+/* memory.c keeps a per-thread table when built with USE_TLS; that table
+   is released by its own key destructor, so a cached buffer must not be
+   handed back at thread exit */
+#if defined(USE_TLS) && defined(SMP) && (USE_TLS == 1)
+#define WORKSPACE_THREAD_TABLE
+#if defined(__GLIBC_PREREQ)
+#if !__GLIBC_PREREQ(2,20)
+#undef WORKSPACE_THREAD_TABLE
+#endif
+#endif
+#endif
+
+typedef struct workspace_s {
+  void *buffer;
+  int   busy;
+  int   generation;
+  volatile BLASULONG hits;
+  volatile BLASULONG misses;
+#ifdef WORKSPACE_PER_THREAD
+  struct workspace_s *prev, *next;
+#endif
+} workspace_t;
+
+#ifdef WORKSPACE_PER_THREAD
+
+/* Leave half of the memory table to other allocations */
+#ifndef WORKSPACE_CACHED
+#define WORKSPACE_CACHED (NUM_BUFFERS / 2)
+#endif
+
+static pthread_key_t   workspace_key;
+static pthread_once_t  workspace_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t workspace_lock = PTHREAD_MUTEX_INITIALIZER;
+static workspace_t    *workspace_list = NULL;
+static BLASULONG       retired_hits   = 0;
+static BLASULONG       retired_misses = 0;
+static int             workspace_cached = 0;
+
+/* Take one of the WORKSPACE_CACHED places, or give one back */
+static int workspace_reserve(void){
+
+  int ok;
+
+  pthread_mutex_lock(&workspace_lock);
+  ok = (workspace_cached < WORKSPACE_CACHED);
+  if (ok) workspace_cached ++;
+  pthread_mutex_unlock(&workspace_lock);
+
+  return ok;
+}
+
+static void workspace_unreserve(void){
+  pthread_mutex_lock(&workspace_lock);
+  workspace_cached --;
+  pthread_mutex_unlock(&workspace_lock);
+}
+
+static void workspace_release(void *ptr){
+
+  workspace_t *ws = (workspace_t *)ptr;
+
+#ifndef WORKSPACE_THREAD_TABLE
+  if (ws -> buffer && (ws -> generation == blas_memory_generation)) blas_memory_free(ws -> buffer);
+#endif
+
+  pthread_mutex_lock(&workspace_lock);
+  if (ws -> buffer) workspace_cached --;
+  if (ws -> prev) ws -> prev -> next = ws -> next;
+  else workspace_list = ws -> next;
+  if (ws -> next) ws -> next -> prev = ws -> prev;
+  retired_hits   += ws -> hits;
+  retired_misses += ws -> misses;
+  pthread_mutex_unlock(&workspace_lock);
+
+  free(ws);
+}
+
+static void workspace_init(void){
+  pthread_key_create(&workspace_key, workspace_release);
+}
+
+static workspace_t *workspace_get(void){
+
+  workspace_t *ws;
+
+  pthread_once(&workspace_once, workspace_init);
+
+  ws = (workspace_t *)pthread_getspecific(workspace_key);
+  if (ws) return ws;
+
+  ws = (workspace_t *)calloc(1, sizeof(workspace_t));
+  if (ws == NULL) return NULL;
+
+  if (pthread_setspecific(workspace_key, ws)) {
+    free(ws);
+    return NULL;
+  }
+
+  pthread_mutex_lock(&workspace_lock);
+  ws -> next = workspace_list;
+  if (workspace_list) workspace_list -> prev = ws;
+  workspace_list = ws;
+  pthread_mutex_unlock(&workspace_lock);
+
+  return ws;
+}
+
+#elif !defined(OS_WINDOWS)
+
+/* Sequential library without USE_LOCKING: there is only one caller */
+static workspace_t workspace;
+
+static workspace_t *workspace_get(void){
+  return &workspace;
+}
+
+#define workspace_reserve()   1
+#define workspace_unreserve()
+
+#else
+
+/* No thread exit hook is used on Windows, so buffers are not cached there */
+static volatile BLASULONG workspace_misses = 0;
+
+static workspace_t *workspace_get(void){
+  workspace_misses ++;
+  return NULL;
+}
+
+#define workspace_reserve()   1
+#define workspace_unreserve()
+
+#endif
+
+void *blas_workspace_alloc(void){
+
+  workspace_t *ws = workspace_get();
+
+  if (ws == NULL) return blas_memory_alloc(0);
+
+  if (ws -> busy) {
+    ws -> misses ++;
+    return blas_memory_alloc(0);
+  }
+
+  /* blas_shutdown() has released everything the cached buffer came from */
+  if (ws -> buffer && (ws -> generation != blas_memory_generation)) {
+    ws -> buffer = NULL;
+    workspace_unreserve();
+  }
+
+  if (ws -> buffer) {
+    ws -> hits ++;
+  } else {
+    ws -> misses ++;
+    /* Enough threads keep a buffer already: lend one for this call only */
+    if (!workspace_reserve()) return blas_memory_alloc(0);
+    ws -> generation = blas_memory_generation;
+    ws -> buffer     = blas_memory_alloc(0);
+    if (ws -> buffer == NULL) {
+      workspace_unreserve();
+      return NULL;
+    }
+  }
+
+  ws -> busy = 1;
+
+  return ws -> buffer;
+}
+
+void blas_workspace_free(void *buffer){
+
+#ifdef WORKSPACE_PER_THREAD
+  workspace_t *ws = (workspace_t *)pthread_getspecific(workspace_key);
+#elif !defined(OS_WINDOWS)
+  workspace_t *ws = &workspace;
+#else
+  workspace_t *ws = NULL;
+#endif
+
+  if (ws && ws -> busy && (ws -> buffer == buffer)) {
+    ws -> busy = 0;
+    return;
+  }
+
+  blas_memory_free(buffer);
+}
+
+void openblas_get_workspace_stats(size_t *hits, size_t *misses){
+
+  BLASULONG h = 0, m = 0;
+
+#ifdef WORKSPACE_PER_THREAD
+  workspace_t *ws;
+
+  pthread_mutex_lock(&workspace_lock);
+  h = retired_hits;
+  m = retired_misses;
+  for (ws = workspace_list; ws; ws = ws -> next) {
+    h += ws -> hits;
+    m += ws -> misses;
+  }
+  pthread_mutex_unlock(&workspace_lock);
+#elif !defined(OS_WINDOWS)
+  h = workspace.hits;
+  m = workspace.misses;
+#else
+  m = workspace_misses;
+#endif
+
+  if (hits)   *hits   = (size_t)h;
+  if (misses) *misses = (size_t)m;
+}
@@ -759,6 +759,36 @@ int get_node_equal(void) {
 
 }
 
+/* Lists the nodes the BLAS threads are bound to, in the order of the  */
+/* thread positions (the caller is position 0), with the number of     */
+/* threads on each. Returns the number of nodes, 0 if unbound.         */
+int get_node_threads(int *node, int *threads, int max) {
+
+  int pos, num, mynode, i, count = 0;
+
+  if (disable_mapping) return 0;
+
+  num = blas_cpu_number;
+  if (num > numprocs) num = numprocs;
+
+  for (pos = 0; pos < num; pos ++) {
+    mynode = READ_NODE(common -> cpu_info[cpu_sub_mapping[pos]]);
+
+    for (i = 0; i < count; i ++) if (node[i] == mynode) break;
+
+    if (i == count) {
+      if (count == max) continue;
+      node[count] = mynode;
+      threads[count] = 0;
+      count ++;
+    }
+
+    threads[i] ++;
+  }
+
+  return count;
+}
+
 int gotoblas_set_affinity(int pos) {
 
   cpu_set_t cpu_mask;
@@ -1028,6 +1058,8 @@ int get_num_procs(void) { int num = sysconf(_SC_NPROCESSORS_CONF); return (nums
 
 int get_num_nodes(void) { return 1; }
 
+int get_node_threads(int *node, int *threads, int max) { return 0; }
+
 int get_node(void) { return 1;}
 #endif
 
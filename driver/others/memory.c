@@ -73,7 +73,6 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "common.h"
 
-#define NEW_BUFFERS 512
 #ifndef likely
 #ifdef __GNUC__
 #define likely(x) __builtin_expect(!!(x), 1)
@@ -122,6 +121,9 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #warning BUFFER_SIZE is too small for P, Q, and R of ZGEMM - large calculations may crash !
 #endif
 
+/* Bumped by blas_shutdown() so that buffers cached by blas_workspace_alloc() are not reused */
+volatile int blas_memory_generation = 0;
+
 #if defined(COMPILE_TLS)
 
 #include <errno.h>
@@ -642,6 +644,25 @@ static void alloc_mmap_free(struct alloc_t *alloc_info){
   }
 }
 
+/* The mapped length is kept in attr as a number of 2MB pages */
+static void alloc_hugepage_free(struct alloc_t *alloc_info){
+
+  blas_hugepage_unmap(alloc_info, (BLASULONG)alloc_info -> attr << 21);
+}
+
+static void *alloc_hugepage(void){
+  void *map_address;
+  BLASULONG mapped;
+  int attr;
+
+  map_address = blas_hugepage_map(allocation_block_size, blas_memory_node(), &mapped);
+
+  attr = (int)(mapped >> 21);
+  STORE_RELEASE_FUNC_WITH_ATTR(map_address, alloc_hugepage_free, attr);
+
+  return map_address;
+}
+
 
 
 #ifdef NO_WARMUP
@@ -1263,12 +1284,18 @@ UNLOCK_COMMAND(&alloc_lock);
 
       map_address = (void *)-1;
 
+#ifdef ALLOC_MMAP
+      map_address = alloc_hugepage();
+#endif
+
       func = &memoryalloc[0];
 
       while ((*func != NULL) && (map_address == (void *) -1)) {
 
         map_address = (*func)((void *)base_address);
 
+        if (map_address != (void *)-1) blas_hugepage_account(OPENBLAS_HUGEPAGES_NONE);
+
 #ifdef ALLOC_DEVICEDRIVER
         if ((*func ==  alloc_devicedirver) && (map_address == (void *)-1)) {
             fprintf(stderr, "OpenBLAS Warning ... Physically contiguous allocation failed.\n");
@@ -1384,6 +1411,8 @@ void blas_shutdown(void){
 #endif
     blas_thread_memory_cleanup();
 
+  blas_memory_generation ++;
+
 #ifdef SEEK_ADDRESS
   base_address      = 0UL;
 #else
@@ -1504,6 +1533,9 @@ static void gotoblas_memory_init(void) {
 
 static int gotoblas_initialized = 0;
 extern void openblas_read_env(void);
+#ifdef DYNAMIC_ARCH
+extern void blas_autotune_init(void);
+#endif
 
 void CONSTRUCTOR gotoblas_init(void) {
 
@@ -1531,6 +1563,10 @@ void CONSTRUCTOR gotoblas_init(void) {
    gotoblas_memory_init();
 #endif
 
+#ifdef DYNAMIC_ARCH
+   blas_autotune_init();
+#endif
+
 //#if defined(OS_LINUX)
 #if 0
    struct rlimit curlimit;
@@ -1716,6 +1752,7 @@ inline int atoi(const char *str) { return 0; }
 #include <stdlib.h>
 #include <stdio.h>
 #include <fcntl.h>
+#include <time.h>
 
 #if (!defined(OS_WINDOWS) || defined(OS_CYGWIN_NT)) && !defined(OS_EMBEDDED)
 #include <sys/mman.h>
@@ -2097,9 +2134,6 @@ struct release_t {
 
 int hugetlb_allocated = 0;
 
-static struct release_t release_info[NUM_BUFFERS];
-static struct release_t *new_release_info;
-static int release_pos = 0;
 
 #if defined(OS_LINUX) && !defined(NO_WARMUP)
 static int hot_alloc = 0;
@@ -2128,11 +2162,33 @@ if (!release->address) return;
   }
 }
 
+static void alloc_hugepage_free(struct release_t *release){
+
+  blas_hugepage_unmap(release -> address, release -> attr);
+}
+
+/* Maps the buffer with the huge page backend selected at run time, if any,
+   preferably on the NUMA node node */
+static void *alloc_hugepage(int node, struct release_t *release){
+  void *map_address;
+  BLASULONG mapped;
+
+  map_address = blas_hugepage_map(BUFFER_SIZE, node, &mapped);
+
+  if (map_address != (void *)-1) {
+    release -> address = map_address;
+    release -> attr    = mapped;
+    release -> func    = alloc_hugepage_free;
+  }
+
+  return map_address;
+}
+
 
 
 #ifdef NO_WARMUP
 
-static void *alloc_mmap(void *address){
+static void *alloc_mmap(void *address, struct release_t *release){
   void *map_address;
 
   if (address){
@@ -2146,20 +2202,8 @@ static void *alloc_mmap(void *address){
   }
 
   if (map_address != (void *)-1) {
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    LOCK_COMMAND(&alloc_lock);
-#endif
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_mmap_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_mmap_free;
-    }
-    release_pos ++;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    UNLOCK_COMMAND(&alloc_lock);
-#endif
+    release -> address = map_address;
+    release -> func    = alloc_mmap_free;
   } else {
 #ifdef DEBUG
         int errsv=errno;
@@ -2215,7 +2259,7 @@ static inline BLASULONG run_bench(BLASULONG address, BLASULONG size) {
   return min;
 }
 
-static void *alloc_mmap(void *address){
+static void *alloc_mmap(void *address, struct release_t *release){
   void *map_address, *best_address;
   BLASULONG best, start, current;
   BLASULONG allocsize;
@@ -2315,20 +2359,8 @@ static void *alloc_mmap(void *address){
 #endif
 
   if (map_address != (void *)-1) {
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    LOCK_COMMAND(&alloc_lock);
-#endif
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_mmap_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_mmap_free;
-    }
-    release_pos ++;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    UNLOCK_COMMAND(&alloc_lock);
-#endif
+    release -> address = map_address;
+    release -> func    = alloc_mmap_free;
   }
 
   return map_address;
@@ -2347,7 +2379,7 @@ static void alloc_malloc_free(struct release_t *release){
 
 }
 
-static void *alloc_malloc(void *address){
+static void *alloc_malloc(void *address, struct release_t *release){
 
   void *map_address;
 
@@ -2356,14 +2388,8 @@ static void *alloc_malloc(void *address){
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
   if (map_address != (void *)-1) {
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_malloc_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_malloc_free;
-    }
-    release_pos ++;
+    release -> address = map_address;
+    release -> func    = alloc_malloc_free;
   }
 
   return map_address;
@@ -2387,7 +2413,7 @@ static void alloc_qalloc_free(struct release_t *release){
 
 }
 
-static void *alloc_qalloc(void *address){
+static void *alloc_qalloc(void *address, struct release_t *release){
   void *map_address;
 
   map_address = (void *)qalloc(QCOMMS | QFAST, BUFFER_SIZE + FIXED_PAGESIZE);
@@ -2395,14 +2421,8 @@ static void *alloc_qalloc(void *address){
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
   if (map_address != (void *)-1) {
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_qalloc_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_qalloc_free;
-    }
-    release_pos ++;
+    release -> address = map_address;
+    release -> func    = alloc_qalloc_free;
   }
 
   return (void *)(((BLASULONG)map_address + FIXED_PAGESIZE - 1) & ~(FIXED_PAGESIZE - 1));
@@ -2418,7 +2438,7 @@ static void alloc_windows_free(struct release_t *release){
 
 }
 
-static void *alloc_windows(void *address){
+static void *alloc_windows(void *address, struct release_t *release){
   void *map_address;
 
   map_address  = VirtualAlloc(address,
@@ -2429,14 +2449,8 @@ static void *alloc_windows(void *address){
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
   if (map_address != (void *)-1) {
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_windows_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_windows_free;
-    }
-    release_pos ++;
+    release -> address = map_address;
+    release -> func    = alloc_windows_free;
   }
 
   return map_address;
@@ -2461,7 +2475,7 @@ static void alloc_devicedirver_free(struct release_t *release){
 
 }
 
-static void *alloc_devicedirver(void *address){
+static void *alloc_devicedirver(void *address, struct release_t *release){
 
   int fd;
   void *map_address;
@@ -2478,16 +2492,9 @@ static void *alloc_devicedirver(void *address){
                      fd, 0);
 
   if (map_address != (void *)-1) {
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].attr    = fd;
-    release_info[release_pos].func    = alloc_devicedirver_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].attr    = fd;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_devicedirver_free;
-    }
-    release_pos ++;
+    release -> address = map_address;
+    release -> attr    = fd;
+    release -> func    = alloc_devicedirver_free;
   }
 
   return map_address;
@@ -2504,7 +2511,7 @@ static void alloc_shm_free(struct release_t *release){
     }
 }
 
-static void *alloc_shm(void *address){
+static void *alloc_shm(void *address, struct release_t *release){
   void *map_address;
   int shmid;
 #ifdef DEBUG
@@ -2521,17 +2528,9 @@ static void *alloc_shm(void *address){
 #endif
 
     shmctl(shmid, IPC_RMID, 0);
-
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].attr    = shmid;
-    release_info[release_pos].func    = alloc_shm_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].attr    = shmid;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_shm_free;
-    }
-    release_pos ++;
+    release -> address = map_address;
+    release -> attr    = shmid;
+    release -> func    = alloc_shm_free;
   }
 
   return map_address;
@@ -2562,7 +2561,7 @@ static void alloc_hugetlb_free(struct release_t *release){
 
 }
 
-static void *alloc_hugetlb(void *address){
+static void *alloc_hugetlb(void *address, struct release_t *release){
 
   void *map_address = (void *)-1;
 
@@ -2639,14 +2638,8 @@ fprintf(stderr,"alloc_hugetlb got called\n");
 #endif
 
   if (map_address != (void *)-1){
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_hugetlb_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_hugetlb_free;
-    }
-    release_pos ++;
+    release -> address = map_address;
+    release -> func    = alloc_hugetlb_free;
   }
 
   return map_address;
@@ -2669,7 +2662,7 @@ static void alloc_hugetlbfile_free(struct release_t *release){
   }
 }
 
-static void *alloc_hugetlbfile(void *address){
+static void *alloc_hugetlbfile(void *address, struct release_t *release){
 
   void *map_address = (void *)-1;
   int fd;
@@ -2691,16 +2684,9 @@ static void *alloc_hugetlbfile(void *address){
                      fd, 0);
 
   if (map_address != (void *)-1) {
-    if (likely(release_pos < NUM_BUFFERS)) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].attr    = fd;
-    release_info[release_pos].func    = alloc_hugetlbfile_free;
-    } else {
-    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
-    new_release_info[release_pos-NUM_BUFFERS].attr    = fd;
-    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_hugetlbfile_free;
-    }
-    release_pos ++;
+    release -> address = map_address;
+    release -> attr    = fd;
+    release -> func    = alloc_hugetlbfile_free;
   }
 
   return map_address;
@@ -2714,40 +2700,134 @@ static BLASULONG base_address      = 0UL;
 static BLASULONG base_address      = BASE_ADDRESS;
 #endif
 
-static volatile struct {
-  BLASULONG lock;
-  void *addr;
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-  int   pos;
+/* The buffer table is a list of chunks of NUM_BUFFERS slots. The first
+   chunk is static; when every slot is taken another one is appended, so
+   the number of buffers does not depend on NUM_THREADS. Chunks are only
+   freed by blas_shutdown(), which lets threads walk the list without a
+   lock. A slot is claimed by swapping used from 0 to 1 and given back by
+   clearing it; the buffers of appended chunks are unmapped again once
+   they have been idle for MEMORY_IDLE_SECONDS. */
+
+#ifndef MEMORY_IDLE_SECONDS
+#define MEMORY_IDLE_SECONDS 10
 #endif
-  int used;
+
+struct memory_slot {
+  volatile BLASULONG used;
+  void * volatile addr;
+  struct release_t release;
+  BLASLONG idle;
+  int node;
 #ifndef __64BIT__
-  char dummy[48];
+  char dummy[36];
 #else
-  char dummy[40];
+  char dummy[8];
 #endif
+};
+
+struct memory_chunk {
+  struct memory_slot slot[NUM_BUFFERS];
+  struct memory_chunk * volatile next;
+};
 
-} memory[NUM_BUFFERS];
+static struct memory_chunk memory_table;
+static BLASULONG memory_grow_lock = 0UL;
+static volatile BLASULONG memory_shrinking = 0UL;
+static volatile BLASLONG memory_shrink_time = 0;
 
-struct newmemstruct 
-{
-  BLASULONG lock;
-  void *addr;
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-  int   pos;
+#if !defined(__GNUC__)
+static BLASULONG memory_claim_lock = 0UL;
 #endif
-  int used;
-#ifndef __64BIT__
-  char dummy[48];
+
+static volatile int memory_initialized = 0;
+
+static inline int memory_cas(volatile BLASULONG *address, BLASULONG old, BLASULONG new){
+#if defined(__GNUC__)
+  return __sync_bool_compare_and_swap(address, old, new);
 #else
-  char dummy[40];
+  int ret;
+
+  blas_lock(&memory_claim_lock);
+  ret = (*address == old);
+  if (ret) *address = new;
+  blas_unlock(&memory_claim_lock);
+
+  return ret;
 #endif
+}
 
-};
-static volatile struct newmemstruct *newmemory;
+/* Each NUMA node has its own pool: the first pass only takes a free
+   buffer mapped on the caller's node (or an unmapped slot), the second
+   one any free buffer */
+static struct memory_slot *memory_claim(int node){
+
+  struct memory_chunk *chunk, *last;
+  struct memory_slot *slot;
+  int pass, i;
+
+  for (pass = 0; pass < 2; pass ++) {
+    for (chunk = &memory_table; chunk; chunk = chunk -> next) {
+      for (i = 0; i < NUM_BUFFERS; i ++) {
+        slot = &chunk -> slot[i];
+        if (slot -> used) continue;
+        if (!pass && slot -> addr && (slot -> node != node)) continue;
+        if (memory_cas(&slot -> used, 0, 1)) return slot;
+      }
+    }
+  }
+
+  chunk = (struct memory_chunk *)calloc(1, sizeof(struct memory_chunk));
+  if (chunk == NULL) return NULL;
+
+  slot = &chunk -> slot[0];
+  slot -> used = 1;
+
+  blas_lock(&memory_grow_lock);
+  for (last = &memory_table; last -> next; last = last -> next);
+  WMB;
+  last -> next = chunk;
+  blas_unlock(&memory_grow_lock);
+
+  return slot;
+}
+
+/* Unmaps the buffers of appended chunks that nobody has claimed for
+   MEMORY_IDLE_SECONDS. Only one thread sweeps at a time, at most once
+   per MEMORY_IDLE_SECONDS. */
+static void memory_shrink(BLASLONG now){
+
+  struct memory_chunk *chunk;
+  struct memory_slot *slot;
+  int i;
+
+  if (now - memory_shrink_time < MEMORY_IDLE_SECONDS) return;
+  if (!memory_cas(&memory_shrinking, 0, 1)) return;
+
+  memory_shrink_time = now;
+
+  for (chunk = memory_table.next; chunk; chunk = chunk -> next) {
+    for (i = 0; i < NUM_BUFFERS; i ++) {
+      slot = &chunk -> slot[i];
+      if (slot -> used || !slot -> addr || (now - slot -> idle < MEMORY_IDLE_SECONDS)) continue;
+      if (!memory_cas(&slot -> used, 0, 1)) continue;
+
+      /* The address is dropped before the unmap, so that blas_memory_free */
+      /* can not match this slot to a new mapping at the same address      */
+      if (slot -> addr && (now - slot -> idle >= MEMORY_IDLE_SECONDS)) {
+        slot -> addr = (void *)0;
+        WMB;
+        slot -> release.func(&slot -> release);
+      }
+
+      WMB;
+      slot -> used = 0;
+    }
+  }
+
+  WMB;
+  memory_shrinking = 0;
+}
 
-static volatile int memory_initialized = 0;
-static int memory_overflowed = 0;
 /*       Memory allocation routine           */
 /* procpos ... indicates where it comes from */
 /*                0 : Level 3 functions      */
@@ -2756,16 +2836,12 @@ static int memory_overflowed = 0;
 
 void *blas_memory_alloc(int procpos){
 
-  int i;
-  
-  int position;
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-  int mypos = 0;
-#endif
+  struct memory_slot *slot;
+  int mynode;
 
   void *map_address;
 
-  void *(*memoryalloc[])(void *address) = {
+  void *(*memoryalloc[])(void *address, struct release_t *release) = {
 #ifdef ALLOC_DEVICEDRIVER
     alloc_devicedirver,
 #endif
@@ -2789,7 +2865,7 @@ void *blas_memory_alloc(int procpos){
 #endif
     NULL,
   };
-  void *(**func)(void *address);
+  void *(**func)(void *address, struct release_t *release);
 
   if (!memory_initialized) {
 #if defined(SMP) && !defined(USE_OPENMP)
@@ -2797,15 +2873,6 @@ void *blas_memory_alloc(int procpos){
     if (!memory_initialized) {
 #endif
 
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-    for (position = 0; position < NUM_BUFFERS; position ++){
-      memory[position].addr   = (void *)0;
-      memory[position].pos    = -1;
-      memory[position].used   = 0;
-      memory[position].lock   = 0;
-    }
-#endif
-
 #ifdef DYNAMIC_ARCH
     gotoblas_dynamic_init();
 #endif
@@ -2836,92 +2903,18 @@ void *blas_memory_alloc(int procpos){
   printf("Alloc Start ...\n");
 #endif
 
-/* #if defined(WHEREAMI) && !defined(USE_OPENMP)
-
-  mypos = WhereAmI();
-
-  position = mypos;
-  while (position >= NUM_BUFFERS) position >>= 1;
-
-  do {
-    if (!memory[position].used && (memory[position].pos == mypos)) {
-#if defined(SMP) && !defined(USE_OPENMP)
-      LOCK_COMMAND(&alloc_lock);
-#else
-      blas_lock(&memory[position].lock);
-#endif
-      if (!memory[position].used) goto allocation;
-#if defined(SMP) && !defined(USE_OPENMP)
-      UNLOCK_COMMAND(&alloc_lock);
-#else
-      blas_unlock(&memory[position].lock);
-#endif
-    }
-
-    position ++;
-
-  } while (position < NUM_BUFFERS);
-
-
-#endif */
-
-  position = 0;
-
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  LOCK_COMMAND(&alloc_lock);
-#endif
-  do {
-    RMB;
-#if defined(USE_OPENMP)
-    if (!memory[position].used) {
-      blas_lock(&memory[position].lock);
-#endif
-      if (!memory[position].used) goto allocation;
-
-#if defined(USE_OPENMP)
-      blas_unlock(&memory[position].lock);
-    }
-#endif
-    position ++;
-
-  } while (position < NUM_BUFFERS);
-
-  if (memory_overflowed) {
+  mynode = blas_memory_node();
 
-    do {
-      RMB;
-#if defined(USE_OPENMP)
-      if (!newmemory[position-NUM_BUFFERS].used) {
-        blas_lock(&newmemory[position-NUM_BUFFERS].lock);
-#endif
-        if (!newmemory[position-NUM_BUFFERS].used) goto allocation2;
-
-#if defined(USE_OPENMP)
-        blas_unlock(&newmemory[position-NUM_BUFFERS].lock);
-      }
-#endif
-      position ++;
+  slot = memory_claim(mynode);
 
-    } while (position < NEW_BUFFERS + NUM_BUFFERS);
+  /* the callers do not check for NULL, so running out of memory for the
+     table itself ends the program as the message says */
+  if (slot == NULL) {
+    fprintf(stderr, "OpenBLAS : Program is Terminated. Because the buffer table could not be extended.\n");
+    exit(EXIT_FAILURE);
   }
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  UNLOCK_COMMAND(&alloc_lock);
-#endif
-  goto error;
 
-  allocation :
-
-#ifdef DEBUG
-  printf("  Position -> %d\n", position);
-#endif
-
-  memory[position].used = 1;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  UNLOCK_COMMAND(&alloc_lock);
-#else
-  blas_unlock(&memory[position].lock);
-#endif
-  if (!memory[position].addr) {
+  if (!slot -> addr) {
     do {
 #ifdef DEBUG
       printf("Allocation Start : %lx\n", base_address);
@@ -2929,11 +2922,17 @@ void *blas_memory_alloc(int procpos){
 
       map_address = (void *)-1;
 
+#ifdef ALLOC_MMAP
+      map_address = alloc_hugepage(mynode, &slot -> release);
+#endif
+
       func = &memoryalloc[0];
 
       while ((*func != NULL) && (map_address == (void *) -1)) {
 
-        map_address = (*func)((void *)base_address);
+        map_address = (*func)((void *)base_address, &slot -> release);
+
+        if (map_address != (void *)-1) blas_hugepage_account(OPENBLAS_HUGEPAGES_NONE);
 
 #ifdef ALLOC_DEVICEDRIVER
         if ((*func ==  alloc_devicedirver) && (map_address == (void *)-1)) {
@@ -2979,25 +2978,14 @@ void *blas_memory_alloc(int procpos){
 
     } while ((BLASLONG)map_address == -1);
 
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    LOCK_COMMAND(&alloc_lock);
-#endif
-    memory[position].addr = map_address;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    UNLOCK_COMMAND(&alloc_lock);
-#endif
+    slot -> node = mynode;
+    slot -> addr = map_address;
 
 #ifdef DEBUG
-    printf("  Mapping Succeeded. %p(%d)\n", (void *)memory[position].addr, position);
+    printf("  Mapping Succeeded. %p\n", (void *)slot -> addr);
 #endif
   }
 
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-
-  if (memory[position].pos == -1) memory[position].pos = mypos;
-
-#endif
-
 #ifdef DYNAMIC_ARCH
 
   if (memory_initialized == 1) {
@@ -3018,190 +3006,46 @@ void *blas_memory_alloc(int procpos){
 
 
 #ifdef DEBUG
-  printf("Mapped   : %p  %3d\n\n",
-          (void *)memory[position].addr, position);
-#endif
-
-  return (void *)memory[position].addr;
-
- error:
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  LOCK_COMMAND(&alloc_lock);
-#endif
- if (memory_overflowed) goto terminate;
-  fprintf(stderr,"OpenBLAS warning: precompiled NUM_THREADS exceeded, adding auxiliary array for thread metadata.\n");
-  fprintf(stderr,"To avoid this warning, please rebuild your copy of OpenBLAS with a larger NUM_THREADS setting\n");
-  fprintf(stderr,"or set the environment variable OPENBLAS_NUM_THREADS to %d or lower\n", MAX_CPU_NUMBER);
-  memory_overflowed=1;
-  MB;
-  new_release_info = (struct release_t*) malloc(NEW_BUFFERS * sizeof(struct release_t));
-  newmemory = (struct newmemstruct*) malloc(NEW_BUFFERS * sizeof(struct newmemstruct));
-  for (i = 0; i < NEW_BUFFERS; i++) {
-  newmemory[i].addr   = (void *)0;
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-  newmemory[i].pos    = -1;
-#endif
-  newmemory[i].used   = 0;
-  newmemory[i].lock   = 0;
-}
-  
-allocation2:
-  newmemory[position-NUM_BUFFERS].used = 1;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  UNLOCK_COMMAND(&alloc_lock);
-#else
-  blas_unlock(&newmemory[position-NUM_BUFFERS].lock);
-#endif
-    do {
-#ifdef DEBUG
-      printf("Allocation Start : %lx\n", base_address);
-#endif
-
-      map_address = (void *)-1;
-
-      func = &memoryalloc[0];
-
-      while ((*func != NULL) && (map_address == (void *) -1)) {
-
-        map_address = (*func)((void *)base_address);
-
-#ifdef ALLOC_DEVICEDRIVER
-        if ((*func ==  alloc_devicedirver) && (map_address == (void *)-1)) {
-            fprintf(stderr, "OpenBLAS Warning ... Physically contiguous allocation was failed.\n");
-        }
-#endif
-
-#ifdef ALLOC_HUGETLBFILE
-        if ((*func == alloc_hugetlbfile) && (map_address == (void *)-1)) {
-#ifndef OS_WINDOWS
-            fprintf(stderr, "OpenBLAS Warning ... HugeTLB(File) allocation was failed.\n");
-#endif
-        }
-#endif
-
-#if (defined ALLOC_HUGETLB) && (defined OS_LINUX  || defined OS_AIX  || defined __sun__  || defined OS_WINDOWS)
-#ifdef DEBUG
-	fprintf(stderr,"OpenBLAS: allocating via shared memory with large page support (hugetlb)\n");
-#endif
-        if ((*func == alloc_hugetlb) && (map_address != (void *)-1)) hugetlb_allocated = 1;
-#endif
-
-#if (defined ALLOC_SHM) && (defined OS_LINUX  || defined OS_AIX  || defined __sun__  || defined OS_WINDOWS)
-#ifdef DEBUG
-	fprintf(stderr,"allocating via shared memory\n");
-#endif
-        if ((*func == alloc_shm) && (map_address == (void *)-1)) {
-#ifndef OS_WINDOWS
-            fprintf(stderr, "OpenBLAS Warning ... shared memory allocation was failed.\n");
-#endif
-	}
-#endif
-        func ++;
-      }
-
-#ifdef DEBUG
-      printf("  Success -> %08lx\n", map_address);
-#endif
-      if (((BLASLONG) map_address) == -1) base_address = 0UL;
-
-      if (base_address) base_address += BUFFER_SIZE + FIXED_PAGESIZE;
-
-    } while ((BLASLONG)map_address == -1);
-
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    LOCK_COMMAND(&alloc_lock);
-#endif
-    newmemory[position-NUM_BUFFERS].addr = map_address;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    UNLOCK_COMMAND(&alloc_lock);
-#endif
-
-#ifdef DEBUG
-    printf("  Mapping Succeeded. %p(%d)\n", (void *)newmemory[position-NUM_BUFFERS].addr, position);
-#endif
-
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-
-  if (newmemory[position-NUM_BUFFERS].pos == -1) newmemory[position-NUM_BUFFERS].pos = mypos;
-
+  printf("Mapped   : %p\n\n", (void *)slot -> addr);
 #endif
-  return (void *)newmemory[position-NUM_BUFFERS].addr;
 
-terminate:
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-    UNLOCK_COMMAND(&alloc_lock);
-#endif
-  printf("OpenBLAS : Program is Terminated. Because you tried to allocate too many memory regions.\n");
-  printf("This library was built to support a maximum of %d threads - either rebuild OpenBLAS\n", NUM_BUFFERS);
-  printf("with a larger NUM_THREADS value or set the environment variable OPENBLAS_NUM_THREADS to\n");
-  printf("a sufficiently small number. This error typically occurs when the software that relies on\n");
-  printf("OpenBLAS calls BLAS functions from many threads in parallel, or when your computer has more\n");
-  printf("cpu cores than what OpenBLAS was configured to handle.\n"); 
-  return NULL;
+  return (void *)slot -> addr;
 }
 
 void blas_memory_free(void *free_area){
 
-  int position;
+  struct memory_chunk *chunk;
+  struct memory_slot *slot;
+  BLASLONG now = 0;
+  int i;
 
 #ifdef DEBUG
   printf("Unmapped Start : %p ...\n", free_area);
 #endif
 
-  position = 0;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  LOCK_COMMAND(&alloc_lock);
-#endif
-  while ((position < NUM_BUFFERS) && (memory[position].addr != free_area))
-    position++;
+  for (chunk = &memory_table; chunk; chunk = chunk -> next) {
+    for (i = 0; i < NUM_BUFFERS; i ++) {
+      slot = &chunk -> slot[i];
+      if ((slot -> addr != free_area) || !slot -> used) continue;
 
-  if (position >= NUM_BUFFERS && !memory_overflowed) goto error;
+      if (memory_table.next) now = (BLASLONG)time(NULL);
+      slot -> idle = now;
 
-#ifdef DEBUG
-  if (memory[position].addr != free_area) goto error;
-  printf("  Position : %d\n", position);
-#endif
-  if (unlikely(memory_overflowed && position >= NUM_BUFFERS)) {
-    while ((position < NUM_BUFFERS+NEW_BUFFERS) && (newmemory[position-NUM_BUFFERS].addr != free_area))
-      position++;
-  // arm: ensure all writes are finished before other thread takes this memory
-  WMB;
-if (position - NUM_BUFFERS >= NEW_BUFFERS) goto error;
-  newmemory[position-NUM_BUFFERS].used = 0;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  UNLOCK_COMMAND(&alloc_lock);
-#endif
+      // arm: ensure all writes are finished before other thread takes this memory
+      WMB;
 
-#ifdef DEBUG
-  printf("Unmap from overflow area succeeded.\n\n");
-#endif
-  return;
-} else {
-  // arm: ensure all writes are finished before other thread takes this memory
-  WMB;
+      slot -> used = 0;
 
-  memory[position].used = 0;
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  UNLOCK_COMMAND(&alloc_lock);
-#endif
+      if (memory_table.next) memory_shrink(now);
 
 #ifdef DEBUG
-  printf("Unmap Succeeded.\n\n");
+      printf("Unmap Succeeded.\n\n");
 #endif
+      return;
+    }
+  }
 
-  return;
-}
- error:
-  printf("BLAS : Bad memory unallocation! : %4d  %p\n", position,  free_area);
-
-#ifdef DEBUG
-  for (position = 0; position < NUM_BUFFERS; position++)
-    printf("%4ld  %p : %d\n", position, memory[position].addr, memory[position].used);
-#endif
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
-  UNLOCK_COMMAND(&alloc_lock);
-#endif
-  return;
+  printf("BLAS : Bad memory unallocation! : %p\n", free_area);
 }
 
 void *blas_memory_alloc_nolock(int unused) {
@@ -3216,6 +3060,8 @@ void blas_memory_free_nolock(void * map_address) {
 
 void blas_shutdown(void){
 
+  struct memory_chunk *chunk, *next;
+  struct memory_slot *slot;
   int pos;
 
 #ifdef SMP
@@ -3224,11 +3070,21 @@ void blas_shutdown(void){
 
   LOCK_COMMAND(&alloc_lock);
 
-  for (pos = 0; pos < release_pos; pos ++) {
-    if (likely(pos < NUM_BUFFERS))
-    release_info[pos].func(&release_info[pos]);
-    else
-    new_release_info[pos-NUM_BUFFERS].func(&new_release_info[pos-NUM_BUFFERS]);
+  for (chunk = &memory_table; chunk; chunk = chunk -> next) {
+    for (pos = 0; pos < NUM_BUFFERS; pos ++) {
+      slot = &chunk -> slot[pos];
+      if (slot -> addr) slot -> release.func(&slot -> release);
+      slot -> addr = (void *)0;
+      slot -> used = 0;
+    }
+  }
+
+  chunk = memory_table.next;
+  memory_table.next = NULL;
+  while (chunk) {
+    next = chunk -> next;
+    free(chunk);
+    chunk = next;
   }
 
 #ifdef SEEK_ADDRESS
@@ -3237,27 +3093,7 @@ void blas_shutdown(void){
   base_address      = BASE_ADDRESS;
 #endif
 
-  for (pos = 0; pos < NUM_BUFFERS; pos ++){
-    memory[pos].addr   = (void *)0;
-    memory[pos].used   = 0;
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-    memory[pos].pos    = -1;
-#endif
-    memory[pos].lock   = 0;
-  }
-  if (memory_overflowed) {
-    for (pos = 0; pos < NEW_BUFFERS; pos ++){
-      newmemory[pos].addr   = (void *)0;
-      newmemory[pos].used   = 0;
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-      newmemory[pos].pos    = -1;
-#endif
-      newmemory[pos].lock   = 0;
-    }
-    free(newmemory);
-    newmemory = NULL;
-    memory_overflowed = 0;  
-  }
+  blas_memory_generation ++;
 
   UNLOCK_COMMAND(&alloc_lock);
 
@@ -3375,6 +3211,9 @@ static void gotoblas_memory_init(void) {
 
 static int gotoblas_initialized = 0;
 extern void openblas_read_env(void);
+#ifdef DYNAMIC_ARCH
+extern void blas_autotune_init(void);
+#endif
 
 void CONSTRUCTOR gotoblas_init(void) {
 
@@ -3402,6 +3241,10 @@ void CONSTRUCTOR gotoblas_init(void) {
    gotoblas_memory_init();
 #endif
 
+#ifdef DYNAMIC_ARCH
+   blas_autotune_init();
+#endif
+
 //#if defined(OS_LINUX)
 #if 0
   struct rlimit curlimit;
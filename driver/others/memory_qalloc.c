@@ -65,6 +65,8 @@ void *sa = NULL;
 void *sb = NULL;
 static double static_buffer[BUFFER_SIZE/sizeof(double)];
 
+volatile int blas_memory_generation = 0;
+
 void *blas_memory_alloc(int numproc){
 
   if (sa == NULL){
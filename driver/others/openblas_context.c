@@ -0,0 +1,76 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Contexts are implemented by the pthreads server in blas_server.c. The
+   OpenMP and Windows servers, and single-threaded builds, only have the
+   default pool: no context can be created and every call uses the default. */
+
+#include <errno.h>
+#include "common.h"
+
+#if !defined(SMP_SERVER) || defined(USE_OPENMP) || defined(OS_WINDOWS)
+
+extern int openblas_get_num_threads(void);
+
+struct openblas_context *openblas_context_create(int num_threads){
+  return NULL;
+}
+
+void openblas_context_destroy(struct openblas_context *context){
+}
+
+struct openblas_context *openblas_context_set_current(struct openblas_context *context){
+  return NULL;
+}
+
+struct openblas_context *openblas_context_get_current(void){
+  return NULL;
+}
+
+int openblas_context_get_num_threads(struct openblas_context *context){
+  return openblas_get_num_threads();
+}
+
+#ifdef OS_LINUX
+int openblas_context_setaffinity(struct openblas_context *context, size_t cpusetsize, cpu_set_t *cpu_set){
+  errno = EINVAL;
+  return -1;
+}
+#endif
+
+int blas_context_num_threads(void){
+  return 0;
+}
+
+#endif
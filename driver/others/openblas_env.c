@@ -40,6 +40,11 @@ static int openblas_env_openblas_num_threads=0;
 static int openblas_env_goto_num_threads=0;
 static int openblas_env_omp_num_threads=0;
 static int openblas_env_omp_adaptive=0;
+static int openblas_env_autotune=0;
+static int openblas_env_getrf_lookahead=0;
+static int openblas_env_hugepages=0;
+static int openblas_env_numa_gemm=0;
+static int openblas_env_dynamic_gemm=0;
 
 int openblas_verbose(void) { return openblas_env_verbose;}
 unsigned int openblas_thread_timeout(void) { return openblas_env_thread_timeout;}
@@ -48,6 +53,11 @@ int openblas_num_threads_env(void) { return openblas_env_openblas_num_threads;}
 int openblas_goto_num_threads_env(void) { return openblas_env_goto_num_threads;}
 int openblas_omp_num_threads_env(void) { return openblas_env_omp_num_threads;}
 int openblas_omp_adaptive_env(void) { return openblas_env_omp_adaptive;}
+int openblas_autotune_env(void) { return openblas_env_autotune;}
+int openblas_getrf_lookahead_env(void) { return openblas_env_getrf_lookahead;}
+int openblas_hugepages_env(void) { return openblas_env_hugepages;}
+int openblas_numa_gemm_env(void) { return openblas_env_numa_gemm;}
+int openblas_dynamic_gemm_env(void) { return openblas_env_dynamic_gemm;}
 
 void openblas_read_env(void) {
   int ret=0;
@@ -92,6 +102,31 @@ void openblas_read_env(void) {
   if(ret<0) ret=0;
   openblas_env_omp_adaptive=ret;
 
+  ret=0;
+  if (readenv(p,"OPENBLAS_AUTOTUNE")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_autotune=ret;
+
+  ret=0;
+  if (readenv(p,"OPENBLAS_GETRF_LOOKAHEAD")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_getrf_lookahead=ret;
+
+  ret=0;
+  if (readenv(p,"OPENBLAS_HUGEPAGES")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_hugepages=ret;
+
+  ret=0;
+  if (readenv(p,"OPENBLAS_NUMA_GEMM")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_numa_gemm=ret;
+
+  ret=0;
+  if (readenv(p,"OPENBLAS_DYNAMIC_GEMM")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_dynamic_gemm=ret;
+
 }
 
 
@@ -52,6 +52,7 @@
 
 @blasobjs = (lsame, xerbla);
 @bfblasobjs = (sbgemm, sbgemv, sbdot, sbstobf16, sbdtobf16, sbf16tos, dbf16tod);
+@shblasobjs = (shgemm, shgemv);
 @cblasobjsc = (
     cblas_caxpy, cblas_ccopy, cblas_cdotc, cblas_cdotu, cblas_cgbmv, cblas_cgemm, cblas_cgemv,
     cblas_cgerc, cblas_cgeru, cblas_chbmv, cblas_chemm, cblas_chemv, cblas_cher2, cblas_cher2k,
@@ -95,6 +96,8 @@
 @cblasobjs = (  cblas_xerbla );
 
 @bfcblasobjs = (cblas_sbgemm, cblas_sbgemv, cblas_sbdot, cblas_sbstobf16, cblas_sbdtobf16, cblas_sbf16tos, cblas_dbf16tod);
+@shcblasobjs = (cblas_shgemm, cblas_shgemv);
+@i8cblasobjs = (cblas_gemm_s8u8s32);
 
 @exblasobjs = (
     qamax,qamin,qasum,qaxpy,qcabs1,qcopy,qdot,qgbmv,qgemm,
@@ -146,6 +149,22 @@
     goto_set_num_threads,
     openblas_get_config,
     openblas_get_corename,
+    openblas_get_workspace_stats,
+    openblas_context_create,
+    openblas_context_destroy,
+    openblas_context_set_current,
+    openblas_context_get_current,
+    openblas_context_get_num_threads,
+    openblas_autotune,
+    openblas_set_hugepages,
+    openblas_get_hugepages,
+    openblas_get_hugepage_stats,
+    openblas_set_numa_gemm,
+    openblas_get_numa_gemm,
+    openblas_set_thread_capacity,
+    openblas_get_thread_capacity,
+    openblas_set_dynamic_gemm,
+    openblas_get_dynamic_gemm,
 );
 
 @misc_underscore_objs = (
@@ -3651,6 +3670,13 @@ if ($ARGV[12] == 1) {
 	@blasobjs = (@blasobjs, @bfblasobjs);
 	@cblasobjs = (@cblasobjs, @bfcblasobjs);
 }
+if ($ARGV[17] == 1) {
+	@blasobjs = (@blasobjs, @shblasobjs);
+	@cblasobjs = (@cblasobjs, @shcblasobjs);
+}
+if ($ARGV[18] == 1) {
+	@cblasobjs = (@cblasobjs, @i8cblasobjs);
+}
 if ($ARGV[13] == 1) {
 	@blasobjs = (@blasobjs, @blasobjss);
 	@cblasobjs = (@cblasobjs, @cblasobjss);
@@ -0,0 +1,282 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+void openblas_warning(int verbose, const char * msg);
+
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define ERROR_PREFIX "DAXPY_BATCH"
+#else
+#define ERROR_PREFIX "SAXPY_BATCH"
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_PREFIX "ZAXPY_BATCH"
+#else
+#define ERROR_PREFIX "CAXPY_BATCH"
+#endif
+#endif
+
+#ifdef STRIDED
+#define ERROR_NAME ERROR_PREFIX "_STRIDED "
+#else
+#define ERROR_NAME ERROR_PREFIX " "
+#endif
+
+/* axpy reads two vectors and writes one of them back; a batch is spread
+   over threads only when each gets at least this many elements */
+#define AXPY_BATCH_MIN	10000L
+
+/* y = alpha*x + y for one member of length args->m */
+static int axpy_member(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		       FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  FLOAT *x = (FLOAT *)args -> a;
+  FLOAT *y = (FLOAT *)args -> b;
+  BLASLONG n    = args -> m;
+  BLASLONG incx = args -> lda;
+  BLASLONG incy = args -> ldb;
+  FLOAT *alpha  = (FLOAT *)args -> alpha;
+
+#ifndef COMPLEX
+  if (incx == 0 && incy == 0) {
+    *y += n * alpha[0] * (*x);
+    return 0;
+  }
+
+  if (incx < 0) x -= (n - 1) * incx;
+  if (incy < 0) y -= (n - 1) * incy;
+
+  AXPYU_K(n, 0, 0, alpha[0], x, incx, y, incy, NULL, 0);
+#else
+  if (incx == 0 && incy == 0) {
+    *y     += n * (alpha[0] * (*x) - alpha[1] * (*(x + 1)));
+    *(y+1) += n * (alpha[1] * (*x) + alpha[0] * (*(x + 1)));
+    return 0;
+  }
+
+  if (incx < 0) x -= (n - 1) * incx * 2;
+  if (incy < 0) y -= (n - 1) * incy * 2;
+
+  AXPYU_K(n, 0, 0, alpha[0], alpha[1], x, incx, y, incy, NULL, 0);
+#endif
+
+  return 0;
+}
+
+#ifndef STRIDED
+
+void CNAME(blasint * n_array,
+#ifndef COMPLEX
+	   FLOAT * alpha_array,
+	   FLOAT ** x_array, blasint * incx_array,
+	   FLOAT ** y_array, blasint * incy_array,
+#else
+	   void * valpha_array,
+	   void ** vx_array, blasint * incx_array,
+	   void ** vy_array, blasint * incy_array,
+#endif
+	   blasint group_count, blasint * group_size){
+
+#ifdef COMPLEX
+  FLOAT * alpha_array = (FLOAT *)valpha_array;
+  FLOAT ** x_array = (FLOAT **)vx_array;
+  FLOAT ** y_array = (FLOAT **)vy_array;
+#endif
+
+  blas_arg_t * args_array = NULL;
+  int mode = 0;
+  blasint i, j, info, matrix_idx = 0, count = 0, total_num = 0;
+
+  PRINT_DEBUG_CNAME;
+
+  info = -1;
+
+  if (group_count < 0) info = 7;
+  for (i = 0; i < group_count; i++) {
+    if (group_size[i] < 0) info = 8;
+    else total_num += group_size[i];
+  }
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (total_num == 0) return;
+
+  args_array = (blas_arg_t *)malloc(total_num * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  for (i = 0; i < group_count; matrix_idx += group_size[i], i++) {
+
+    if (n_array[i] <= 0) continue;
+#ifndef COMPLEX
+    if (alpha_array[i] == ZERO) continue;
+#else
+    if (alpha_array[2 * i] == ZERO && alpha_array[2 * i + 1] == ZERO) continue;
+#endif
+
+    for (j = 0; j < group_size[i]; j++) {
+      /* blas_batch_thread balances m * n, and n = COMPSIZE counts a
+         complex element as two */
+      args_array[count].m = n_array[i];
+      args_array[count].n = COMPSIZE;
+      args_array[count].a = (void *)x_array[matrix_idx + j];
+      args_array[count].b = (void *)y_array[matrix_idx + j];
+      args_array[count].lda = incx_array[i];
+      args_array[count].ldb = incy_array[i];
+      args_array[count].alpha = (void *)&alpha_array[i * COMPSIZE];
+      args_array[count].routine = (void *)axpy_member;
+      args_array[count].routine_mode = mode;
+      count++;
+    }
+  }
+
+  if (count > 0) blas_batch_thread(args_array, count, AXPY_BATCH_MIN, 0);
+
+  free(args_array);
+}
+
+#else
+
+void CNAME(blasint n,
+#ifndef COMPLEX
+	   FLOAT alpha,
+	   FLOAT *x, blasint incx, blasint stride_x,
+	   FLOAT *y, blasint incy, blasint stride_y,
+#else
+	   void *valpha,
+	   void *vx, blasint incx, blasint stride_x,
+	   void *vy, blasint incy, blasint stride_y,
+#endif
+	   blasint batch_size){
+
+#ifndef COMPLEX
+  FLOAT *alpha_p = &alpha;
+#else
+  FLOAT *alpha_p = (FLOAT *)valpha;
+  FLOAT *x = (FLOAT *)vx;
+  FLOAT *y = (FLOAT *)vy;
+#endif
+
+  blas_arg_t * args_array = NULL;
+  int mode = 0;
+  blasint i, info;
+
+  PRINT_DEBUG_CNAME;
+
+  info = -1;
+
+  if (batch_size < 0) info = 9;
+  if ((batch_size > 1) && (n > 0) && (stride_y < 1 + (BLASLONG)(n - 1) * blasabs(incy))) info = 8;
+  if (stride_x < 0)   info = 5;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (n <= 0 || batch_size == 0) return;
+#ifndef COMPLEX
+  if (alpha_p[0] == ZERO) return;
+#else
+  if (alpha_p[0] == ZERO && alpha_p[1] == ZERO) return;
+#endif
+
+  args_array = (blas_arg_t *)malloc(batch_size * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  for (i = 0; i < batch_size; i++) {
+    args_array[i].m = n;
+    args_array[i].n = COMPSIZE;
+    args_array[i].a = (void *)(x + (BLASLONG)i * stride_x * COMPSIZE);
+    args_array[i].b = (void *)(y + (BLASLONG)i * stride_y * COMPSIZE);
+    args_array[i].lda = incx;
+    args_array[i].ldb = incy;
+    args_array[i].alpha = (void *)alpha_p;
+    args_array[i].routine = (void *)axpy_member;
+    args_array[i].routine_mode = mode;
+  }
+
+  blas_batch_thread(args_array, batch_size, AXPY_BATCH_MIN, 0);
+
+  free(args_array);
+}
+
+#endif
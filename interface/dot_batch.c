@@ -0,0 +1,227 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+void openblas_warning(int verbose, const char * msg);
+
+#ifdef DOUBLE
+#define ERROR_PREFIX "DDOT_BATCH"
+#else
+#define ERROR_PREFIX "SDOT_BATCH"
+#endif
+
+#ifdef STRIDED
+#define ERROR_NAME ERROR_PREFIX "_STRIDED "
+#else
+#define ERROR_NAME ERROR_PREFIX " "
+#endif
+
+/* The members only read memory, so below this many elements per thread
+   starting the threads costs more than it saves */
+#define DOT_BATCH_MIN	10000L
+#define DOT_BATCH_BLOCK	8192L
+
+/* *result = x'*y for one member of length args->m */
+static int dot_member(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		      FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  FLOAT *x = (FLOAT *)args -> a;
+  FLOAT *y = (FLOAT *)args -> b;
+  BLASLONG n    = args -> m;
+  BLASLONG incx = args -> lda;
+  BLASLONG incy = args -> ldb;
+
+  FLOAT ret = ZERO;
+#ifdef SMP
+  BLASLONG i, len;
+#endif
+
+  if (incx < 0) x -= (n - 1) * incx;
+  if (incy < 0) y -= (n - 1) * incy;
+
+#ifdef SMP
+  /* dot kernels may start threads of their own for long vectors, which
+     must not happen while the members are spread over the threads, so
+     then those are taken in pieces */
+  if (args -> nthreads > 1) {
+    for (i = 0; i < n; i += DOT_BATCH_BLOCK) {
+      len = MIN(n - i, DOT_BATCH_BLOCK);
+      ret += DOTU_K(len, x + i * incx, incx, y + i * incy, incy);
+    }
+  } else
+#endif
+  ret = DOTU_K(n, x, incx, y, incy);
+
+  *(FLOAT *)args -> c = ret;
+
+  return 0;
+}
+
+#ifndef STRIDED
+
+void CNAME(blasint * n_array,
+	   FLOAT ** x_array, blasint * incx_array,
+	   FLOAT ** y_array, blasint * incy_array,
+	   blasint group_count, blasint * group_size, FLOAT * result){
+
+  blas_arg_t * args_array = NULL;
+  int mode = 0;
+  blasint i, j, info, matrix_idx = 0, count = 0, total_num = 0;
+
+  PRINT_DEBUG_CNAME;
+
+  info = -1;
+
+  if (group_count < 0) info = 6;
+  for (i = 0; i < group_count; i++) {
+    if (group_size[i] < 0) info = 7;
+    else total_num += group_size[i];
+  }
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (total_num == 0) return;
+
+  args_array = (blas_arg_t *)malloc(total_num * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+#ifdef SMP
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#endif
+
+  for (i = 0; i < group_count; matrix_idx += group_size[i], i++) {
+
+    if (n_array[i] <= 0) {
+      for (j = 0; j < group_size[i]; j++) result[matrix_idx + j] = ZERO;
+      continue;
+    }
+
+    for (j = 0; j < group_size[i]; j++) {
+      /* one multiply-add per element, so the member weighs m */
+      args_array[count].m = n_array[i];
+      args_array[count].n = 1;
+      args_array[count].a = (void *)x_array[matrix_idx + j];
+      args_array[count].b = (void *)y_array[matrix_idx + j];
+      args_array[count].c = (void *)&result[matrix_idx + j];
+      args_array[count].lda = incx_array[i];
+      args_array[count].ldb = incy_array[i];
+      args_array[count].routine = (void *)dot_member;
+      args_array[count].routine_mode = mode;
+      count++;
+    }
+  }
+
+  if (count > 0) blas_batch_thread(args_array, count, DOT_BATCH_MIN, 0);
+
+  free(args_array);
+}
+
+#else
+
+void CNAME(blasint n,
+	   FLOAT *x, blasint incx, blasint stride_x,
+	   FLOAT *y, blasint incy, blasint stride_y,
+	   blasint batch_size, FLOAT * result){
+
+  blas_arg_t * args_array = NULL;
+  int mode = 0;
+  blasint i, info;
+
+  PRINT_DEBUG_CNAME;
+
+  info = -1;
+
+  if (batch_size < 0) info = 8;
+  if (stride_y < 0)   info = 7;
+  if (stride_x < 0)   info = 4;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (batch_size == 0) return;
+
+  if (n <= 0) {
+    for (i = 0; i < batch_size; i++) result[i] = ZERO;
+    return;
+  }
+
+  args_array = (blas_arg_t *)malloc(batch_size * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+#ifdef SMP
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#endif
+
+  for (i = 0; i < batch_size; i++) {
+    args_array[i].m = n;
+    args_array[i].n = 1;
+    args_array[i].a = (void *)(x + (BLASLONG)i * stride_x);
+    args_array[i].b = (void *)(y + (BLASLONG)i * stride_y);
+    args_array[i].c = (void *)&result[i];
+    args_array[i].lda = incx;
+    args_array[i].ldb = incy;
+    args_array[i].routine = (void *)dot_member;
+    args_array[i].routine_mode = mode;
+  }
+
+  blas_batch_thread(args_array, batch_size, DOT_BATCH_MIN, 0);
+
+  free(args_array);
+}
+
+#endif
@@ -45,7 +45,6 @@
 #endif
 
 #ifndef COMPLEX
-#define SMP_THRESHOLD_MIN 65536.0
 #ifdef XDOUBLE
 #define ERROR_NAME "QGEMM "
 #define GEMV BLASFUNC(qgemv)
@@ -55,12 +54,14 @@
 #elif defined(BFLOAT16)
 #define ERROR_NAME "SBGEMM "
 #define GEMV BLASFUNC(sbgemv)
+#elif defined(HFLOAT16)
+#define ERROR_NAME "SHGEMM "
+#define GEMV BLASFUNC(shgemv)
 #else
 #define ERROR_NAME "SGEMM "
 #define GEMV BLASFUNC(sgemv)
 #endif
 #else
-#define SMP_THRESHOLD_MIN 8192.0
 #ifndef GEMM3M
 #ifdef XDOUBLE
 #define ERROR_NAME "XGEMM "
@@ -80,8 +81,9 @@
 #endif
 #endif
 
-#ifndef GEMM_MULTITHREAD_THRESHOLD
-#define GEMM_MULTITHREAD_THRESHOLD 4
+/* A small C with a long inner dimension may be split over k */
+#if defined(SMP) && !defined(GEMM3M) && !defined(XDOUBLE) && !defined(BFLOAT16) && !defined(HFLOAT16)
+#define GEMM_SPLIT_K
 #endif
 
 static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG) = {
@@ -110,7 +112,7 @@ static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, B
 #endif
 };
 
-#if defined(SMALL_MATRIX_OPT) && !defined(GEMM3M) && !defined(XDOUBLE)
+#if defined(SMALL_MATRIX_OPT) && !defined(GEMM3M) && !defined(XDOUBLE) && !defined(HFLOAT16)
 #define USE_SMALL_MATRIX_OPT 1
 #else
 #define USE_SMALL_MATRIX_OPT 0
@@ -196,8 +198,7 @@ void NAME(char *TRANSA, char *TRANSB,
   IFLOAT *sa, *sb;
 
 #ifdef SMP
-  double MNK;
-#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
+#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY) || defined(GEMM_SPLIT_K)
 #ifndef COMPLEX
 #ifdef XDOUBLE
   int mode  =  BLAS_XDOUBLE | BLAS_REAL;
@@ -221,6 +222,9 @@ void NAME(char *TRANSA, char *TRANSB,
 #if defined(SMP) && !defined(NO_AFFINITY) && !defined(USE_SIMPLE_THREADED_LEVEL3)
   int nodes;
 #endif
+#ifdef GEMM_SPLIT_K
+  int nthreads_k;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -320,8 +324,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
   XFLOAT *sa, *sb;
 
 #ifdef SMP
-  double MNK;
-#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
+#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY) || defined(GEMM_SPLIT_K)
 #ifndef COMPLEX
 #ifdef XDOUBLE
   int mode  =  BLAS_XDOUBLE | BLAS_REAL;
@@ -345,10 +348,13 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 #if defined(SMP) && !defined(NO_AFFINITY) && !defined(USE_SIMPLE_THREADED_LEVEL3)
   int nodes;
 #endif
+#ifdef GEMM_SPLIT_K
+  int nthreads_k;
+#endif
 
   PRINT_DEBUG_CNAME;
 
-#if !defined(COMPLEX) && !defined(DOUBLE) && !defined(BFLOAT16) && defined(USE_SGEMM_KERNEL_DIRECT)
+#if !defined(COMPLEX) && !defined(DOUBLE) && !defined(BFLOAT16) && !defined(HFLOAT16) && defined(USE_SGEMM_KERNEL_DIRECT)
 #ifdef DYNAMIC_ARCH
  if (support_avx512() )
 #endif  
@@ -498,7 +504,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 	 args.m, args.n, args.k, args.lda, args.ldb, args.ldc);
 #endif
 
-#if defined(GEMM_GEMV_FORWARD) && !defined(GEMM3M) && !defined(COMPLEX) && !defined(BFLOAT16)
+#if defined(GEMM_GEMV_FORWARD) && !defined(GEMM3M) && !defined(COMPLEX) && !defined(BFLOAT16) && !defined(HFLOAT16)
   // Check if we can convert GEMM -> GEMV
   if (args.k != 0) {
     if (args.n == 1) {
@@ -570,7 +576,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 #endif
 #endif
 
-  buffer = (XFLOAT *)blas_memory_alloc(0);
+  buffer = (XFLOAT *)blas_workspace_alloc();
 
 //For target LOONGSON3R5, applying an offset to the buffer is essential
 //for minimizing cache conflicts and optimizing performance.
@@ -582,19 +588,17 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
   sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
 
 #ifdef SMP
-#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
+#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY) || defined(GEMM_SPLIT_K)
   mode |= (transa << BLAS_TRANSA_SHIFT);
   mode |= (transb << BLAS_TRANSB_SHIFT);
 #endif
 
-  MNK = (double) args.m * (double) args.n * (double) args.k;
-  if ( MNK <= (SMP_THRESHOLD_MIN  * (double) GEMM_MULTITHREAD_THRESHOLD)  )
-	args.nthreads = 1;
-  else {
-	args.nthreads = num_cpu_avail(3);
-	if (MNK/args.nthreads < SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD)
-		args.nthreads = MNK/(SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD);
-  }
+  args.nthreads = LEVEL3_NTHREADS(args.m, args.n, args.k, BLAS_L3_SPLIT_MN);
+
+#ifdef GEMM_SPLIT_K
+  nthreads_k = LEVEL3_NTHREADS_K(args.m, args.n, args.k);
+  if (nthreads_k > 1) args.nthreads = nthreads_k;
+#endif
 
   args.common = NULL;
 
@@ -605,6 +609,12 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
 #ifdef SMP
 
+#ifdef GEMM_SPLIT_K
+  } else if (nthreads_k > 1) {
+
+    gemm_thread_k(mode, &args, NULL, NULL, gemm[(transb << 2) | transa], sa, sb, nthreads_k);
+#endif
+
   } else {
 
 #ifndef USE_SIMPLE_THREADED_LEVEL3
@@ -612,7 +622,11 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 #ifndef NO_AFFINITY
       nodes = get_num_nodes();
 
-      if ((nodes > 1) && get_node_equal()) {
+      if ((nodes > 1) && openblas_get_numa_gemm()) {
+
+	gemm_thread_node(mode, &args, NULL, NULL, gemm[16 | (transb << 2) | transa], sa, sb, args.nthreads);
+
+      } else if ((nodes > 1) && get_node_equal()) {
 
 	args.nthreads /= nodes;
 
@@ -641,7 +655,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
   }
 #endif
 
- blas_memory_free(buffer);
+ blas_workspace_free(buffer);
 
   FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
 
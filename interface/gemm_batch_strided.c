@@ -0,0 +1,191 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define ERROR_NAME "DGEMM_BATCH_STRIDED "
+#define GEMM_BATCH_STRIDED_THREAD dgemm_batch_strided_thread
+#elif defined(BFLOAT16)
+#define ERROR_NAME "SBGEMM_BATCH_STRIDED "
+#define GEMM_BATCH_STRIDED_THREAD sbgemm_batch_strided_thread
+#else
+#define ERROR_NAME "SGEMM_BATCH_STRIDED "
+#define GEMM_BATCH_STRIDED_THREAD sgemm_batch_strided_thread
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_NAME "ZGEMM_BATCH_STRIDED "
+#define GEMM_BATCH_STRIDED_THREAD zgemm_batch_strided_thread
+#else
+#define ERROR_NAME "CGEMM_BATCH_STRIDED "
+#define GEMM_BATCH_STRIDED_THREAD cgemm_batch_strided_thread
+#endif
+#endif
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   blasint m, blasint n, blasint k,
+#ifndef COMPLEX
+	   FLOAT alpha,
+	   IFLOAT *a, blasint lda, blasint stride_a,
+	   IFLOAT *b, blasint ldb, blasint stride_b,
+	   FLOAT beta,
+	   FLOAT *c, blasint ldc, blasint stride_c,
+#else
+	   void *valpha,
+	   void *va, blasint lda, blasint stride_a,
+	   void *vb, blasint ldb, blasint stride_b,
+	   void *vbeta,
+	   void *vc, blasint ldc, blasint stride_c,
+#endif
+	   blasint batch_size){
+
+  blas_arg_t args;
+  int transa, transb;
+  BLASLONG nrowa, nrowb, ncolc, str_a, str_b;
+  blasint info;
+
+#ifdef COMPLEX
+  FLOAT *alpha = (FLOAT *)valpha;
+  FLOAT *beta  = (FLOAT *)vbeta;
+  FLOAT *a = (FLOAT *)va;
+  FLOAT *b = (FLOAT *)vb;
+  FLOAT *c = (FLOAT *)vc;
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+#ifndef COMPLEX
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+#else
+  args.alpha = (void *)alpha;
+  args.beta  = (void *)beta;
+#endif
+
+  transa = -1;
+  transb = -1;
+  info   =  0;
+
+  args.k = k;
+  args.c = (void *)c;
+  args.ldc = ldc;
+
+  /* In row major order C**T = B**T * A**T is computed per member; as  */
+  /* in cblas_?gemm, argument errors are reported for that column major */
+  /* call, i.e. with the positions of A and B (and of m and n) swapped  */
+  if (order == CblasRowMajor) {
+    enum CBLAS_TRANSPOSE t = TransA;
+
+    TransA = TransB;
+    TransB = t;
+
+    args.m = n;
+    args.n = m;
+    args.a = (void *)b;
+    args.b = (void *)a;
+    args.lda = ldb;
+    args.ldb = lda;
+    str_a = stride_b;
+    str_b = stride_a;
+  } else {
+    args.m = m;
+    args.n = n;
+    args.a = (void *)a;
+    args.b = (void *)b;
+    args.lda = lda;
+    args.ldb = ldb;
+    str_a = stride_a;
+    str_b = stride_b;
+  }
+
+  if (TransA == CblasNoTrans)     transa = 0;
+  if (TransA == CblasTrans)       transa = 1;
+#ifndef COMPLEX
+  if (TransA == CblasConjNoTrans) transa = 0;
+  if (TransA == CblasConjTrans)   transa = 1;
+#else
+  if (TransA == CblasConjNoTrans) transa = 2;
+  if (TransA == CblasConjTrans)   transa = 3;
+#endif
+  if (TransB == CblasNoTrans)     transb = 0;
+  if (TransB == CblasTrans)       transb = 1;
+#ifndef COMPLEX
+  if (TransB == CblasConjNoTrans) transb = 0;
+  if (TransB == CblasConjTrans)   transb = 1;
+#else
+  if (TransB == CblasConjNoTrans) transb = 2;
+  if (TransB == CblasConjTrans)   transb = 3;
+#endif
+
+  nrowa = args.m;
+  if (transa & 1) nrowa = args.k;
+  nrowb = args.k;
+  if (transb & 1) nrowb = args.n;
+  ncolc = args.n;
+
+  info = -1;
+
+  if (batch_size < 0)    info = 17;
+  if ((batch_size > 1) && (stride_c < args.ldc * ncolc)) info = 16;
+  if (args.ldc < MAX(1, args.m)) info = 15;
+  if (str_b < 0)         info = 12;
+  if (args.ldb < MAX(1, nrowb)) info = 11;
+  if (str_a < 0)         info =  9;
+  if (args.lda < MAX(1, nrowa)) info =  8;
+  if (args.k < 0)        info =  5;
+  if (args.n < 0)        info =  4;
+  if (args.m < 0)        info =  3;
+  if (transb < 0)        info =  2;
+  if (transa < 0)        info =  1;
+  if ((order != CblasColMajor) && (order != CblasRowMajor)) info = 0;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0) || (batch_size == 0)) return;
+
+  IDEBUG_START;
+
+  GEMM_BATCH_STRIDED_THREAD(&args, str_a, str_b, stride_c, batch_size, (transb << 2) | transa);
+
+  IDEBUG_END;
+
+  return;
+}
@@ -0,0 +1,232 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifdef DOUBLE
+#define ERROR_NAME "DGEMM_COMPUTE "
+#define GEMM_PACKED		dgemm_packed
+#define GEMM_PACKED_THREAD	dgemm_packed_thread
+#else
+#define ERROR_NAME "SGEMM_COMPUTE "
+#define GEMM_PACKED		sgemm_packed
+#define GEMM_PACKED_THREAD	sgemm_packed_thread
+#endif
+
+static int check_pack(gemm_pack_t *pack, int side, BLASLONG rows, BLASLONG k){
+
+  if (pack == NULL) return -1;
+  if (pack -> magic != (GEMM_PACK_MAGIC | SIZE)) return -1;
+  if ((pack -> side != side) || (pack -> rows != rows) || (pack -> k != k)) return -1;
+  /* The panels follow the K blocking at the time of packing */
+  if (pack -> q != GEMM_Q) return -1;
+
+  return 0;
+}
+
+void CNAME(enum CBLAS_ORDER order, blasint TransA, blasint TransB,
+	   blasint m, blasint n, blasint k,
+	   FLOAT *a, blasint lda,
+	   FLOAT *b, blasint ldb,
+	   FLOAT beta,
+	   FLOAT *c, blasint ldc){
+
+  blas_arg_t args;
+  int transa, transb, packa, packb;
+  blasint nrowa, nrowb, info;
+
+  XFLOAT *buffer;
+  XFLOAT *sa, *sb;
+
+  PRINT_DEBUG_CNAME;
+
+  args.beta = (void *)&beta;
+
+  args.k   = k;
+  args.c   = (void *)c;
+  args.ldc = ldc;
+
+  transa = -1;
+  transb = -1;
+  packa  = 0;
+  packb  = 0;
+  info   = -1;
+
+  if (order == CblasColMajor) {
+    args.m = m;
+    args.n = n;
+
+    args.a = (void *)a;
+    args.b = (void *)b;
+
+    args.lda = lda;
+    args.ldb = ldb;
+
+    if (TransA == CblasNoTrans)     transa = 0;
+    if (TransA == CblasTrans)       transa = 1;
+    if (TransA == CblasConjNoTrans) transa = 0;
+    if (TransA == CblasConjTrans)   transa = 1;
+    if (TransA == CblasPacked)      transa = 2;
+
+    if (TransB == CblasNoTrans)     transb = 0;
+    if (TransB == CblasTrans)       transb = 1;
+    if (TransB == CblasConjNoTrans) transb = 0;
+    if (TransB == CblasConjTrans)   transb = 1;
+    if (TransB == CblasPacked)      transb = 2;
+
+    packa = (transa == 2);
+    packb = (transb == 2);
+
+    nrowa = args.m;
+    if (transa & 1) nrowa = args.k;
+    nrowb = args.k;
+    if (transb & 1) nrowb = args.n;
+
+    if (args.ldc < args.m) info = 12;
+    if (packb) {
+      if ((args.m >= 0) && (args.n >= 0) && (args.k >= 0) &&
+	  check_pack((gemm_pack_t *)args.b, GEMM_PACK_OUTER, args.n, args.k)) info = 8;
+    } else {
+      if (args.ldb < nrowb) info = 9;
+    }
+    if (packa) {
+      if ((args.m >= 0) && (args.n >= 0) && (args.k >= 0) &&
+	  check_pack((gemm_pack_t *)args.a, GEMM_PACK_INNER, args.m, args.k)) info = 6;
+    } else {
+      if (args.lda < nrowa) info = 7;
+    }
+    if (args.k < 0)  info = 5;
+    if (args.n < 0)  info = 4;
+    if (args.m < 0)  info = 3;
+    if (transb < 0)  info = 2;
+    if (transa < 0)  info = 1;
+  }
+
+  if (order == CblasRowMajor) {
+    args.m = n;
+    args.n = m;
+
+    args.a = (void *)b;
+    args.b = (void *)a;
+
+    args.lda = ldb;
+    args.ldb = lda;
+
+    if (TransB == CblasNoTrans)     transa = 0;
+    if (TransB == CblasTrans)       transa = 1;
+    if (TransB == CblasConjNoTrans) transa = 0;
+    if (TransB == CblasConjTrans)   transa = 1;
+    if (TransB == CblasPacked)      transa = 2;
+
+    if (TransA == CblasNoTrans)     transb = 0;
+    if (TransA == CblasTrans)       transb = 1;
+    if (TransA == CblasConjNoTrans) transb = 0;
+    if (TransA == CblasConjTrans)   transb = 1;
+    if (TransA == CblasPacked)      transb = 2;
+
+    packa = (transa == 2);
+    packb = (transb == 2);
+
+    nrowa = args.m;
+    if (transa & 1) nrowa = args.k;
+    nrowb = args.k;
+    if (transb & 1) nrowb = args.n;
+
+    if (args.ldc < args.m) info = 12;
+    if (packb) {
+      if ((args.m >= 0) && (args.n >= 0) && (args.k >= 0) &&
+	  check_pack((gemm_pack_t *)args.b, GEMM_PACK_OUTER, args.n, args.k)) info = 8;
+    } else {
+      if (args.ldb < nrowb) info = 9;
+    }
+    if (packa) {
+      if ((args.m >= 0) && (args.n >= 0) && (args.k >= 0) &&
+	  check_pack((gemm_pack_t *)args.a, GEMM_PACK_INNER, args.m, args.k)) info = 6;
+    } else {
+      if (args.lda < nrowa) info = 7;
+    }
+    if (args.k < 0)  info = 5;
+    if (args.n < 0)  info = 4;
+    if (args.m < 0)  info = 3;
+    if (transb < 0)  info = 2;
+    if (transa < 0)  info = 1;
+  }
+
+  if ((order != CblasColMajor) && (order != CblasRowMajor)) info = 0;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+  args.routine_mode = 0;
+  if (packa)  args.routine_mode |= GEMM_PACKED_A;
+  if (packb)  args.routine_mode |= GEMM_PACKED_B;
+  if (transa == 1) args.routine_mode |= GEMM_PACKED_TRANSA;
+  if (transb == 1) args.routine_mode |= GEMM_PACKED_TRANSB;
+
+  IDEBUG_START;
+
+  buffer = (XFLOAT *)blas_workspace_alloc();
+
+  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  args.nthreads = LEVEL3_NTHREADS(args.m, args.n, args.k, BLAS_L3_SPLIT_MN);
+
+  args.common = NULL;
+
+  if (args.nthreads == 1) {
+#endif
+
+    GEMM_PACKED(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+
+    GEMM_PACKED_THREAD(&args, NULL, NULL, sa, sb, 0);
+
+  }
+#endif
+
+  blas_workspace_free(buffer);
+
+  IDEBUG_END;
+
+  return;
+}
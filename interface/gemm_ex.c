@@ -0,0 +1,214 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#define ERROR_NAME "SGEMM_EX "
+
+static int (*gemm_ex[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG) = {
+  sgemm_ex_nn, sgemm_ex_tn, sgemm_ex_nt, sgemm_ex_tt,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  sgemm_ex_thread_nn, sgemm_ex_thread_tn, sgemm_ex_thread_nt, sgemm_ex_thread_tt,
+#endif
+};
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   blasint m, blasint n, blasint k,
+	   FLOAT alpha, FLOAT *a, blasint lda, FLOAT *b, blasint ldb,
+	   FLOAT beta, FLOAT *c, blasint ldc,
+	   openblas_gemm_epilogue_t *epilogue){
+
+  blas_arg_t args;
+  gemm_epilogue_t epi;
+  int transa, transb;
+  blasint nrowa, nrowb, info;
+  enum CBLAS_BIAS bias_type;
+  enum CBLAS_ACTIVATION activation;
+
+  XFLOAT *buffer;
+  XFLOAT *sa, *sb;
+
+#if defined(SMP) && defined(USE_SIMPLE_THREADED_LEVEL3)
+  int mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  bias_type  = CblasNoBias;
+  activation = CblasNoActivation;
+
+  epi.bias_m     = NULL;
+  epi.bias_n     = NULL;
+  epi.activation = -1;
+  epi.out        = NULL;
+  epi.ldo        = 0;
+
+  if (epilogue) {
+    bias_type  = epilogue -> bias_type;
+    activation = epilogue -> activation;
+    epi.out    = epilogue -> C_bf16;
+    epi.ldo    = epilogue -> ldc_bf16;
+  }
+
+  if (activation == CblasNoActivation) epi.activation = GEMM_ACT_NONE;
+  if (activation == CblasReLU)         epi.activation = GEMM_ACT_RELU;
+  if (activation == CblasGELU)         epi.activation = GEMM_ACT_GELU;
+  if (activation == CblasGELUTanh)     epi.activation = GEMM_ACT_GELU_TANH;
+  if (activation == CblasSigmoid)      epi.activation = GEMM_ACT_SIGMOID;
+
+  transa = -1;
+  transb = -1;
+
+  args.k = k;
+  args.c = (void *)c;
+  args.ldc = ldc;
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+
+  /* In row major order C**T = B**T * A**T is computed, so a bias per row
+     of C becomes one per column of C**T                                 */
+  if (order == CblasRowMajor) {
+    enum CBLAS_TRANSPOSE t = TransA;
+
+    TransA = TransB;
+    TransB = t;
+
+    args.m = n;
+    args.n = m;
+    args.a = (void *)b;
+    args.b = (void *)a;
+    args.lda = ldb;
+    args.ldb = lda;
+
+    if (bias_type == CblasRowBias) epi.bias_n = (FLOAT *)epilogue -> bias;
+    if (bias_type == CblasColBias) epi.bias_m = (FLOAT *)epilogue -> bias;
+  } else {
+    args.m = m;
+    args.n = n;
+    args.a = (void *)a;
+    args.b = (void *)b;
+    args.lda = lda;
+    args.ldb = ldb;
+
+    if (bias_type == CblasRowBias) epi.bias_m = (FLOAT *)epilogue -> bias;
+    if (bias_type == CblasColBias) epi.bias_n = (FLOAT *)epilogue -> bias;
+  }
+
+  if (TransA == CblasNoTrans)     transa = 0;
+  if (TransA == CblasTrans)       transa = 1;
+  if (TransA == CblasConjNoTrans) transa = 0;
+  if (TransA == CblasConjTrans)   transa = 1;
+  if (TransB == CblasNoTrans)     transb = 0;
+  if (TransB == CblasTrans)       transb = 1;
+  if (TransB == CblasConjNoTrans) transb = 0;
+  if (TransB == CblasConjTrans)   transb = 1;
+
+  nrowa = args.m;
+  if (transa & 1) nrowa = args.k;
+  nrowb = args.k;
+  if (transb & 1) nrowb = args.n;
+
+  info = -1;
+
+  if (epi.out && (epi.ldo < MAX(1, args.m))) info = 14;
+  if ((bias_type != CblasNoBias) && (epilogue -> bias == NULL)) info = 14;
+  if ((bias_type != CblasNoBias) && (bias_type != CblasRowBias) && (bias_type != CblasColBias)) info = 14;
+  if (epi.activation < 0) info = 14;
+  if (args.ldc < MAX(1, args.m)) info = 13;
+  if (args.ldb < MAX(1, nrowb)) info = 10;
+  if (args.lda < MAX(1, nrowa)) info =  8;
+  if (args.k < 0)        info =  5;
+  if (args.n < 0)        info =  4;
+  if (args.m < 0)        info =  3;
+  if (transb < 0)        info =  2;
+  if (transa < 0)        info =  1;
+  if ((order != CblasColMajor) && (order != CblasRowMajor)) info = 0;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+  IDEBUG_START;
+
+  /* Without a product the drivers stop after scaling C */
+  if ((args.k == 0) || (alpha == ZERO)) {
+    if (beta != ONE) GEMM_BETA(args.m, args.n, 0, beta, NULL, 0, NULL, 0, c, args.ldc);
+    sgemm_epilogue(args.m, args.n, 0, 0, c, args.ldc, &epi);
+    IDEBUG_END;
+    return;
+  }
+
+  args.d = (void *)&epi;
+
+  buffer = (XFLOAT *)blas_workspace_alloc();
+
+  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+#ifdef USE_SIMPLE_THREADED_LEVEL3
+  mode |= (transa << BLAS_TRANSA_SHIFT);
+  mode |= (transb << BLAS_TRANSB_SHIFT);
+#endif
+
+  /* No split over k: every tile of C has to be final in one thread */
+  args.nthreads = LEVEL3_NTHREADS(args.m, args.n, args.k, BLAS_L3_SPLIT_MN);
+
+  args.common = NULL;
+
+  if (args.nthreads == 1) {
+#endif
+
+    (gemm_ex[(transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+    (gemm_ex[4 | (transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+#else
+    GEMM_THREAD(mode, &args, NULL, NULL, gemm_ex[(transb << 1) | transa], sa, sb, args.nthreads);
+#endif
+  }
+#endif
+
+  blas_workspace_free(buffer);
+
+  IDEBUG_END;
+
+  return;
+}
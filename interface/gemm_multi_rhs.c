@@ -0,0 +1,228 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+void openblas_warning(int verbose, const char * msg);
+
+#ifndef DOUBLE
+#define ERROR_NAME "SGEMM_MULTI_RHS "
+#else
+#define ERROR_NAME "DGEMM_MULTI_RHS "
+#endif
+
+static int (*gemm_multi_rhs[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG) = {
+#ifndef DOUBLE
+  sgemm_multi_rhs_nn, sgemm_multi_rhs_tn, sgemm_multi_rhs_nt, sgemm_multi_rhs_tt,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  sgemm_multi_rhs_thread_nn, sgemm_multi_rhs_thread_tn, sgemm_multi_rhs_thread_nt, sgemm_multi_rhs_thread_tt,
+#endif
+#else
+  dgemm_multi_rhs_nn, dgemm_multi_rhs_tn, dgemm_multi_rhs_nt, dgemm_multi_rhs_tt,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  dgemm_multi_rhs_thread_nn, dgemm_multi_rhs_thread_tn, dgemm_multi_rhs_thread_nt, dgemm_multi_rhs_thread_tt,
+#endif
+#endif
+};
+
+/* C_j = alpha * op(A) * op(B_j) + beta * C_j for j = 0 .. nrhs-1, as one
+   GEMM whose n is the sum of all n_j. In row major order the members are
+   the row blocks of a GEMM with the shared operand on the right.       */
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   blasint m, blasint k, FLOAT alpha, FLOAT *a, blasint lda,
+	   blasint nrhs, blasint *n_array, FLOAT **b_array, blasint *ldb_array,
+	   FLOAT beta, FLOAT **c_array, blasint *ldc_array){
+
+  blas_arg_t args;
+  gemm_multi_rhs_t multi;
+  gemm_rhs_t *rhs;
+  int transa, transb, split_m;
+  blasint i, j, nrow, info;
+  BLASLONG total;
+
+  XFLOAT *buffer;
+  XFLOAT *sa, *sb;
+
+#if defined(SMP) && defined(USE_SIMPLE_THREADED_LEVEL3)
+#ifndef DOUBLE
+  int mode = BLAS_SINGLE | BLAS_REAL;
+#else
+  int mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  transa = -1;
+  transb = -1;
+
+  if (TransA == CblasNoTrans)     transa = 0;
+  if (TransA == CblasTrans)       transa = 1;
+  if (TransA == CblasConjNoTrans) transa = 0;
+  if (TransA == CblasConjTrans)   transa = 1;
+  if (TransB == CblasNoTrans)     transb = 0;
+  if (TransB == CblasTrans)       transb = 1;
+  if (TransB == CblasConjNoTrans) transb = 0;
+  if (TransB == CblasConjTrans)   transb = 1;
+
+  split_m = (order == CblasRowMajor);
+
+  info = -1;
+
+  for (i = nrhs - 1; i >= 0; i--) {
+    /* Rows of B_j and C_j as stored */
+    nrow = k;
+    if (transb ^ split_m) nrow = n_array[i];
+    if (ldc_array[i] < MAX(1, split_m ? n_array[i] : m)) info = 14;
+    if (ldb_array[i] < MAX(1, nrow)) info = 11;
+    if (n_array[i] < 0) info = 9;
+  }
+
+  nrow = m;
+  if (transa ^ split_m) nrow = k;
+
+  if (nrhs < 0)            info =  8;
+  if (lda < MAX(1, nrow))  info =  7;
+  if (k < 0)               info =  4;
+  if (m < 0)               info =  3;
+  if (transb < 0)          info =  2;
+  if (transa < 0)          info =  1;
+  if ((order != CblasColMajor) && (order != CblasRowMajor)) info = 0;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((m == 0) || (nrhs == 0)) return;
+
+  rhs = (gemm_rhs_t *)malloc((nrhs + 1) * sizeof(gemm_rhs_t));
+  if (rhs == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+  /* Empty members are left out, so that the offsets keep increasing */
+  total = 0;
+  for (i = 0, j = 0; i < nrhs; i++) {
+    if (n_array[i] == 0) continue;
+    rhs[j].b      = (void *)b_array[i];
+    rhs[j].c      = (void *)c_array[i];
+    rhs[j].ldb    = ldb_array[i];
+    rhs[j].ldc    = ldc_array[i];
+    rhs[j].offset = total;
+    total += n_array[i];
+    j++;
+  }
+  rhs[j].offset = total;
+
+  if (total == 0) {
+    free(rhs);
+    return;
+  }
+
+  multi.nrhs    = j;
+  multi.split_m = split_m;
+  multi.rhs     = rhs;
+
+  IDEBUG_START;
+
+  args.k     = k;
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+  args.c     = NULL;
+  args.ldc   = 0;
+  args.d     = (void *)&multi;
+
+  /* In row major order C_j**T = op(B_j)**T * op(A)**T, so the members
+     become the rows and A the shared right operand                     */
+  if (split_m) {
+    j = transa;
+    transa = transb;
+    transb = j;
+
+    args.m   = total;
+    args.n   = m;
+    args.a   = NULL;
+    args.lda = 0;
+    args.b   = (void *)a;
+    args.ldb = lda;
+  } else {
+    args.m   = m;
+    args.n   = total;
+    args.a   = (void *)a;
+    args.lda = lda;
+    args.b   = NULL;
+    args.ldb = 0;
+  }
+
+  buffer = (XFLOAT *)blas_workspace_alloc();
+
+  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+#ifdef USE_SIMPLE_THREADED_LEVEL3
+  mode |= (transa << BLAS_TRANSA_SHIFT);
+  mode |= (transb << BLAS_TRANSB_SHIFT);
+#endif
+
+  args.nthreads = LEVEL3_NTHREADS(args.m, args.n, args.k, BLAS_L3_SPLIT_MN);
+
+  args.common = NULL;
+
+  if (args.nthreads == 1) {
+#endif
+
+    (gemm_multi_rhs[(transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+    (gemm_multi_rhs[4 | (transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+#else
+    GEMM_THREAD(mode, &args, NULL, NULL, gemm_multi_rhs[(transb << 1) | transa], sa, sb, args.nthreads);
+#endif
+  }
+#endif
+
+  blas_workspace_free(buffer);
+
+  free(rhs);
+
+  IDEBUG_END;
+
+  return;
+}
@@ -0,0 +1,153 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifdef DOUBLE
+#define ERROR_NAME "DGEMM_PACK "
+#else
+#define ERROR_NAME "SGEMM_PACK "
+#endif
+
+#ifdef GET_SIZE
+
+size_t CNAME(enum CBLAS_IDENTIFIER identifier, blasint m, blasint n, blasint k){
+
+  BLASLONG rows, pad;
+
+  PRINT_DEBUG_CNAME;
+
+  if (identifier == CblasAMatrix) rows = m;
+  else if (identifier == CblasBMatrix) rows = n;
+  else return 0;
+
+  if ((rows < 0) || (k < 0)) return 0;
+
+  /* the same buffer must fit both panel layouts, since the storage order
+     (and with it the side a matrix ends up on) is only known at pack time */
+  pad = GEMM_UNROLL_M;
+  if (GEMM_UNROLL_N > pad) pad = GEMM_UNROLL_N;
+
+  return ((sizeof(gemm_pack_t) + GEMM_PACK_ALIGN) & ~GEMM_PACK_ALIGN) + GEMM_PACK_ALIGN + 1
+    + (size_t)k * (size_t)(rows + pad) * sizeof(FLOAT);
+}
+
+#else
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_IDENTIFIER identifier, enum CBLAS_TRANSPOSE Trans,
+	   blasint m, blasint n, blasint k,
+	   FLOAT alpha, FLOAT *src, blasint ld, FLOAT *dest){
+
+  gemm_pack_t *pack = (gemm_pack_t *)dest;
+  FLOAT *buffer;
+  BLASLONG rows, nrows, unroll, ldp, q, ls, min_l;
+  int side, trans;
+  blasint info;
+
+  PRINT_DEBUG_CNAME;
+
+  /* In row major order C**T = B**T * A**T is computed, so A and B swap
+     the side of the kernel they are fed to.                          */
+  side = -1;
+  if (identifier == CblasAMatrix) side = (order == CblasRowMajor) ? GEMM_PACK_OUTER : GEMM_PACK_INNER;
+  if (identifier == CblasBMatrix) side = (order == CblasRowMajor) ? GEMM_PACK_INNER : GEMM_PACK_OUTER;
+
+  trans = -1;
+  if (Trans == CblasNoTrans)     trans = 0;
+  if (Trans == CblasTrans)       trans = 1;
+  if (Trans == CblasConjNoTrans) trans = 0;
+  if (Trans == CblasConjTrans)   trans = 1;
+
+  rows = (identifier == CblasBMatrix) ? n : m;
+
+  if (side == GEMM_PACK_INNER)
+    nrows = trans ? k : rows;
+  else
+    nrows = trans ? rows : k;
+
+  info = -1;
+
+  if (dest == NULL)   info = 10;
+  if (ld < nrows)     info =  9;
+  if (k < 0)          info =  6;
+  if (n < 0)          info =  5;
+  if (m < 0)          info =  4;
+  if (trans < 0)      info =  3;
+  if (side < 0)       info =  2;
+  if ((order != CblasColMajor) && (order != CblasRowMajor)) info = 1;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  unroll = (side == GEMM_PACK_INNER) ? GEMM_UNROLL_M : GEMM_UNROLL_N;
+  ldp    = ((rows + unroll - 1) / unroll) * unroll;
+  q      = GEMM_Q;
+
+  pack -> magic  = GEMM_PACK_MAGIC | SIZE;
+  pack -> side   = side;
+  pack -> rows   = rows;
+  pack -> k      = k;
+  pack -> ld     = ldp;
+  pack -> q      = q;
+  pack -> alpha  = (double)alpha;
+
+  buffer = (FLOAT *)(((BLASLONG)dest + sizeof(gemm_pack_t) + GEMM_PACK_ALIGN) & ~GEMM_PACK_ALIGN);
+  pack -> offset = (BLASLONG)buffer - (BLASLONG)dest;
+
+  if ((rows == 0) || (k == 0)) return;
+
+  for(ls = 0; ls < k; ls += min_l){
+    min_l = k - ls;
+    if (min_l > q) min_l = q;
+
+    if (side == GEMM_PACK_INNER) {
+      if (trans)
+	GEMM_INCOPY(min_l, rows, src + ls, ld, buffer);
+      else
+	GEMM_ITCOPY(min_l, rows, src + ls * ld, ld, buffer);
+    } else {
+      if (trans)
+	GEMM_OTCOPY(min_l, rows, src + ls * ld, ld, buffer);
+      else
+	GEMM_ONCOPY(min_l, rows, src + ls, ld, buffer);
+    }
+
+    buffer += min_l * ldp;
+  }
+}
+
+#endif
@@ -0,0 +1,273 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#define ERROR_NAME "GEMM_S8U8S32 "
+
+/* Columns of op(A)*op(B) staged at once when offsets, alpha or row-major storage need a second pass */
+#define I8GEMM_STAGE_SIZE (1 << 22)
+
+static int (*i8gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG) = {
+  I8GEMM_NN, I8GEMM_TN, I8GEMM_NT, I8GEMM_TT,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  I8GEMM_THREAD_NN, I8GEMM_THREAD_TN, I8GEMM_THREAD_NT, I8GEMM_THREAD_TT,
+#endif
+};
+
+static void i8gemm_driver(blas_arg_t *args, int transa, int transb, IFLOAT *sa, IFLOAT *sb){
+
+#ifdef SMP
+#ifdef USE_SIMPLE_THREADED_LEVEL3
+  int mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+
+  args -> nthreads = LEVEL3_NTHREADS(args -> m, args -> n, args -> k, BLAS_L3_SPLIT_MN);
+
+  args -> common = NULL;
+
+  if (args -> nthreads == 1) {
+#endif
+
+    (i8gemm[(transb << 1) | transa])(args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+    (i8gemm[4 | (transb << 1) | transa])(args, NULL, NULL, sa, sb, 0);
+#else
+    mode |= (transa << BLAS_TRANSA_SHIFT);
+    mode |= (transb << BLAS_TRANSB_SHIFT);
+    gemm_thread_n(mode, args, NULL, NULL, (void *)i8gemm[(transb << 1) | transa], sa, sb, args -> nthreads);
+#endif
+  }
+#endif
+}
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   enum CBLAS_OFFSET OffsetC,
+	   blasint m, blasint n, blasint k,
+	   float alpha,
+	   void *a, blasint lda, int8_t ao,
+	   void *b, blasint ldb, int8_t bo,
+	   float beta,
+	   int32_t *c, blasint ldc, int32_t *co){
+
+  blas_arg_t args;
+  int transa, transb, offset;
+  blasint nrowa, nrowb, nrowc, info;
+
+  unsigned char *pa = (unsigned char *)a;
+  signed char   *pb = (signed char   *)b;
+
+  BLASLONG i, j, l, js, min_j;
+  int32_t *t, *cc;
+  BLASLONG *rowsum, *colsum;
+  double corr, val;
+  float one = ONE, zero = ZERO;
+
+  XFLOAT *buffer;
+  XFLOAT *sa, *sb;
+
+  PRINT_DEBUG_CNAME;
+
+  transa = -1;
+  transb = -1;
+  offset = -1;
+  info   = -1;
+
+  if (TransA == CblasNoTrans)     transa = 0;
+  if (TransA == CblasTrans)       transa = 1;
+  if (TransA == CblasConjNoTrans) transa = 0;
+  if (TransA == CblasConjTrans)   transa = 1;
+
+  if (TransB == CblasNoTrans)     transb = 0;
+  if (TransB == CblasTrans)       transb = 1;
+  if (TransB == CblasConjNoTrans) transb = 0;
+  if (TransB == CblasConjTrans)   transb = 1;
+
+  if (OffsetC == CblasFixOffset)  offset = 0;
+  if (OffsetC == CblasColOffset)  offset = 1;
+  if (OffsetC == CblasRowOffset)  offset = 2;
+
+  /* A is unsigned and B signed, so a row-major product can not be turned into
+     the transposed column-major one by swapping the operands; read the
+     row-major operands as transposed column-major ones instead */
+  nrowc = m;
+  if (order == CblasRowMajor) {
+    if (transa >= 0) transa ^= 1;
+    if (transb >= 0) transb ^= 1;
+    nrowc = n;
+  }
+
+  nrowa = m;
+  if (transa & 1) nrowa = k;
+  nrowb = k;
+  if (transb & 1) nrowb = n;
+
+  if (ldc < MAX(1, nrowc)) info = 16;
+  if (ldb < MAX(1, nrowb)) info = 12;
+  if (lda < MAX(1, nrowa)) info =  9;
+  if (k < 0)       info =  6;
+  if (n < 0)       info =  5;
+  if (m < 0)       info =  4;
+  if (offset < 0)  info =  3;
+  if (transb < 0)  info =  2;
+  if (transa < 0)  info =  1;
+  if ((order != CblasColMajor) && (order != CblasRowMajor)) info = 0;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((m == 0) || (n == 0)) return;
+
+  IDEBUG_START;
+
+  buffer = (XFLOAT *)blas_workspace_alloc();
+
+  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+  args.m   = m;
+  args.k   = k;
+  args.a   = (void *)a;
+  args.lda = lda;
+  args.ldb = ldb;
+
+  if ((order == CblasColMajor) && (alpha == ONE) && (ao == 0) && (bo == 0)) {
+
+    /* Plain product: the kernels accumulate straight into C */
+    args.n     = n;
+    args.b     = (void *)b;
+    args.c     = (void *)c;
+    args.ldc   = ldc;
+    args.alpha = (void *)&one;
+    args.beta  = (void *)&beta;
+
+    i8gemm_driver(&args, transa, transb, sa, sb);
+
+    for (j = 0; j < n; j++) {
+      cc = c + j * ldc;
+      for (i = 0; i < m; i++) {
+	if (offset == 0) cc[i] += co[0];
+	if (offset == 1) cc[i] += co[i];
+	if (offset == 2) cc[i] += co[j];
+      }
+    }
+
+    blas_workspace_free(buffer);
+
+    IDEBUG_END;
+
+    return;
+  }
+
+  min_j = I8GEMM_STAGE_SIZE / m;
+  if (min_j < 1) min_j = 1;
+  if (min_j > n) min_j = n;
+
+  /* The sums are kept in 64 bits, a row of A can add up to 255 * k */
+  rowsum = (BLASLONG *)malloc(sizeof(BLASLONG) * (m + n));
+  t      = NULL;
+  while (rowsum != NULL) {
+    t = (int32_t *)malloc(sizeof(int32_t) * m * min_j);
+    if ((t != NULL) || (min_j == 1)) break;
+    min_j = (min_j + 1) / 2;
+  }
+  if (t == NULL) {
+    free(rowsum);
+    blas_workspace_free(buffer);
+    info = 17;
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+  colsum = rowsum + m;
+
+  /* (A + ao)(B + bo) = AB + bo * rowsum(A) + ao * colsum(B) + k * ao * bo */
+  for (i = 0; i < m; i++) {
+    rowsum[i] = 0;
+    if (bo != 0) {
+      for (l = 0; l < k; l++) rowsum[i] += (transa ? pa[l + i * lda] : pa[i + l * lda]);
+    }
+  }
+  for (j = 0; j < n; j++) {
+    colsum[j] = 0;
+    if (ao != 0) {
+      for (l = 0; l < k; l++) colsum[j] += (transb ? pb[j + l * ldb] : pb[l + j * ldb]);
+    }
+  }
+
+  args.c     = (void *)t;
+  args.ldc   = m;
+  args.alpha = (void *)&one;
+  args.beta  = (void *)&zero;
+
+  for (js = 0; js < n; js += min_j) {
+
+    if (min_j > n - js) min_j = n - js;
+
+    args.n = min_j;
+    args.b = (void *)(transb ? pb + js : pb + js * ldb);
+
+    i8gemm_driver(&args, transa, transb, sa, sb);
+
+    for (j = js; j < js + min_j; j++) {
+      for (i = 0; i < m; i++) {
+	corr = (double)bo * rowsum[i] + (double)ao * colsum[j] + (double)k * ao * bo;
+	val  = (double)alpha * ((double)t[i + (j - js) * m] + corr);
+
+	if (order == CblasColMajor) cc = c + i + j * ldc; else cc = c + j + i * ldc;
+	if (beta != ZERO) val += (double)beta * *cc;
+
+	if (offset == 0) val += co[0];
+	if (offset == 1) val += co[i];
+	if (offset == 2) val += co[j];
+
+	*cc = i8gemm_round(val);
+      }
+    }
+  }
+
+  free(t);
+  free(rowsum);
+
+  blas_workspace_free(buffer);
+
+  IDEBUG_END;
+
+  return;
+}
@@ -226,10 +226,15 @@ void CNAME(enum CBLAS_ORDER order,
 
 #ifdef SMP
 
+  /* past the cut-off, one thread for every half of it, so that mid-sized
+     problems are not spread over threads that each get too little of A */
   if ( 1L * m * n < 115200L * GEMM_MULTITHREAD_THRESHOLD )
     nthreads = 1;
-  else
+  else {
     nthreads = num_cpu_avail(2);
+    if (nthreads > 1L * m * n / (57600L * GEMM_MULTITHREAD_THRESHOLD))
+      nthreads = 1L * m * n / (57600L * GEMM_MULTITHREAD_THRESHOLD);
+  }
 
   if (nthreads == 1) {
 #endif
@@ -0,0 +1,403 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+void openblas_warning(int verbose, const char * msg);
+
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define ERROR_PREFIX "DGEMV_BATCH"
+#else
+#define ERROR_PREFIX "SGEMV_BATCH"
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_PREFIX "ZGEMV_BATCH"
+#else
+#define ERROR_PREFIX "CGEMV_BATCH"
+#endif
+#endif
+
+#ifdef STRIDED
+#define ERROR_NAME ERROR_PREFIX "_STRIDED "
+#else
+#define ERROR_NAME ERROR_PREFIX " "
+#endif
+
+/* Below this much of A per thread the members are run one after the other */
+#define GEMV_BATCH_MIN	(57600L * GEMM_MULTITHREAD_THRESHOLD / (COMPSIZE * COMPSIZE))
+
+/* y = alpha*op(A)*x + beta*y for one member, with op() selected by args->k */
+static int gemv_member(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		       FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *x = (FLOAT *)args -> b;
+  FLOAT *y = (FLOAT *)args -> c;
+  BLASLONG m = args -> m;
+  BLASLONG n = args -> n;
+  BLASLONG lda  = args -> lda;
+  BLASLONG incx = args -> ldb;
+  BLASLONG incy = args -> ldc;
+  int trans = (int)args -> k;
+  BLASLONG lenx, leny;
+
+#ifndef COMPLEX
+  FLOAT alpha = *((FLOAT *)args -> alpha);
+  FLOAT beta  = *((FLOAT *)args -> beta);
+
+  int (*gemv[])(BLASLONG, BLASLONG, BLASLONG, FLOAT, FLOAT *, BLASLONG,  FLOAT * , BLASLONG, FLOAT *, BLASLONG, FLOAT *) = {
+    GEMV_N, GEMV_T,
+  };
+
+  lenx = n;
+  leny = m;
+  if (trans) lenx = m;
+  if (trans) leny = n;
+
+  if (beta != ONE) SCAL_K(leny, 0, 0, beta, y, blasabs(incy), NULL, 0, NULL, 0);
+
+  if (alpha == ZERO) return 0;
+
+  if (incx < 0) x -= (lenx - 1) * incx;
+  if (incy < 0) y -= (leny - 1) * incy;
+
+  (gemv[trans])(m, n, 0, alpha, a, lda, x, incx, y, incy, sb);
+#else
+  FLOAT alpha_r = *((FLOAT *)args -> alpha + 0);
+  FLOAT alpha_i = *((FLOAT *)args -> alpha + 1);
+  FLOAT beta_r  = *((FLOAT *)args -> beta  + 0);
+  FLOAT beta_i  = *((FLOAT *)args -> beta  + 1);
+
+  int (*gemv[])(BLASLONG, BLASLONG, BLASLONG, FLOAT, FLOAT, FLOAT *, BLASLONG,
+	    FLOAT * , BLASLONG, FLOAT *, BLASLONG, FLOAT *) = {
+	      GEMV_N, GEMV_T, GEMV_R, GEMV_C,
+	      GEMV_O, GEMV_U, GEMV_S, GEMV_D,
+	    };
+
+  lenx = n;
+  leny = m;
+  if (trans & 1) lenx = m;
+  if (trans & 1) leny = n;
+
+  if (beta_r != ONE || beta_i != ZERO) SCAL_K(leny, 0, 0, beta_r, beta_i, y, blasabs(incy), NULL, 0, NULL, 0);
+
+  if (alpha_r == ZERO && alpha_i == ZERO) return 0;
+
+  if (incx < 0) x -= (lenx - 1) * incx * 2;
+  if (incy < 0) y -= (leny - 1) * incy * 2;
+
+#if defined(ARCH_X86_64)
+  // cgemv_t.S return NaN if there are NaN or Inf in the buffer (see bug #746)
+  if (trans & 1)
+    memset(sb, 0, MIN(BUFFER_SIZE, sizeof(FLOAT) * (2 * (m + n) + 128 / sizeof(FLOAT))));
+#endif
+
+  (gemv[trans])(m, n, 0, alpha_r, alpha_i, a, lda, x, incx, y, incy, sb);
+#endif
+
+  return 0;
+}
+
+/* Maps the CBLAS transpose to the column major gemv kernel, -1 if invalid */
+static int gemv_trans(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA){
+
+  int trans = -1;
+
+  if (order == CblasColMajor) {
+    if (TransA == CblasNoTrans)     trans = 0;
+    if (TransA == CblasTrans)       trans = 1;
+#ifndef COMPLEX
+    if (TransA == CblasConjNoTrans) trans = 0;
+    if (TransA == CblasConjTrans)   trans = 1;
+#else
+    if (TransA == CblasConjNoTrans) trans = 2;
+    if (TransA == CblasConjTrans)   trans = 3;
+#endif
+  }
+
+  if (order == CblasRowMajor) {
+    if (TransA == CblasNoTrans)     trans = 1;
+    if (TransA == CblasTrans)       trans = 0;
+#ifndef COMPLEX
+    if (TransA == CblasConjNoTrans) trans = 1;
+    if (TransA == CblasConjTrans)   trans = 0;
+#else
+    if (TransA == CblasConjNoTrans) trans = 3;
+    if (TransA == CblasConjTrans)   trans = 2;
+#endif
+  }
+
+  return trans;
+}
+
+#ifndef STRIDED
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE * trans_array,
+	   blasint * m_array, blasint * n_array,
+#ifndef COMPLEX
+	   FLOAT * alpha_array,
+	   FLOAT ** a_array, blasint * lda_array,
+	   FLOAT ** x_array, blasint * incx_array,
+	   FLOAT * beta_array,
+	   FLOAT ** y_array, blasint * incy_array,
+#else
+	   void * valpha_array,
+	   void ** va_array, blasint * lda_array,
+	   void ** vx_array, blasint * incx_array,
+	   void * vbeta_array,
+	   void ** vy_array, blasint * incy_array,
+#endif
+	   blasint group_count, blasint * group_size){
+
+#ifdef COMPLEX
+  FLOAT * alpha_array = (FLOAT *)valpha_array;
+  FLOAT * beta_array  = (FLOAT *)vbeta_array;
+  FLOAT ** a_array = (FLOAT **)va_array;
+  FLOAT ** x_array = (FLOAT **)vx_array;
+  FLOAT ** y_array = (FLOAT **)vy_array;
+#endif
+
+  blas_arg_t * args_array = NULL;
+  int mode = 0, trans;
+  blasint i, j, info, matrix_idx = 0, count = 0, total_num = 0;
+  BLASLONG m, n;
+
+  PRINT_DEBUG_CNAME;
+
+  info = -1;
+
+  if (group_count < 0) info = 12;
+  for (i = 0; i < group_count; i++) {
+    if (group_size[i] < 0) info = 13;
+    else total_num += group_size[i];
+  }
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (total_num == 0) return;
+
+  args_array = (blas_arg_t *)malloc(total_num * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  for (i = 0; i < group_count; matrix_idx += group_size[i], i++) {
+
+    trans = gemv_trans(order, trans_array[i]);
+
+    m = m_array[i];
+    n = n_array[i];
+    if (order == CblasRowMajor) {
+      m = n_array[i];
+      n = m_array[i];
+    }
+
+    info = -1;
+
+    if (incy_array[i] == 0)        info = 11;
+    if (incx_array[i] == 0)        info =  8;
+    if (lda_array[i] < MAX(1, m))  info =  6;
+    if (n < 0)                     info =  3;
+    if (m < 0)                     info =  2;
+    if (trans < 0)                 info =  1;
+
+    if (info >= 0) {
+      BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+      free(args_array);
+      return;
+    }
+
+    if (m == 0 || n == 0) continue;
+
+    for (j = 0; j < group_size[i]; j++) {
+      args_array[count].m = m;
+      args_array[count].n = n;
+      args_array[count].k = trans;
+      args_array[count].a = (void *)a_array[matrix_idx + j];
+      args_array[count].b = (void *)x_array[matrix_idx + j];
+      args_array[count].c = (void *)y_array[matrix_idx + j];
+      args_array[count].lda = lda_array[i];
+      args_array[count].ldb = incx_array[i];
+      args_array[count].ldc = incy_array[i];
+      args_array[count].alpha = (void *)&alpha_array[i * COMPSIZE];
+      args_array[count].beta  = (void *)&beta_array[i * COMPSIZE];
+      args_array[count].routine = (void *)gemv_member;
+      args_array[count].routine_mode = mode;
+      count++;
+    }
+  }
+
+  if (count > 0) blas_batch_thread(args_array, count, GEMV_BATCH_MIN, 1);
+
+  free(args_array);
+}
+
+#else
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA,
+	   blasint m, blasint n,
+#ifndef COMPLEX
+	   FLOAT alpha,
+	   FLOAT *a, blasint lda, blasint stride_a,
+	   FLOAT *x, blasint incx, blasint stride_x,
+	   FLOAT beta,
+	   FLOAT *y, blasint incy, blasint stride_y,
+#else
+	   void *valpha,
+	   void *va, blasint lda, blasint stride_a,
+	   void *vx, blasint incx, blasint stride_x,
+	   void *vbeta,
+	   void *vy, blasint incy, blasint stride_y,
+#endif
+	   blasint batch_size){
+
+#ifndef COMPLEX
+  void *alpha_p = (void *)&alpha;
+  void *beta_p  = (void *)&beta;
+#else
+  void *alpha_p = valpha;
+  void *beta_p  = vbeta;
+  FLOAT *a = (FLOAT *)va;
+  FLOAT *x = (FLOAT *)vx;
+  FLOAT *y = (FLOAT *)vy;
+#endif
+
+  blas_arg_t * args_array = NULL;
+  int mode = 0, trans;
+  blasint i, info, t;
+  BLASLONG leny;
+
+  PRINT_DEBUG_CNAME;
+
+  trans = gemv_trans(order, TransA);
+
+  if (order == CblasRowMajor) {
+    t = n;
+    n = m;
+    m = t;
+  }
+
+  leny = m;
+  if (trans & 1) leny = n;
+
+  info = -1;
+
+  if (batch_size < 0)   info = 15;
+  if ((batch_size > 1) && (stride_y < 1 + (leny - 1) * blasabs(incy))) info = 14;
+  if (incy == 0)        info = 13;
+  if (stride_x < 0)     info = 10;
+  if (incx == 0)        info =  9;
+  if (stride_a < 0)     info =  7;
+  if (lda < MAX(1, m))  info =  6;
+  if (n < 0)            info =  3;
+  if (m < 0)            info =  2;
+  if (trans < 0)        info =  1;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (m == 0 || n == 0 || batch_size == 0) return;
+
+  args_array = (blas_arg_t *)malloc(batch_size * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  for (i = 0; i < batch_size; i++) {
+    args_array[i].m = m;
+    args_array[i].n = n;
+    args_array[i].k = trans;
+    args_array[i].a = (void *)(a + (BLASLONG)i * stride_a * COMPSIZE);
+    args_array[i].b = (void *)(x + (BLASLONG)i * stride_x * COMPSIZE);
+    args_array[i].c = (void *)(y + (BLASLONG)i * stride_y * COMPSIZE);
+    args_array[i].lda = lda;
+    args_array[i].ldb = incx;
+    args_array[i].ldc = incy;
+    args_array[i].alpha = alpha_p;
+    args_array[i].beta  = beta_p;
+    args_array[i].routine = (void *)gemv_member;
+    args_array[i].routine_mode = mode;
+  }
+
+  blas_batch_thread(args_array, batch_size, GEMV_BATCH_MIN, 1);
+
+  free(args_array);
+}
+
+#endif
@@ -32,6 +32,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "common.h"
 #ifdef FUNCTION_PROFILE
 #include "functable.h"
@@ -54,6 +55,81 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* Enables the New IMATCOPY code with inplace operation if lda == ldb   */
 #define NEW_IMATCOPY
 
+/* Moves the columns of the m x n column major matrix a from leading dimension lda
+   to ldb in place, scaling them by alpha */
+static void imatcopy_move(BLASLONG m, BLASLONG n, FLOAT alpha, FLOAT *a, BLASLONG lda, BLASLONG ldb)
+{
+	BLASLONG i, j;
+
+	if (ldb < lda) {
+		for (j = 0; j < n; j++)
+			for (i = 0; i < m; i++)
+				a[i + j * ldb] = alpha * a[i + j * lda];
+	} else if (ldb > lda) {
+		for (j = n - 1; j >= 0; j--)
+			for (i = m - 1; i >= 0; i--)
+				a[i + j * ldb] = alpha * a[i + j * lda];
+	} else if (alpha != ONE) {
+		for (j = 0; j < n; j++)
+			for (i = 0; i < m; i++)
+				a[i + j * lda] *= alpha;
+	}
+}
+
+/* Clears the m x n result at leading dimension ldb for alpha == 0, whatever a held */
+static void imatcopy_zero(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG ldb)
+{
+	BLASLONG i, j;
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++)
+			a[i + j * ldb] = ZERO;
+}
+
+/* Positions of a window of imatcopy_cycles, marked in a bitmap on the stack */
+#define IMATCOPY_WINDOW 32768
+
+/* Replaces the m x n column major matrix stored contiguously at a by alpha times its
+   n x m transpose. Element i + j * m moves to j + i * n, and each cycle of that
+   permutation is moved once, from its smallest position. The positions are taken in
+   windows of IMATCOPY_WINDOW; a bitmap marks those of the window that a cycle has
+   already moved, and any other start is moved only if walking its cycle meets no
+   smaller position. The scratch space stays the same whatever m * n. */
+static void imatcopy_cycles(BLASLONG m, BLASLONG n, FLOAT alpha, FLOAT *a)
+{
+	BLASLONG last = m * n - 1;
+	BLASLONG base, end, start, p, q;
+	unsigned char done[IMATCOPY_WINDOW / 8];
+	FLOAT t, u;
+
+	a[0] *= alpha;
+	if (last > 0) a[last] *= alpha;
+
+	for (base = 1; base < last; base += IMATCOPY_WINDOW) {
+		end = MIN(base + IMATCOPY_WINDOW, last);
+		memset(done, 0, sizeof(done));
+
+		for (start = base; start < end; start++) {
+			if (done[(start - base) >> 3] & (1 << ((start - base) & 7))) continue;
+
+			q = (start % m) * n + start / m;
+			while (q > start) q = (q % m) * n + q / m;
+			if (q < start) continue;
+
+			t = a[start];
+			p = start;
+			do {
+				q = (p % m) * n + p / m;
+				u = a[q];
+				a[q] = alpha * t;
+				t = u;
+				if (q < end) done[(q - base) >> 3] |= 1 << ((q - base) & 7);
+				p = q;
+			} while (p != start);
+		}
+	}
+}
+
 #ifndef CBLAS
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, blasint *ldb)
 {
@@ -61,8 +137,7 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
-	FLOAT *b;
-	size_t msize;
+	BLASLONG m, n;
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -81,8 +156,7 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 {
 	int order=-1,trans=-1;
 	blasint info = -1;
-	FLOAT *b;
-	size_t msize;
+	BLASLONG m, n;
 	blasint *lda, *ldb, *rows, *cols; 
 	FLOAT *alpha; 
 
@@ -154,46 +228,39 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
     }
 #endif
 
-	if ( *rows >  *cols )
-            msize = (size_t)(*rows) * (*ldb)  * sizeof(FLOAT);
-    else
-            msize = (size_t)(*cols) * (*ldb)  * sizeof(FLOAT);
-
-	b = malloc(msize);
-	if ( b == NULL )
+	/* everything else is done in place: viewed as column major, a is packed to
+	   leading dimension m, permuted into its transpose and spread out to ldb */
+	if ( order == BlasColMajor )
 	{
-		printf("Memory alloc failed in imatcopy\n");
-		exit(1);
+		m = *rows;
+		n = *cols;
+	}
+	else
+	{
+		m = *cols;
+		n = *rows;
 	}
 
-	if ( order == BlasColMajor )
+	if ( *alpha == ZERO )
 	{
 		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_CN(*rows, *cols, *alpha, a, *lda, b, *rows );
-			OMATCOPY_K_CN(*rows, *cols, (FLOAT) 1.0 , b, *rows, a, *ldb );
-		}
+			imatcopy_zero(m, n, a, *ldb);
 		else
-		{
-			OMATCOPY_K_CT(*rows, *cols, *alpha, a, *lda, b, *cols );
-			OMATCOPY_K_CN(*cols, *rows, (FLOAT) 1.0, b, *cols, a, *ldb );
-		}
+			imatcopy_zero(n, m, a, *ldb);
+		return;
+	}
+
+	if ( trans == BlasNoTrans )
+	{
+		imatcopy_move(m, n, *alpha, a, *lda, *ldb);
 	}
 	else
 	{
-		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_RN(*rows, *cols, *alpha, a, *lda, b, *cols );
-			OMATCOPY_K_RN(*rows, *cols, (FLOAT) 1.0, b, *cols, a, *ldb );
-		}
-		else
-		{
-			OMATCOPY_K_RT(*rows, *cols, *alpha, a, *lda, b, *rows );
-			OMATCOPY_K_RN(*cols, *rows, (FLOAT) 1.0, b, *rows, a, *ldb );
-		}
+		imatcopy_move(m, n, ONE, a, *lda, m);
+		imatcopy_cycles(m, n, *alpha, a);
+		imatcopy_move(n, m, ONE, a, n, *ldb);
 	}
 
-	free(b);
 	return;
 
 }
@@ -0,0 +1,296 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#define ERROR_NAME "DSGESV"
+
+/* Refinement steps before the solve is redone in double precision, */
+/* and the backward error accepted, as in LAPACK's DSGESV.           */
+#define ITERMAX 30
+#define BWDMAX  1.0
+
+static double dm1 = -1.;
+static double dp1 =  1.;
+
+/* Round an m x n double matrix to single precision; fails if an */
+/* entry would overflow.                                          */
+static int dlag2s(BLASLONG m, BLASLONG n, double *a, BLASLONG lda, float *sa, BLASLONG ldsa){
+
+  BLASLONG i, j;
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < m; i++) {
+      if (fabs(a[i + j * lda]) > FLT_MAX) return 1;
+      sa[i + j * ldsa] = (float)a[i + j * lda];
+    }
+  }
+
+  return 0;
+}
+
+/* r = b - a * x, by columns of the right-hand side */
+static void residual(blas_arg_t *args, double *b, BLASLONG ldb, double *x, BLASLONG ldx,
+		     double *r, double *sa, double *sb){
+
+  BLASLONG n = args -> m, j;
+
+  for (j = 0; j < args -> n; j++) COPY_K(n, b + j * ldb, 1, r + j * n, 1);
+
+  args -> k     = n;
+  args -> b     = (void *)x;
+  args -> ldb   = ldx;
+  args -> c     = (void *)r;
+  args -> ldc   = n;
+  args -> alpha = (void *)&dm1;
+  args -> beta  = (void *)&dp1;
+
+#ifdef SMP
+  if (args -> nthreads > 1)
+    GEMM_THREAD_NN(args, NULL, NULL, sa, sb, 0);
+  else
+#endif
+    GEMM_NN(args, NULL, NULL, sa, sb, 0);
+}
+
+/* Every column has |r|_max <= |x|_max * cte */
+static int converged(BLASLONG n, BLASLONG nrhs, double *x, BLASLONG ldx, double *r, double cte){
+
+  BLASLONG j;
+
+  for (j = 0; j < nrhs; j++)
+    if (AMAX_K(n, r + j * n, 1) > AMAX_K(n, x + j * ldx, 1) * cte) return 0;
+
+  return 1;
+}
+
+int NAME(blasint *N, blasint *NRHS, double *a, blasint *ldA, blasint *ipiv,
+	 double *b, blasint *ldB, double *x, blasint *ldX, double *work, float *swork,
+	 blasint *Iter, blasint *Info){
+
+  blas_arg_t args, sargs;
+
+  blasint info, iter;
+  BLASLONG n, nrhs, lda, ldb, ldx, i, j;
+  double anrm, cte;
+  float *sx;
+  void *buffer;
+#ifdef PPC440
+  extern
+#endif
+  double *sa, *sb;
+  float *ssa, *ssb;
+
+  PRINT_DEBUG_NAME;
+
+  n    = *N;
+  nrhs = *NRHS;
+  lda  = *ldA;
+  ldb  = *ldB;
+  ldx  = *ldX;
+
+  info  = 0;
+  if (ldx  < MAX(1, n)) info = 9;
+  if (ldb  < MAX(1, n)) info = 7;
+  if (lda  < MAX(1, n)) info = 4;
+  if (nrhs < 0)         info = 2;
+  if (n    < 0)         info = 1;
+
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  *Iter = 0;
+  *Info = 0;
+
+  if (n == 0 || nrhs == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  /* The tolerance uses the infinity norm of A, with WORK as row sums */
+  for (i = 0; i < n; i++) work[i] = ZERO;
+  for (j = 0; j < n; j++)
+    for (i = 0; i < n; i++) work[i] += fabs(a[i + j * lda]);
+  anrm = ZERO;
+  for (i = 0; i < n; i++) anrm = MAX(anrm, work[i]);
+  cte = anrm * (DBL_EPSILON * 0.5) * sqrt((double)n) * BWDMAX;
+
+#ifndef PPC440
+  buffer = blas_memory_alloc(1);
+
+  sa  = (double *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb  = (double *)(((BLASLONG)sa + ((DGEMM_P * DGEMM_Q * sizeof(double) + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+  ssa = (float  *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  ssb = (float  *)(((BLASLONG)ssa + ((SGEMM_P * SGEMM_Q * sizeof(float) + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#else
+  ssa = (float  *)sa;
+  ssb = (float  *)sb;
+#endif
+
+  /* The single precision copy of A is factored in SWORK, followed by */
+  /* the right-hand sides and corrections.                            */
+  sx = swork + n * n;
+
+  args.m    = n;
+  args.n    = nrhs;
+  args.a    = (void *)a;
+  args.lda  = lda;
+
+  sargs.m   = n;
+  sargs.n   = n;
+  sargs.a   = (void *)swork;
+  sargs.lda = n;
+  sargs.c   = (void *)ipiv;
+  sargs.alpha = NULL;
+  sargs.beta  = NULL;
+
+#ifdef SMP
+  args.common  = NULL;
+  sargs.common = NULL;
+
+  if (n * n < 40000) {
+    args.nthreads = 1;
+  } else {
+    args.nthreads = num_cpu_avail(4);
+    if ((n * n) / args.nthreads < 40000)
+      args.nthreads = (n * n) / 40000;
+  }
+  sargs.nthreads = args.nthreads;
+#endif
+
+  iter = -2;
+  if (dlag2s(n, nrhs, b, ldb, sx, n) || dlag2s(n, n, a, lda, swork, n)) goto fallback;
+
+#ifdef SMP
+  if (sargs.nthreads > 1)
+    info = sgetrf_parallel(&sargs, NULL, NULL, ssa, ssb, 0);
+  else
+#endif
+    info = sgetrf_single(&sargs, NULL, NULL, ssa, ssb, 0);
+
+  iter = -3;
+  if (info) goto fallback;
+
+  sargs.n   = nrhs;
+  sargs.b   = (void *)sx;
+  sargs.ldb = n;
+
+  for (iter = 0; iter <= ITERMAX; iter++) {
+
+    if (iter > 0) {
+      if (dlag2s(n, nrhs, work, n, sx, n)) {
+	iter = -2;
+	goto fallback;
+      }
+    }
+
+#ifdef SMP
+    if (sargs.nthreads > 1)
+      sgetrs_N_parallel(&sargs, NULL, NULL, ssa, ssb, 0);
+    else
+#endif
+      sgetrs_N_single(&sargs, NULL, NULL, ssa, ssb, 0);
+
+    /* The first solve gives X, later ones its corrections */
+    for (j = 0; j < nrhs; j++)
+      for (i = 0; i < n; i++) {
+	if (iter == 0)
+	  x[i + j * ldx]  = (double)sx[i + j * n];
+	else
+	  x[i + j * ldx] += (double)sx[i + j * n];
+      }
+
+    residual(&args, b, ldb, x, ldx, work, sa, sb);
+
+    if (converged(n, nrhs, x, ldx, work, cte)) goto done;
+  }
+
+  iter = -ITERMAX - 1;
+
+ fallback:
+
+  args.n    = n;
+  args.a    = (void *)a;
+  args.lda  = lda;
+  args.c    = (void *)ipiv;
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+#ifdef SMP
+  if (args.nthreads > 1)
+    info = GETRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+  else
+#endif
+    info = GETRF_SINGLE(&args, NULL, NULL, sa, sb, 0);
+
+  if (info == 0) {
+    for (j = 0; j < nrhs; j++) COPY_K(n, b + j * ldb, 1, x + j * ldx, 1);
+
+    args.n   = nrhs;
+    args.b   = (void *)x;
+    args.ldb = ldx;
+
+#ifdef SMP
+    if (args.nthreads > 1)
+      GETRS_N_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+    else
+#endif
+      GETRS_N_SINGLE(&args, NULL, NULL, sa, sb, 0);
+  }
+
+ done:
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  *Iter = iter;
+  *Info = info;
+
+  FUNCTION_PROFILE_END(1, n * n, 2. / 3. * n * n * n + 2. * n * n * nrhs * (iter > 0 ? iter + 1 : 1));
+
+  IDEBUG_END;
+
+  return 0;
+}
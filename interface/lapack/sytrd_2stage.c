@@ -0,0 +1,204 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifdef XDOUBLE
+#define ERROR_NAME "QSYTRD_2STAGE"
+#elif defined(DOUBLE)
+#define ERROR_NAME "DSYTRD_2STAGE"
+#else
+#define ERROR_NAME "SSYTRD_2STAGE"
+#endif
+
+/* Only the *_2stage drivers come through here. ?syevd, ?syevr and the  */
+/* other one-stage drivers keep calling the reference ?sytrd, whose n-1 */
+/* reflectors they hand to ?orgtr/?ormtr; a two-stage reduction can not */
+/* produce those, and their JOBZ='N' paths are left as LAPACK has them. */
+
+/* Bandwidth of the first stage that ILAENV2STAGE picks for one thread. */
+/* LWORK is checked against the size LAPACK asks for with it, and a     */
+/* work array too short for the bandwidth used here is replaced.        */
+#define KD_MIN 32
+
+static blasint (*sy2sb[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  SYTRD_SY2SB_U, SYTRD_SY2SB_L,
+};
+
+static blasint (*sb2st[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  SYTRD_SB2ST_U, SYTRD_SB2ST_L,
+};
+
+int NAME(char *VECT, char *UPLO, blasint *N, FLOAT *a, blasint *ldA, FLOAT *d, FLOAT *e,
+	 FLOAT *tau, FLOAT *hous2, blasint *lHous2, FLOAT *work, blasint *lWork, blasint *Info){
+
+  blas_arg_t args;
+
+  blasint vect_arg = *VECT;
+  blasint uplo_arg = *UPLO;
+  blasint uplo;
+  blasint info;
+  BLASLONG n, kd, lhmin, lwmin, lwkopt, stage1, stage2;
+  FLOAT *ab, *buffer, *wbuffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  n = *N;
+
+  TOUPPER(vect_arg);
+  TOUPPER(uplo_arg);
+
+  uplo = -1;
+  if (uplo_arg == 'U') uplo = 0;
+  if (uplo_arg == 'L') uplo = 1;
+
+  kd = KD_MIN;
+
+#ifdef SMP
+  args.nthreads = 1;
+  if (n >= 256) {
+    args.nthreads = num_cpu_avail(4);
+    if (n / args.nthreads < 256) args.nthreads = n / 256;
+  }
+
+  /* Wider bands keep the first stage in GEMM when it is threaded */
+  if (args.nthreads > 4) kd = 160;
+  else if (args.nthreads > 1) kd = 64;
+#endif
+
+  lhmin = MAX(1, 4 * n);
+  lwmin = n * KD_MIN + n * (KD_MIN + 1) + 2 * KD_MIN * KD_MIN + (KD_MIN + 1) * n;
+  if (n == 0) {
+    lhmin = 1;
+    lwmin = 1;
+  }
+
+  /* AB, then the larger of the two stages' workspaces */
+  stage1 = 2 * n * kd + 2 * kd * kd + QR_NB * (QR_NB + kd);
+  stage2 = (2 * kd + 1) * n;
+  lwkopt = MAX(lwmin, (kd + 1) * n + MAX(stage1, stage2));
+
+  info  =    0;
+  if (*lWork  < lwmin && *lWork != -1 && *lHous2 != -1) info = 12;
+  if (*lHous2 < lhmin && *lWork != -1 && *lHous2 != -1) info = 10;
+  if (*ldA < MAX(1, n))  info =  5;
+  if (n < 0)             info =  3;
+  if (uplo < 0)          info =  2;
+  if (vect_arg != 'N')   info =  1;
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  hous2[0] = (FLOAT)lhmin;
+  work[0]  = (FLOAT)lwkopt;
+
+  *Info = 0;
+  if (*lWork == -1 || *lHous2 == -1) return 0;
+  if (n == 0) {
+    work[0] = ONE;
+    return 0;
+  }
+
+  wbuffer = NULL;
+  if (*lWork >= lwkopt) {
+    ab = work;
+  } else {
+    wbuffer = (FLOAT *)malloc(lwkopt * sizeof(FLOAT));
+    if (wbuffer == NULL) {
+      info = 12;
+      BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+      *Info = - info;
+      return 0;
+    }
+    ab = wbuffer;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+#ifdef SMP
+  args.common = NULL;
+#endif
+
+  args.n   = n;
+  args.k   = kd;
+  args.a   = (void *)a;
+  args.lda = *ldA;
+  args.b   = (void *)ab;
+  args.ldb = kd + 1;
+  args.c   = (void *)tau;
+  args.d   = (void *)(ab + (kd + 1) * n);
+
+  (sy2sb[uplo])(&args, NULL, NULL, sa, sb, 0);
+
+  args.a   = (void *)ab;
+  args.lda = kd + 1;
+  args.b   = (void *)d;
+  args.c   = (void *)e;
+
+  (sb2st[uplo])(&args, NULL, NULL, sa, sb, 0);
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  if (wbuffer) free(wbuffer);
+
+  work[0] = (FLOAT)lwkopt;
+
+  FUNCTION_PROFILE_END(1, .5 * n * n, 4. / 3. * n * n * n + 6. * n * n * kd);
+
+  IDEBUG_END;
+
+  return 0;
+}
@@ -47,6 +47,22 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define BlasNoTrans  0
 #define BlasTrans    1
 
+#ifdef SMP
+/* Copies a slice of the outer dimension of a (columns in column major order, rows in
+   row major order) as handed out by blas_level1_thread, k selects the kernel */
+static int omatcopy_thread(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT alpha, FLOAT *a, BLASLONG lda,
+			   FLOAT *b, BLASLONG ldb, FLOAT *dummy, BLASLONG dummy2, void *dummy3)
+{
+	switch (k) {
+	case 0: OMATCOPY_K_CN(n, m, alpha, a, lda, b, ldb); break;
+	case 1: OMATCOPY_K_CT(n, m, alpha, a, lda, b, ldb); break;
+	case 2: OMATCOPY_K_RN(m, n, alpha, a, lda, b, ldb); break;
+	case 3: OMATCOPY_K_RT(m, n, alpha, a, lda, b, ldb); break;
+	}
+	return 0;
+}
+#endif
+
 #ifndef CBLAS 
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, FLOAT *b, blasint *ldb)
 {
@@ -54,6 +70,9 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -74,6 +93,9 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 	FLOAT   *alpha; 
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	if ( CORDER == CblasColMajor ) order = BlasColMajor; 
 	if ( CORDER == CblasRowMajor ) order = BlasRowMajor; 
@@ -113,6 +135,32 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 
 	if ((*rows == 0) || (*cols == 0)) return;
 
+#ifdef SMP
+	/* transposes are bound by memory latency rather than bandwidth and pay off
+	   on more threads than a plain copy would */
+	if ((BLASLONG)*rows * (BLASLONG)*cols < 65536)
+		nthreads = 1;
+	else
+		nthreads = num_cpu_avail(1);
+
+	if (nthreads > 1) {
+#ifdef DOUBLE
+		mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+		mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+		if (trans == BlasTrans) mode |= BLAS_TRANSB_T;
+
+		if ( order == BlasColMajor )
+			blas_level1_thread(mode, *cols, *rows, trans, alpha, a, *lda, b, *ldb, NULL, 0,
+					   (int (*)(void))omatcopy_thread, nthreads);
+		else
+			blas_level1_thread(mode, *rows, *cols, 2 + trans, alpha, a, *lda, b, *ldb, NULL, 0,
+					   (int (*)(void))omatcopy_thread, nthreads);
+		return;
+	}
+#endif
+
 	if ( order == BlasColMajor )
 	{
 		if ( trans == BlasNoTrans )
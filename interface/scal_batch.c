@@ -0,0 +1,248 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+void openblas_warning(int verbose, const char * msg);
+
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define ERROR_PREFIX "DSCAL_BATCH"
+#else
+#define ERROR_PREFIX "SSCAL_BATCH"
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_PREFIX "ZSCAL_BATCH"
+#else
+#define ERROR_PREFIX "CSCAL_BATCH"
+#endif
+#endif
+
+#ifdef STRIDED
+#define ERROR_NAME ERROR_PREFIX "_STRIDED "
+#else
+#define ERROR_NAME ERROR_PREFIX " "
+#endif
+
+/* scal touches a single vector in place and is the cheapest of the
+   batched routines, so it needs the most elements per thread */
+#define SCAL_BATCH_MIN	65536L
+
+/* x = alpha*x for one member of length args->m */
+static int scal_member(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		       FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  FLOAT *alpha = (FLOAT *)args -> alpha;
+
+#ifndef COMPLEX
+  SCAL_K(args -> m, 0, 0, alpha[0], (FLOAT *)args -> a, args -> lda, NULL, 0, NULL, 1);
+#else
+  SCAL_K(args -> m, 0, 0, alpha[0], alpha[1], (FLOAT *)args -> a, args -> lda, NULL, 0, NULL, 0);
+#endif
+
+  return 0;
+}
+
+#ifndef STRIDED
+
+void CNAME(blasint * n_array,
+#ifndef COMPLEX
+	   FLOAT * alpha_array,
+	   FLOAT ** x_array, blasint * incx_array,
+#else
+	   void * valpha_array,
+	   void ** vx_array, blasint * incx_array,
+#endif
+	   blasint group_count, blasint * group_size){
+
+#ifdef COMPLEX
+  FLOAT * alpha_array = (FLOAT *)valpha_array;
+  FLOAT ** x_array = (FLOAT **)vx_array;
+#endif
+
+  blas_arg_t * args_array = NULL;
+  int mode = 0;
+  blasint i, j, info, matrix_idx = 0, count = 0, total_num = 0;
+
+  PRINT_DEBUG_CNAME;
+
+  info = -1;
+
+  if (group_count < 0) info = 5;
+  for (i = 0; i < group_count; i++) {
+    if (group_size[i] < 0) info = 6;
+    else total_num += group_size[i];
+  }
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (total_num == 0) return;
+
+  args_array = (blas_arg_t *)malloc(total_num * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  for (i = 0; i < group_count; matrix_idx += group_size[i], i++) {
+
+    if (n_array[i] <= 0 || incx_array[i] <= 0) continue;
+#ifndef COMPLEX
+    if (alpha_array[i] == ONE) continue;
+#else
+    if (alpha_array[2 * i] == ONE && alpha_array[2 * i + 1] == ZERO) continue;
+#endif
+
+    for (j = 0; j < group_size[i]; j++) {
+      /* complex members weigh twice their length, as n = COMPSIZE */
+      args_array[count].m = n_array[i];
+      args_array[count].n = COMPSIZE;
+      args_array[count].a = (void *)x_array[matrix_idx + j];
+      args_array[count].lda = incx_array[i];
+      args_array[count].alpha = (void *)&alpha_array[i * COMPSIZE];
+      args_array[count].routine = (void *)scal_member;
+      args_array[count].routine_mode = mode;
+      count++;
+    }
+  }
+
+  if (count > 0) blas_batch_thread(args_array, count, SCAL_BATCH_MIN, 0);
+
+  free(args_array);
+}
+
+#else
+
+void CNAME(blasint n,
+#ifndef COMPLEX
+	   FLOAT alpha,
+	   FLOAT *x, blasint incx, blasint stride_x,
+#else
+	   void *valpha,
+	   void *vx, blasint incx, blasint stride_x,
+#endif
+	   blasint batch_size){
+
+#ifndef COMPLEX
+  FLOAT *alpha_p = &alpha;
+#else
+  FLOAT *alpha_p = (FLOAT *)valpha;
+  FLOAT *x = (FLOAT *)vx;
+#endif
+
+  blas_arg_t * args_array = NULL;
+  int mode = 0;
+  blasint i, info;
+
+  PRINT_DEBUG_CNAME;
+
+  info = -1;
+
+  if (batch_size < 0) info = 6;
+  if ((batch_size > 1) && (n > 0) && (incx > 0) && (stride_x < 1 + (BLASLONG)(n - 1) * incx)) info = 5;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (n <= 0 || incx <= 0 || batch_size == 0) return;
+#ifndef COMPLEX
+  if (alpha_p[0] == ONE) return;
+#else
+  if (alpha_p[0] == ONE && alpha_p[1] == ZERO) return;
+#endif
+
+  args_array = (blas_arg_t *)malloc(batch_size * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  for (i = 0; i < batch_size; i++) {
+    args_array[i].m = n;
+    args_array[i].n = COMPSIZE;
+    args_array[i].a = (void *)(x + (BLASLONG)i * stride_x * COMPSIZE);
+    args_array[i].lda = incx;
+    args_array[i].alpha = (void *)alpha_p;
+    args_array[i].routine = (void *)scal_member;
+    args_array[i].routine_mode = mode;
+  }
+
+  blas_batch_thread(args_array, batch_size, SCAL_BATCH_MIN, 0);
+
+  free(args_array);
+}
+
+#endif
@@ -44,7 +44,6 @@
 #endif
 
 #ifndef COMPLEX
-#define SMP_THRESHOLD_MIN 65536.
 #ifdef XDOUBLE
 #define ERROR_NAME "QSYMM "
 #elif defined(DOUBLE)
@@ -53,7 +52,6 @@
 #define ERROR_NAME "SSYMM "
 #endif
 #else
-#define SMP_THRESHOLD_MIN 8192.
 #ifndef GEMM3M
 #ifndef HEMM
 #ifdef XDOUBLE
@@ -93,10 +91,6 @@
 #endif
 #endif
 
-#ifndef GEMM_MULTITHREAD_THRESHOLD
-#define GEMM_MULTITHREAD_THRESHOLD 4
-#endif
-
 
 #ifdef SMP
 #ifndef COMPLEX
@@ -164,9 +158,6 @@ void NAME(char *SIDE, char *UPLO,
 
 #if defined(SMP) && !defined(NO_AFFINITY)
   int nodes;
-#endif
-# if defined(SMP)
-  double MN;
 #endif
   blasint info;
   int side;
@@ -263,9 +254,6 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
 #if defined(SMP) && !defined(NO_AFFINITY)
   int nodes;
 #endif
-#if defined(SMP)
-  double MN;
-#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -379,19 +367,14 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
 
   FUNCTION_PROFILE_START();
 
-  buffer = (FLOAT *)blas_memory_alloc(0);
+  buffer = (FLOAT *)blas_workspace_alloc();
 
   sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
   sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
 
 #ifdef SMP
   args.common = NULL;
-  MN = 2.* (double) args.m * (double)args.m * (double) args.n;
-  if (MN <= (SMP_THRESHOLD_MIN * (double) GEMM_MULTITHREAD_THRESHOLD) ) {
-	  args.nthreads = 1;
-  } else {
-	 args.nthreads = num_cpu_avail(3);
-  }
+  args.nthreads = LEVEL3_NTHREADS(args.m, args.n, side ? args.n : args.m, BLAS_L3_SPLIT_MN);
   if (args.nthreads == 1) {
 #endif
 
@@ -430,7 +413,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
   }
 #endif
 
- blas_memory_free(buffer);
+ blas_workspace_free(buffer);
 
   FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE,
 		       (!side)? args.m * (args.m / 2 + args.n) : args.n * (args.m + args.n / 2),
@@ -353,7 +353,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo, enum CBLAS_TRANSPOSE Tr
 
   FUNCTION_PROFILE_START();
 
-  buffer = (FLOAT *)blas_memory_alloc(0);
+  buffer = (FLOAT *)blas_workspace_alloc();
 
   sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
   sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
@@ -368,10 +368,8 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo, enum CBLAS_TRANSPOSE Tr
   mode |= (uplo  << BLAS_UPLO_SHIFT);
 
   args.common = NULL;
-  if (args.n*args.k <1000)
-	  args.nthreads =1 ;
-  else
-  args.nthreads = num_cpu_avail(3);
+  /* Two updates of the triangle of C */
+  args.nthreads = LEVEL3_NTHREADS(args.n, args.n + 1, args.k, BLAS_L3_SPLIT_MN);
 
   if (args.nthreads == 1) {
 #endif
@@ -387,7 +385,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo, enum CBLAS_TRANSPOSE Tr
   }
 #endif
 
-  blas_memory_free(buffer);
+  blas_workspace_free(buffer);
 
   FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, 2 * args.n * args.k + args.n * args.n, 2 * args.n * args.n * args.k);
 
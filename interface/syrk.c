@@ -44,7 +44,6 @@
 #endif
 
 #ifndef COMPLEX
-#define SMP_THRESHOLD_MIN 109944.
 #ifdef XDOUBLE
 #define ERROR_NAME "QSYRK "
 #elif defined(DOUBLE)
@@ -53,7 +52,6 @@
 #define ERROR_NAME "SSYRK "
 #endif
 #else
-#define SMP_THRESHOLD_MIN 14824.
 #ifndef HEMM
 #ifdef XDOUBLE
 #define ERROR_NAME "XSYRK "
@@ -73,10 +71,6 @@
 #endif
 #endif
 
-#ifndef GEMM_MULTITHREAD_THRESHOLD
-#define GEMM_MULTITHREAD_THRESHOLD 4
-#endif
-
 static int (*syrk[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
 #ifndef HEMM
   SYRK_UN, SYRK_UC, SYRK_LN, SYRK_LC,
@@ -107,7 +101,6 @@ void NAME(char *UPLO, char *TRANS,
   FLOAT *sa, *sb;
 
 #ifdef SMP
-  double NNK;
 #ifdef USE_SIMPLE_THREADED_LEVEL3
 #ifndef COMPLEX
 #ifdef XDOUBLE
@@ -232,8 +225,6 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo, enum CBLAS_TRANSPOSE Tr
   FLOAT *sa, *sb;
 
 #ifdef SMP
-double NNK;
-
 #ifdef USE_SIMPLE_THREADED_LEVEL3
 #ifndef COMPLEX
 #ifdef XDOUBLE
@@ -347,7 +338,7 @@ double NNK;
 
   FUNCTION_PROFILE_START();
 
-  buffer = (FLOAT *)blas_memory_alloc(0);
+  buffer = (FLOAT *)blas_workspace_alloc();
 
   sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
   sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
@@ -364,12 +355,8 @@ double NNK;
 
   args.common = NULL;
 
-  NNK = (double)(args.n+1)*(double)args.n*(double)args.k;
-  if (NNK <= (SMP_THRESHOLD_MIN * GEMM_MULTITHREAD_THRESHOLD)) {
-  args.nthreads = 1;
-  } else {
-  args.nthreads = num_cpu_avail(3);
-  }
+  /* Only the triangle of C is computed */
+  args.nthreads = LEVEL3_NTHREADS(args.n, (args.n + 1) / 2, args.k, BLAS_L3_SPLIT_MN);
 
   if (args.nthreads == 1) {
 #endif
@@ -392,7 +379,7 @@ double NNK;
   }
 #endif
 
- blas_memory_free(buffer);
+ blas_workspace_free(buffer);
 
   FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.n * args.k + args.n * args.n / 2, args.n * args.n * args.k);
 
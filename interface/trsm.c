@@ -81,12 +81,6 @@
 #endif
 #endif
 
-#ifndef COMPLEX
-#define SMP_FACTOR 256
-#else
-#define SMP_FACTOR 128
-#endif
-
 static int (*trsm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
 #ifndef TRMM
   TRSM_LNUU, TRSM_LNUN, TRSM_LNLU, TRSM_LNLN,
@@ -363,7 +357,7 @@ void CNAME(enum CBLAS_ORDER order,
 
   FUNCTION_PROFILE_START();
 
-  buffer = (FLOAT *)blas_memory_alloc(0);
+  buffer = (FLOAT *)blas_workspace_alloc();
 
   sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
   sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
@@ -372,18 +366,12 @@ void CNAME(enum CBLAS_ORDER order,
   mode |= (trans << BLAS_TRANSA_SHIFT);
   mode |= (side  << BLAS_RSIDE_SHIFT);
 
-/*
-  if ( args.m < 2 * GEMM_MULTITHREAD_THRESHOLD )
-	args.nthreads = 1;
-  else
-	if ( args.n < 2 * GEMM_MULTITHREAD_THRESHOLD )
-		args.nthreads = 1;
-*/
-  if ( args.m * args.n < SMP_FACTOR * GEMM_MULTITHREAD_THRESHOLD)
-	args.nthreads = 1;
+  /* The triangular operand is applied to the columns (left side) or
+     rows (right side) of B, which are split over the threads */
+  if (!side)
+	args.nthreads = LEVEL3_NTHREADS(args.m, args.n, (args.m + 1) / 2, BLAS_L3_SPLIT_N);
   else
-	args.nthreads = num_cpu_avail(3);
-		
+	args.nthreads = LEVEL3_NTHREADS(args.m, args.n, (args.n + 1) / 2, BLAS_L3_SPLIT_M);
 
   if (args.nthreads == 1) {
 #endif
@@ -400,7 +388,7 @@ void CNAME(enum CBLAS_ORDER order,
   }
 #endif
 
-  blas_memory_free(buffer);
+  blas_workspace_free(buffer);
 
   FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE,
 		       (!side) ? args.m * (args.m + args.n) : args.n * (args.m + args.n),
@@ -32,6 +32,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "common.h"
 #ifdef FUNCTION_PROFILE
 #include "functable.h"
@@ -50,8 +51,97 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define BlasTransConj    2
 #define BlasConj         3
 
+#undef malloc
+#undef free
+
 #define NEW_IMATCOPY 
 
+/* alpha * x, or alpha * conj(x) */
+static inline void zimatcopy_scale(FLOAT *d, FLOAT re, FLOAT im, FLOAT alpha_r, FLOAT alpha_i, int conj)
+{
+	if (conj) im = -im;
+	d[0] = alpha_r * re - alpha_i * im;
+	d[1] = alpha_r * im + alpha_i * re;
+}
+
+/* Moves the columns of the m x n column major matrix a from leading dimension lda
+   to ldb in place, scaling them by alpha (and conjugating them with conj) */
+static void zimatcopy_move(BLASLONG m, BLASLONG n, FLOAT alpha_r, FLOAT alpha_i, int conj,
+			   FLOAT *a, BLASLONG lda, BLASLONG ldb)
+{
+	BLASLONG i, j;
+	FLOAT *s;
+
+	if (ldb == lda && alpha_r == ONE && alpha_i == ZERO && !conj) return;
+
+	if (ldb <= lda) {
+		for (j = 0; j < n; j++)
+			for (i = 0; i < m; i++) {
+				s = a + (i + j * lda) * 2;
+				zimatcopy_scale(a + (i + j * ldb) * 2, s[0], s[1], alpha_r, alpha_i, conj);
+			}
+	} else {
+		for (j = n - 1; j >= 0; j--)
+			for (i = m - 1; i >= 0; i--) {
+				s = a + (i + j * lda) * 2;
+				zimatcopy_scale(a + (i + j * ldb) * 2, s[0], s[1], alpha_r, alpha_i, conj);
+			}
+	}
+}
+
+/* Clears the m x n result at leading dimension ldb for alpha == 0, as in imatcopy.c */
+static void zimatcopy_zero(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG ldb)
+{
+	BLASLONG i, j;
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m * 2; i++)
+			a[i + j * ldb * 2] = ZERO;
+}
+
+#define ZIMATCOPY_WINDOW 32768
+
+/* Replaces the m x n column major matrix stored contiguously at a by alpha times its
+   n x m (conjugate) transpose, moving the cycles of the permutation that takes
+   element i + j * m to j + i * n window by window as in imatcopy.c */
+static void zimatcopy_cycles(BLASLONG m, BLASLONG n, FLOAT alpha_r, FLOAT alpha_i, int conj, FLOAT *a)
+{
+	BLASLONG last = m * n - 1;
+	BLASLONG base, end, start, p, q;
+	unsigned char done[ZIMATCOPY_WINDOW / 8];
+	FLOAT t[2], u[2];
+
+	zimatcopy_scale(a, a[0], a[1], alpha_r, alpha_i, conj);
+	if (last > 0) zimatcopy_scale(a + last * 2, a[last * 2], a[last * 2 + 1], alpha_r, alpha_i, conj);
+
+	for (base = 1; base < last; base += ZIMATCOPY_WINDOW) {
+		end = MIN(base + ZIMATCOPY_WINDOW, last);
+		memset(done, 0, sizeof(done));
+
+		for (start = base; start < end; start++) {
+			if (done[(start - base) >> 3] & (1 << ((start - base) & 7))) continue;
+
+			q = (start % m) * n + start / m;
+			while (q > start) q = (q % m) * n + q / m;
+			if (q < start) continue;
+
+			t[0] = a[start * 2];
+			t[1] = a[start * 2 + 1];
+			p = start;
+			do {
+				q = (p % m) * n + p / m;
+				u[0] = a[q * 2];
+				u[1] = a[q * 2 + 1];
+				zimatcopy_scale(a + q * 2, t[0], t[1], alpha_r, alpha_i, conj);
+				t[0] = u[0];
+				t[1] = u[1];
+				if (q < end) done[(q - base) >> 3] |= 1 << ((q - base) & 7);
+				p = q;
+			} while (p != start);
+		}
+	}
+}
+
 #ifndef CBLAS
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, blasint *ldb)
 {
@@ -59,8 +149,7 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
-	FLOAT *b;
-	size_t msize;
+	BLASLONG m, n;
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -82,8 +171,7 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 	blasint *rows, *cols, *lda, *ldb; 
 	int order=-1,trans=-1;
 	blasint info = -1;
-	FLOAT *b;
-	size_t msize;
+	BLASLONG m, n;
 
 	if ( CORDER == CblasColMajor ) order = BlasColMajor; 
 	if ( CORDER == CblasRowMajor ) order = BlasRowMajor; 
@@ -183,70 +271,38 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
     }
 #endif
 
-		if ( *rows >  *cols )
-                msize = (size_t)(*rows) * (*ldb)  * sizeof(FLOAT) * 2;
-        else
-                msize = (size_t)(*cols) * (*ldb)  * sizeof(FLOAT) * 2;
-
-	b = malloc(msize);
-	if ( b == NULL )
+	/* everything else is done in place, as in imatcopy.c */
+	if ( order == BlasColMajor )
 	{
-		printf("Memory alloc failed in zimatcopy\n");
-		exit(1);
+		m = *rows;
+		n = *cols;
 	}
-
-	if ( order == BlasColMajor )
+	else
 	{
+		m = *cols;
+		n = *rows;
+	}
 
-		if ( trans == BlasNoTrans )
-		{
-	  		OMATCOPY_K_CN(*rows, *cols, alpha[0], alpha[1], a, *lda, b, *rows );
-	  		OMATCOPY_K_CN(*rows, *cols, (FLOAT) 1.0, (FLOAT) 0.0 , b, *rows, a, *ldb );
-		}
-		else if ( trans == BlasConj )
-		{
-			OMATCOPY_K_CNC(*rows, *cols, alpha[0], alpha[1], a, *lda, b, *rows );
-	  		OMATCOPY_K_CN(*rows, *cols, (FLOAT) 1.0, (FLOAT) 0.0 , b, *rows, a, *ldb );
-		}
-		else if ( trans == BlasTrans )
-		{
-			OMATCOPY_K_CT(*rows, *cols, alpha[0], alpha[1], a, *lda, b, *cols );
-	  		OMATCOPY_K_CN(*cols, *rows, (FLOAT) 1.0, (FLOAT) 0.0 , b, *cols, a, *ldb );
-		}
-		else if ( trans == BlasTransConj )
-		{
-			OMATCOPY_K_CTC(*rows, *cols, alpha[0], alpha[1], a, *lda, b, *cols );
-	  		OMATCOPY_K_CN(*cols, *rows, (FLOAT) 1.0, (FLOAT) 0.0 , b, *cols, a, *ldb );
-		}
+	if ( alpha[0] == ZERO && alpha[1] == ZERO )
+	{
+		if ( trans == BlasNoTrans || trans == BlasConj )
+			zimatcopy_zero(m, n, a, *ldb);
+		else
+			zimatcopy_zero(n, m, a, *ldb);
+		return;
+	}
 
+	if ( trans == BlasNoTrans || trans == BlasConj )
+	{
+		zimatcopy_move(m, n, alpha[0], alpha[1], trans == BlasConj, a, *lda, *ldb);
 	}
 	else
 	{
-
-		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_RN(*rows, *cols, alpha[0], alpha[1], a, *lda, b, *cols );
-	  		OMATCOPY_K_RN(*rows, *cols, (FLOAT) 1.0, (FLOAT) 0.0 , b, *cols, a, *ldb );
-		}
-		else if ( trans == BlasConj )
-		{
-			OMATCOPY_K_RNC(*rows, *cols, alpha[0], alpha[1], a, *lda, b, *cols );
-	  		OMATCOPY_K_RN(*rows, *cols, (FLOAT) 1.0, (FLOAT) 0.0 , b, *cols, a, *ldb );
-		}
-		else if ( trans == BlasTrans )
-		{
-			OMATCOPY_K_RT(*rows, *cols, alpha[0], alpha[1], a, *lda, b, *rows );
-	  		OMATCOPY_K_RN(*cols, *rows, (FLOAT) 1.0, (FLOAT) 0.0 , b, *rows, a, *ldb );
-		}
-		else if ( trans == BlasTransConj )
-		{
-			OMATCOPY_K_RTC(*rows, *cols, alpha[0], alpha[1], a, *lda, b, *rows );
-	  		OMATCOPY_K_RN(*cols, *rows, (FLOAT) 1.0, (FLOAT) 0.0 , b, *rows, a, *ldb );
-		}
-
+		zimatcopy_move(m, n, ONE, ZERO, 0, a, *lda, m);
+		zimatcopy_cycles(m, n, alpha[0], alpha[1], trans == BlasTransConj, a);
+		zimatcopy_move(n, m, ONE, ZERO, 0, a, n, *ldb);
 	}
 
-	free(b);
 	return;
 
 }
@@ -49,6 +49,26 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define BlasTransConj    2
 #define BlasConj         3
 
+#ifdef SMP
+/* Copies a slice of the outer dimension of a (columns in column major order, rows in
+   row major order) as handed out by blas_level1_thread, k selects the kernel */
+static int zomatcopy_thread(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda,
+			    FLOAT *b, BLASLONG ldb, FLOAT *dummy, BLASLONG dummy2, void *dummy3)
+{
+	switch (k) {
+	case BlasNoTrans:       OMATCOPY_K_CN (n, m, alpha_r, alpha_i, a, lda, b, ldb); break;
+	case BlasTrans:         OMATCOPY_K_CT (n, m, alpha_r, alpha_i, a, lda, b, ldb); break;
+	case BlasTransConj:     OMATCOPY_K_CTC(n, m, alpha_r, alpha_i, a, lda, b, ldb); break;
+	case BlasConj:          OMATCOPY_K_CNC(n, m, alpha_r, alpha_i, a, lda, b, ldb); break;
+	case 4 + BlasNoTrans:   OMATCOPY_K_RN (m, n, alpha_r, alpha_i, a, lda, b, ldb); break;
+	case 4 + BlasTrans:     OMATCOPY_K_RT (m, n, alpha_r, alpha_i, a, lda, b, ldb); break;
+	case 4 + BlasTransConj: OMATCOPY_K_RTC(m, n, alpha_r, alpha_i, a, lda, b, ldb); break;
+	case 4 + BlasConj:      OMATCOPY_K_RNC(m, n, alpha_r, alpha_i, a, lda, b, ldb); break;
+	}
+	return 0;
+}
+#endif
+
 #ifndef CBLAS
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, FLOAT *b, blasint *ldb)
 {
@@ -56,6 +76,9 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -76,6 +99,9 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 	blasint *rows, *cols, *lda, *ldb; 
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	if ( CORDER == CblasColMajor ) order = BlasColMajor; 
 	if ( CORDER == CblasRowMajor ) order = BlasRowMajor; 
@@ -119,6 +145,31 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 
 	if ((*rows == 0) || (*cols == 0)) return;
 
+#ifdef SMP
+	/* half the element count of the real omatcopy threshold, as every element is two words */
+	if ((BLASLONG)*rows * (BLASLONG)*cols < 32768)
+		nthreads = 1;
+	else
+		nthreads = num_cpu_avail(1);
+
+	if (nthreads > 1) {
+#ifdef DOUBLE
+		mode = BLAS_DOUBLE | BLAS_COMPLEX;
+#else
+		mode = BLAS_SINGLE | BLAS_COMPLEX;
+#endif
+		if (trans == BlasTrans || trans == BlasTransConj) mode |= BLAS_TRANSB_T;
+
+		if ( order == BlasColMajor )
+			blas_level1_thread(mode, *cols, *rows, trans, alpha, a, *lda, b, *ldb, NULL, 0,
+					   (int (*)(void))zomatcopy_thread, nthreads);
+		else
+			blas_level1_thread(mode, *rows, *cols, 4 + trans, alpha, a, *lda, b, *ldb, NULL, 0,
+					   (int (*)(void))zomatcopy_thread, nthreads);
+		return;
+	}
+#endif
+
 	if ( order == BlasColMajor )
 	{
 
@@ -39,15 +39,15 @@
 #include <stdio.h>
 #include "common.h"
 
-int CNAME(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG lda, FLOAT *b){
+int CNAME(BLASLONG m, BLASLONG n, IFLOAT *a, BLASLONG lda, IFLOAT *b){
   BLASLONG i, j;
 
-  FLOAT *a_offset, *a_offset1, *a_offset2, *a_offset3, *a_offset4;
-  FLOAT *b_offset;
-  FLOAT  ctemp1,  ctemp2,  ctemp3,  ctemp4;
-  FLOAT  ctemp5,  ctemp6,  ctemp7,  ctemp8;
-  FLOAT  ctemp9, ctemp10, ctemp11, ctemp12;
-  FLOAT ctemp13, ctemp14, ctemp15, ctemp16;
+  IFLOAT *a_offset, *a_offset1, *a_offset2, *a_offset3, *a_offset4;
+  IFLOAT *b_offset;
+  IFLOAT  ctemp1,  ctemp2,  ctemp3,  ctemp4;
+  IFLOAT  ctemp5,  ctemp6,  ctemp7,  ctemp8;
+  IFLOAT  ctemp9, ctemp10, ctemp11, ctemp12;
+  IFLOAT ctemp13, ctemp14, ctemp15, ctemp16;
 
   a_offset = a;
   b_offset = b;
@@ -13,6 +13,8 @@ bfloat16tof32 (bfloat16 f16)
   return result;
 }
 #define BF16TOF32(x) (bfloat16tof32(x))
+#elif defined(HFLOAT16)
+#define BF16TOF32(x) (hfloat16tof32(x))
 #else
 #define BF16TOF32(x) x
 #endif
@@ -0,0 +1,93 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * Portable int8 GEMM kernel: C += alpha * A * B with A unsigned and B signed
+ * 8-bit, accumulated and stored as int32 (C is passed as FLOAT * and only
+ * reinterpreted here).  A and B are packed by i8gemm_ncopy.c/i8gemm_tcopy.c
+ * with panel widths I8GEMM_KERNEL_M and I8GEMM_KERNEL_N.
+ */
+
+#include "common.h"
+
+int CNAME(BLASLONG bm, BLASLONG bn, BLASLONG bk, FLOAT alpha, IFLOAT *ba, IFLOAT *bb, FLOAT *C, BLASLONG ldc)
+{
+  BLASLONG i, j, ii, jj, l, mw, nw;
+  BLASLONG k4 = (bk & ~3);
+  unsigned char *pa;
+  signed char *pb;
+  int32_t *c = (int32_t *)C;
+  int32_t acc[I8GEMM_KERNEL_N][I8GEMM_KERNEL_M];
+
+  for (j = 0; j < bn; j += I8GEMM_KERNEL_N) {
+
+    nw = bn - j;
+    if (nw > I8GEMM_KERNEL_N) nw = I8GEMM_KERNEL_N;
+
+    for (i = 0; i < bm; i += I8GEMM_KERNEL_M) {
+
+      mw = bm - i;
+      if (mw > I8GEMM_KERNEL_M) mw = I8GEMM_KERNEL_M;
+
+      pa = (unsigned char *)ba + i * bk;
+      pb = (signed char *)bb + j * bk;
+
+      for (jj = 0; jj < nw; jj++)
+	for (ii = 0; ii < mw; ii++) acc[jj][ii] = 0;
+
+      for (l = 0; l < k4; l += 4) {
+	for (jj = 0; jj < nw; jj++) {
+	  for (ii = 0; ii < mw; ii++) {
+	    acc[jj][ii] += (int32_t)pa[ii * 4 + 0] * pb[jj * 4 + 0]
+	                 + (int32_t)pa[ii * 4 + 1] * pb[jj * 4 + 1]
+	                 + (int32_t)pa[ii * 4 + 2] * pb[jj * 4 + 2]
+	                 + (int32_t)pa[ii * 4 + 3] * pb[jj * 4 + 3];
+	  }
+	}
+	pa += 4 * mw;
+	pb += 4 * nw;
+      }
+
+      for (l = k4; l < bk; l++) {
+	for (jj = 0; jj < nw; jj++)
+	  for (ii = 0; ii < mw; ii++) acc[jj][ii] += (int32_t)pa[ii] * pb[jj];
+	pa += mw;
+	pb += nw;
+      }
+
+      if (alpha == ONE) {
+	for (jj = 0; jj < nw; jj++)
+	  for (ii = 0; ii < mw; ii++) c[(i + ii) + (j + jj) * ldc] += acc[jj][ii];
+      } else {
+	for (jj = 0; jj < nw; jj++)
+	  for (ii = 0; ii < mw; ii++) c[(i + ii) + (j + jj) * ldc] += i8gemm_round((double)alpha * acc[jj][ii]);
+      }
+    }
+  }
+
+  return 0;
+}
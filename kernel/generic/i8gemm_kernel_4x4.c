@@ -0,0 +1,3 @@
+#define I8GEMM_KERNEL_M 4
+#define I8GEMM_KERNEL_N 4
+#include "i8gemm_kernel.c"
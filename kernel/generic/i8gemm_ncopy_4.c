@@ -0,0 +1,2 @@
+#define I8GEMM_COPY_UNROLL 4
+#include "i8gemm_ncopy.c"
@@ -0,0 +1,2 @@
+#define I8GEMM_COPY_UNROLL 8
+#include "i8gemm_ncopy.c"
@@ -0,0 +1,68 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * Transposed counterpart of i8gemm_ncopy.c: the element (l, j) of the
+ * source is a[j + l * lda].  The packed layout is the same.
+ */
+
+#include <stdio.h>
+#include "common.h"
+
+int CNAME(BLASLONG m, BLASLONG n, IFLOAT *a, BLASLONG lda, IFLOAT *b){
+
+  BLASLONG i, j, l, w;
+  BLASLONG m4 = (m & ~3);
+  IFLOAT *a_offset;
+
+  for (j = 0; j < n; j += I8GEMM_COPY_UNROLL) {
+
+    w = n - j;
+    if (w > I8GEMM_COPY_UNROLL) w = I8GEMM_COPY_UNROLL;
+
+    a_offset = a + j;
+
+    for (i = 0; i < m4; i += 4) {
+      for (l = 0; l < w; l++) {
+	b[0] = a_offset[l + (i + 0) * lda];
+	b[1] = a_offset[l + (i + 1) * lda];
+	b[2] = a_offset[l + (i + 2) * lda];
+	b[3] = a_offset[l + (i + 3) * lda];
+	b += 4;
+      }
+    }
+
+    for (i = m4; i < m; i++) {
+      for (l = 0; l < w; l++) {
+	*b = a_offset[l + i * lda];
+	b++;
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,66 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+/* y = alpha * A * x + beta * y with A and x in IEEE binary16, y in fp32 */
+int CNAME(BLASLONG m, BLASLONG n, float alpha, hfloat16 *a, BLASLONG lda, hfloat16 *x, BLASLONG incx, float beta, float *y, BLASLONG incy)
+{
+	BLASLONG i, j;
+	BLASLONG ix, iy;
+	hfloat16 *a_ptr;
+	float temp;
+
+	if (m < 1 || n < 1) return(0);
+
+	iy = 0;
+	for (i = 0; i < m; i++)
+	{
+		if (beta == ZERO)
+			y[iy] = ZERO;
+		else
+			y[iy] *= beta;
+		iy += incy;
+	}
+
+	ix = 0;
+	a_ptr = a;
+
+	for (j = 0; j < n; j++)
+	{
+		temp = alpha * hfloat16tof32(x[ix]);
+		iy = 0;
+		for (i = 0; i < m; i++)
+		{
+			y[iy] += temp * hfloat16tof32(a_ptr[i]);
+			iy += incy;
+		}
+		a_ptr += lda;
+		ix    += incx;
+	}
+	return(0);
+}
@@ -125,6 +125,36 @@ gotoblas_t TABLE_NAME = {
 #endif
 #endif
 
+#ifdef BUILD_HFLOAT16
+  SHGEMM_DEFAULT_P, SHGEMM_DEFAULT_Q, SHGEMM_DEFAULT_R,
+  SHGEMM_DEFAULT_UNROLL_M, SHGEMM_DEFAULT_UNROLL_N,
+#ifdef SHGEMM_DEFAULT_UNROLL_MN
+ SHGEMM_DEFAULT_UNROLL_MN,
+#else
+ MAX(SHGEMM_DEFAULT_UNROLL_M, SHGEMM_DEFAULT_UNROLL_N),
+#endif
+
+  shgemv_nTS, shgemv_tTS,
+
+  shgemm_kernelTS, shgemm_betaTS,
+#if SHGEMM_DEFAULT_UNROLL_M != SHGEMM_DEFAULT_UNROLL_N
+  shgemm_incopyTS, shgemm_itcopyTS,
+#else
+  shgemm_oncopyTS, shgemm_otcopyTS,
+#endif
+  shgemm_oncopyTS, shgemm_otcopyTS,
+#endif
+
+#ifdef BUILD_INT8
+  I8GEMM_DEFAULT_P, I8GEMM_DEFAULT_Q, I8GEMM_DEFAULT_R,
+  I8GEMM_DEFAULT_UNROLL_M, I8GEMM_DEFAULT_UNROLL_N,
+  MAX(I8GEMM_DEFAULT_UNROLL_M, I8GEMM_DEFAULT_UNROLL_N),
+
+  i8gemm_kernelTS, i8gemm_betaTS,
+  i8gemm_incopyTS, i8gemm_itcopyTS,
+  i8gemm_oncopyTS, i8gemm_otcopyTS,
+#endif
+
 #if ( BUILD_SINGLE==1) || (BUILD_DOUBLE==1) || (BUILD_COMPLEX==1) || (BUILD_COMPLEX16==1)
   0, 0, 0,
   SGEMM_DEFAULT_UNROLL_M, SGEMM_DEFAULT_UNROLL_N,
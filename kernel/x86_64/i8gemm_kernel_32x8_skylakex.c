@@ -0,0 +1,208 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * Int8 GEMM kernel for AVX512: C += alpha * A * B with A unsigned and B
+ * signed 8-bit, int32 accumulation.  A comes in 32-row panels and B in
+ * 8-column panels from i8gemm_ncopy.c/i8gemm_tcopy.c, four consecutive k
+ * per 32-bit lane, so each lane of a zmm register holds one row of A for
+ * one k-quad and a single vpdpbusd updates 16 rows of a C column.
+ *
+ * Without AVX512-VNNI (plain SKYLAKEX) the quad product is formed exactly
+ * from the even and odd bytes widened to 16 bits and vpmaddwd; vpmaddubsw is
+ * avoided because it saturates.
+ */
+
+#include "common.h"
+
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+
+#include <immintrin.h>
+
+static __inline __m512i i8_dot4(__m512i acc, __m512i a, __m512i b)
+{
+#if defined(__AVX512VNNI__)
+  return _mm512_dpbusd_epi32(acc, a, b);
+#else
+  __m512i lo = _mm512_set1_epi16(0x00ff);
+  __m512i a_even = _mm512_and_si512(a, lo);
+  __m512i a_odd  = _mm512_srli_epi16(a, 8);
+  __m512i b_even = _mm512_srai_epi16(_mm512_slli_epi16(b, 8), 8);
+  __m512i b_odd  = _mm512_srai_epi16(b, 8);
+  return _mm512_add_epi32(acc, _mm512_add_epi32(_mm512_madd_epi16(a_even, b_even),
+						 _mm512_madd_epi16(a_odd,  b_odd)));
+#endif
+}
+
+static __inline void i8_store(int32_t *c, __m512i acc0, __m512i acc1,
+			      __mmask16 m0, __mmask16 m1, BLASLONG mw, float alpha)
+{
+  BLASLONG i;
+  int32_t t[32];
+
+  if (alpha == ONE) {
+    _mm512_mask_storeu_epi32(c,      m0, _mm512_add_epi32(_mm512_maskz_loadu_epi32(m0, c),      acc0));
+    _mm512_mask_storeu_epi32(c + 16, m1, _mm512_add_epi32(_mm512_maskz_loadu_epi32(m1, c + 16), acc1));
+  } else {
+    _mm512_storeu_si512(t,      acc0);
+    _mm512_storeu_si512(t + 16, acc1);
+    for (i = 0; i < mw; i++) c[i] += i8gemm_round((double)alpha * t[i]);
+  }
+}
+
+#define LOAD_A_QUAD \
+  a0 = _mm512_maskz_loadu_epi32(m0, pa); \
+  a1 = _mm512_maskz_loadu_epi32(m1, pa + 64);
+
+#define LOAD_A_ONE \
+  a0 = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(m0, pa)); \
+  a1 = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(m1, pa + 16));
+
+#define QUAD_COL(j) \
+  b = _mm512_set1_epi32(((int *)pb)[j]); \
+  c0_##j = i8_dot4(c0_##j, a0, b); \
+  c1_##j = i8_dot4(c1_##j, a1, b);
+
+#define ONE_COL(j) \
+  b = _mm512_set1_epi32((int)pb[j]); \
+  c0_##j = _mm512_add_epi32(c0_##j, _mm512_mullo_epi32(a0, b)); \
+  c1_##j = _mm512_add_epi32(c1_##j, _mm512_mullo_epi32(a1, b));
+
+#define ZERO_COL(j) \
+  c0_##j = _mm512_setzero_si512(); \
+  c1_##j = _mm512_setzero_si512();
+
+#define STORE_COL(j) \
+  i8_store(c + (j) * ldc, c0_##j, c1_##j, m0, m1, mw, alpha);
+
+/* one 32 x 8 block (fewer rows at the bottom edge, masked) */
+static void i8_block_8(BLASLONG mw, BLASLONG k, unsigned char *pa, signed char *pb,
+		       int32_t *c, BLASLONG ldc, float alpha, __mmask16 m0, __mmask16 m1)
+{
+  BLASLONG l;
+  BLASLONG k4 = (k & ~3);
+  __m512i a0, a1, b;
+  __m512i c0_0, c0_1, c0_2, c0_3, c0_4, c0_5, c0_6, c0_7;
+  __m512i c1_0, c1_1, c1_2, c1_3, c1_4, c1_5, c1_6, c1_7;
+
+  ZERO_COL(0) ZERO_COL(1) ZERO_COL(2) ZERO_COL(3)
+  ZERO_COL(4) ZERO_COL(5) ZERO_COL(6) ZERO_COL(7)
+
+  for (l = 0; l < k4; l += 4) {
+    LOAD_A_QUAD
+    QUAD_COL(0) QUAD_COL(1) QUAD_COL(2) QUAD_COL(3)
+    QUAD_COL(4) QUAD_COL(5) QUAD_COL(6) QUAD_COL(7)
+    pa += 4 * mw;
+    pb += 4 * 8;
+  }
+
+  for (l = k4; l < k; l++) {
+    LOAD_A_ONE
+    ONE_COL(0) ONE_COL(1) ONE_COL(2) ONE_COL(3)
+    ONE_COL(4) ONE_COL(5) ONE_COL(6) ONE_COL(7)
+    pa += mw;
+    pb += 8;
+  }
+
+  STORE_COL(0) STORE_COL(1) STORE_COL(2) STORE_COL(3)
+  STORE_COL(4) STORE_COL(5) STORE_COL(6) STORE_COL(7)
+}
+
+/* right edge: fewer than 8 columns, handled one column at a time */
+static void i8_block_n(BLASLONG mw, BLASLONG nw, BLASLONG k, unsigned char *a_panel, signed char *b_panel,
+		       int32_t *c, BLASLONG ldc, float alpha, __mmask16 m0, __mmask16 m1)
+{
+  BLASLONG j, l;
+  BLASLONG k4 = (k & ~3);
+  unsigned char *pa;
+  signed char *pb;
+  __m512i a0, a1, b, c0_0, c1_0;
+
+  for (j = 0; j < nw; j++) {
+    ZERO_COL(0)
+
+    pa = a_panel;
+    pb = b_panel + 4 * j;
+    for (l = 0; l < k4; l += 4) {
+      LOAD_A_QUAD
+      QUAD_COL(0)
+      pa += 4 * mw;
+      pb += 4 * nw;
+    }
+
+    pb = b_panel + k4 * nw + j;
+    for (l = k4; l < k; l++) {
+      LOAD_A_ONE
+      ONE_COL(0)
+      pa += mw;
+      pb += nw;
+    }
+
+    STORE_COL(0)
+    c += ldc;
+  }
+}
+
+int CNAME(BLASLONG bm, BLASLONG bn, BLASLONG bk, FLOAT alpha, IFLOAT *ba, IFLOAT *bb, FLOAT *C, BLASLONG ldc)
+{
+  BLASLONG i, j, mw, nw;
+  __mmask16 m0, m1;
+  int32_t *c = (int32_t *)C;
+
+  for (j = 0; j < bn; j += 8) {
+
+    nw = bn - j;
+    if (nw > 8) nw = 8;
+
+    for (i = 0; i < bm; i += 32) {
+
+      mw = bm - i;
+      if (mw > 32) mw = 32;
+
+      m0 = (mw >= 16) ? 0xffff : (__mmask16)((1U << mw) - 1);
+      m1 = (mw >= 32) ? 0xffff : ((mw > 16) ? (__mmask16)((1U << (mw - 16)) - 1) : 0);
+
+      if (nw == 8)
+	i8_block_8(mw, bk, (unsigned char *)ba + i * bk, (signed char *)bb + j * bk,
+		   c + i + j * ldc, ldc, alpha, m0, m1);
+      else
+	i8_block_n(mw, nw, bk, (unsigned char *)ba + i * bk, (signed char *)bb + j * bk,
+		   c + i + j * ldc, ldc, alpha, m0, m1);
+    }
+  }
+
+  return 0;
+}
+
+#else
+
+/* no AVX512BW available to the compiler: portable kernel with the same panel layout */
+#define I8GEMM_KERNEL_M 32
+#define I8GEMM_KERNEL_N 8
+#include "../generic/i8gemm_kernel.c"
+
+#endif
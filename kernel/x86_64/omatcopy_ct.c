@@ -0,0 +1,220 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "common.h"
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*****************************************************
+ * b = alpha * a' (column major, or row major with ROWM)
+ *
+ * The matrix is walked in TILE x TILE blocks, so that
+ * the rows of b written for one block stay in L1, and
+ * each block is transposed in RB x RB register tiles.
+ *
+******************************************************/
+
+#define TILE 32
+
+#if defined(__AVX__) && !defined(DOUBLE)
+
+#define RB 8
+
+static inline void trans_micro(FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	__m256 va = _mm256_set1_ps(alpha);
+	__m256 r0, r1, r2, r3, r4, r5, r6, r7;
+	__m256 t0, t1, t2, t3, t4, t5, t6, t7;
+
+	r0 = _mm256_mul_ps(va, _mm256_loadu_ps(a + 0 * lda));
+	r1 = _mm256_mul_ps(va, _mm256_loadu_ps(a + 1 * lda));
+	r2 = _mm256_mul_ps(va, _mm256_loadu_ps(a + 2 * lda));
+	r3 = _mm256_mul_ps(va, _mm256_loadu_ps(a + 3 * lda));
+	r4 = _mm256_mul_ps(va, _mm256_loadu_ps(a + 4 * lda));
+	r5 = _mm256_mul_ps(va, _mm256_loadu_ps(a + 5 * lda));
+	r6 = _mm256_mul_ps(va, _mm256_loadu_ps(a + 6 * lda));
+	r7 = _mm256_mul_ps(va, _mm256_loadu_ps(a + 7 * lda));
+
+	t0 = _mm256_unpacklo_ps(r0, r1);
+	t1 = _mm256_unpackhi_ps(r0, r1);
+	t2 = _mm256_unpacklo_ps(r2, r3);
+	t3 = _mm256_unpackhi_ps(r2, r3);
+	t4 = _mm256_unpacklo_ps(r4, r5);
+	t5 = _mm256_unpackhi_ps(r4, r5);
+	t6 = _mm256_unpacklo_ps(r6, r7);
+	t7 = _mm256_unpackhi_ps(r6, r7);
+
+	r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+	r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+	r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+	r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+	_mm256_storeu_ps(b + 0 * ldb, _mm256_permute2f128_ps(r0, r4, 0x20));
+	_mm256_storeu_ps(b + 1 * ldb, _mm256_permute2f128_ps(r1, r5, 0x20));
+	_mm256_storeu_ps(b + 2 * ldb, _mm256_permute2f128_ps(r2, r6, 0x20));
+	_mm256_storeu_ps(b + 3 * ldb, _mm256_permute2f128_ps(r3, r7, 0x20));
+	_mm256_storeu_ps(b + 4 * ldb, _mm256_permute2f128_ps(r0, r4, 0x31));
+	_mm256_storeu_ps(b + 5 * ldb, _mm256_permute2f128_ps(r1, r5, 0x31));
+	_mm256_storeu_ps(b + 6 * ldb, _mm256_permute2f128_ps(r2, r6, 0x31));
+	_mm256_storeu_ps(b + 7 * ldb, _mm256_permute2f128_ps(r3, r7, 0x31));
+}
+
+#elif defined(__AVX__)
+
+#define RB 4
+
+static inline void trans_micro(FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	__m256d va = _mm256_set1_pd(alpha);
+	__m256d r0, r1, r2, r3, t0, t1, t2, t3;
+
+	r0 = _mm256_mul_pd(va, _mm256_loadu_pd(a + 0 * lda));
+	r1 = _mm256_mul_pd(va, _mm256_loadu_pd(a + 1 * lda));
+	r2 = _mm256_mul_pd(va, _mm256_loadu_pd(a + 2 * lda));
+	r3 = _mm256_mul_pd(va, _mm256_loadu_pd(a + 3 * lda));
+
+	t0 = _mm256_unpacklo_pd(r0, r1);
+	t1 = _mm256_unpackhi_pd(r0, r1);
+	t2 = _mm256_unpacklo_pd(r2, r3);
+	t3 = _mm256_unpackhi_pd(r2, r3);
+
+	_mm256_storeu_pd(b + 0 * ldb, _mm256_permute2f128_pd(t0, t2, 0x20));
+	_mm256_storeu_pd(b + 1 * ldb, _mm256_permute2f128_pd(t1, t3, 0x20));
+	_mm256_storeu_pd(b + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+	_mm256_storeu_pd(b + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+#elif defined(__SSE2__) && !defined(DOUBLE)
+
+#define RB 4
+
+static inline void trans_micro(FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	__m128 va = _mm_set1_ps(alpha);
+	__m128 r0, r1, r2, r3;
+
+	r0 = _mm_mul_ps(va, _mm_loadu_ps(a + 0 * lda));
+	r1 = _mm_mul_ps(va, _mm_loadu_ps(a + 1 * lda));
+	r2 = _mm_mul_ps(va, _mm_loadu_ps(a + 2 * lda));
+	r3 = _mm_mul_ps(va, _mm_loadu_ps(a + 3 * lda));
+
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+	_mm_storeu_ps(b + 0 * ldb, r0);
+	_mm_storeu_ps(b + 1 * ldb, r1);
+	_mm_storeu_ps(b + 2 * ldb, r2);
+	_mm_storeu_ps(b + 3 * ldb, r3);
+}
+
+#elif defined(__SSE2__)
+
+#define RB 2
+
+static inline void trans_micro(FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	__m128d va = _mm_set1_pd(alpha);
+	__m128d r0, r1;
+
+	r0 = _mm_mul_pd(va, _mm_loadu_pd(a + 0 * lda));
+	r1 = _mm_mul_pd(va, _mm_loadu_pd(a + 1 * lda));
+
+	_mm_storeu_pd(b + 0 * ldb, _mm_unpacklo_pd(r0, r1));
+	_mm_storeu_pd(b + 1 * ldb, _mm_unpackhi_pd(r0, r1));
+}
+
+#else
+
+#define RB 1
+
+static inline void trans_micro(FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	b[0] = alpha * a[0];
+}
+
+#endif
+
+static void trans_tile(BLASLONG m, BLASLONG n, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i, j, jj;
+	BLASLONG m_rb = m & -RB;
+	BLASLONG n_rb = n & -RB;
+
+	for (j = 0; j < n_rb; j += RB) {
+		for (i = 0; i < m_rb; i += RB)
+			trans_micro(alpha, a + i + j * lda, lda, b + j + i * ldb, ldb);
+		for (; i < m; i++)
+			for (jj = j; jj < j + RB; jj++)
+				b[jj + i * ldb] = alpha * a[i + jj * lda];
+	}
+
+	for (; j < n; j++)
+		for (i = 0; i < m; i++)
+			b[j + i * ldb] = alpha * a[i + j * lda];
+}
+
+int CNAME(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i, j, m, n;
+
+	if ( rows <= 0     )  return(0);
+	if ( cols <= 0     )  return(0);
+
+#ifdef ROWM
+	m = cols;
+	n = rows;
+#else
+	m = rows;
+	n = cols;
+#endif
+
+	/* b is cleared rather than scaled, so that NaN or Inf in a do not propagate */
+	if ( alpha == ZERO )
+	{
+		for (i = 0; i < m; i++)
+			for (j = 0; j < n; j++)
+				b[j + i * ldb] = ZERO;
+		return(0);
+	}
+
+	for (j = 0; j < n; j += TILE)
+		for (i = 0; i < m; i += TILE)
+			trans_tile(MIN(TILE, m - i), MIN(TILE, n - j), alpha,
+				   a + i + j * lda, lda, b + j + i * ldb, ldb);
+
+	return(0);
+}
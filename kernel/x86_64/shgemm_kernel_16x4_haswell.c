@@ -0,0 +1,273 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * SHGEMM kernel: C += alpha * A * B with A and B packed as IEEE binary16
+ * (16-row panels of A from gemm_ncopy_16/gemm_tcopy_16, 4-column panels of
+ * B from gemm_ncopy_4/gemm_tcopy_4, tails packed as 8/4/2/1 and 2/1) and C
+ * in fp32.  Inputs are widened with vcvtph2ps and accumulated in fp32; the
+ * AVX512-FP16 arithmetic instructions are not used since they accumulate in
+ * binary16.
+ */
+
+#include <immintrin.h>
+#include "common.h"
+
+#if defined(__AVX512F__)
+#define HAVE_SHGEMM_VEC16
+#define HAVE_SHGEMM_VEC8
+#elif defined(__F16C__) && defined(__FMA__) && defined(__AVX2__)
+#define HAVE_SHGEMM_VEC8
+#endif
+
+/* scalar reference for the narrow tails (and for builds without F16C) */
+static void shgemm_tile(BLASLONG mr, BLASLONG nr, BLASLONG k, float alpha,
+                        hfloat16 *a, hfloat16 *b, float *c, BLASLONG ldc)
+{
+  BLASLONG i, j, l;
+  float acc[16 * 4];
+
+  for (i = 0; i < mr * nr; i++) acc[i] = 0.0f;
+
+  for (l = 0; l < k; l++) {
+    for (j = 0; j < nr; j++) {
+      float bv = hfloat16tof32(b[l * nr + j]);
+      for (i = 0; i < mr; i++)
+        acc[j * mr + i] += hfloat16tof32(a[l * mr + i]) * bv;
+    }
+  }
+
+  for (j = 0; j < nr; j++)
+    for (i = 0; i < mr; i++)
+      c[i + j * ldc] += alpha * acc[j * mr + i];
+}
+
+#ifdef HAVE_SHGEMM_VEC8
+#define LOAD_B4(b, b0, b1, b2, b3) { \
+  __m128 bv = _mm_cvtph_ps(_mm_loadl_epi64((__m128i *)(b))); \
+  b0 = _mm256_broadcastss_ps(bv); \
+  b1 = _mm256_broadcastss_ps(_mm_shuffle_ps(bv, bv, 0x55)); \
+  b2 = _mm256_broadcastss_ps(_mm_shuffle_ps(bv, bv, 0xaa)); \
+  b3 = _mm256_broadcastss_ps(_mm_shuffle_ps(bv, bv, 0xff)); \
+}
+
+#define LOAD_A8(a) _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)(a)))
+
+#define STORE_C8(c, acc) \
+  _mm256_storeu_ps((c), _mm256_fmadd_ps(valpha, (acc), _mm256_loadu_ps(c)))
+
+static void shgemm_kernel_8xn(BLASLONG nr, BLASLONG k, float alpha,
+                              hfloat16 *a, hfloat16 *b, float *c, BLASLONG ldc)
+{
+  __m256 valpha = _mm256_set1_ps(alpha);
+  __m256 c0 = _mm256_setzero_ps(), c1 = _mm256_setzero_ps();
+  __m256 c2 = _mm256_setzero_ps(), c3 = _mm256_setzero_ps();
+  __m256 a0, b0, b1, b2, b3;
+  BLASLONG l;
+
+  if (nr == 4) {
+    for (l = 0; l < k; l++) {
+      a0 = LOAD_A8(a);
+      LOAD_B4(b, b0, b1, b2, b3);
+      c0 = _mm256_fmadd_ps(a0, b0, c0);
+      c1 = _mm256_fmadd_ps(a0, b1, c1);
+      c2 = _mm256_fmadd_ps(a0, b2, c2);
+      c3 = _mm256_fmadd_ps(a0, b3, c3);
+      a += 8;
+      b += 4;
+    }
+    STORE_C8(c + 0 * ldc, c0);
+    STORE_C8(c + 1 * ldc, c1);
+    STORE_C8(c + 2 * ldc, c2);
+    STORE_C8(c + 3 * ldc, c3);
+  } else if (nr == 2) {
+    for (l = 0; l < k; l++) {
+      a0 = LOAD_A8(a);
+      c0 = _mm256_fmadd_ps(a0, _mm256_set1_ps(_cvtsh_ss(b[0])), c0);
+      c1 = _mm256_fmadd_ps(a0, _mm256_set1_ps(_cvtsh_ss(b[1])), c1);
+      a += 8;
+      b += 2;
+    }
+    STORE_C8(c + 0 * ldc, c0);
+    STORE_C8(c + 1 * ldc, c1);
+  } else {
+    for (l = 0; l < k; l++) {
+      c0 = _mm256_fmadd_ps(LOAD_A8(a), _mm256_set1_ps(_cvtsh_ss(b[0])), c0);
+      a += 8;
+      b += 1;
+    }
+    STORE_C8(c, c0);
+  }
+}
+#endif
+
+#ifdef HAVE_SHGEMM_VEC16
+#define LOAD_A16(a) _mm512_cvtph_ps(_mm256_loadu_si256((__m256i *)(a)))
+
+#define STORE_C16(c, acc) \
+  _mm512_storeu_ps((c), _mm512_fmadd_ps(valpha, (acc), _mm512_loadu_ps(c)))
+
+static void shgemm_kernel_16xn(BLASLONG nr, BLASLONG k, float alpha,
+                               hfloat16 *a, hfloat16 *b, float *c, BLASLONG ldc)
+{
+  __m512 valpha = _mm512_set1_ps(alpha);
+  __m512 c0 = _mm512_setzero_ps(), c1 = _mm512_setzero_ps();
+  __m512 c2 = _mm512_setzero_ps(), c3 = _mm512_setzero_ps();
+  __m512 a0;
+  __m128 bv;
+  BLASLONG l;
+
+  if (nr == 4) {
+    for (l = 0; l < k; l++) {
+      a0 = LOAD_A16(a);
+      bv = _mm_cvtph_ps(_mm_loadl_epi64((__m128i *)b));
+      c0 = _mm512_fmadd_ps(a0, _mm512_broadcastss_ps(bv), c0);
+      c1 = _mm512_fmadd_ps(a0, _mm512_broadcastss_ps(_mm_shuffle_ps(bv, bv, 0x55)), c1);
+      c2 = _mm512_fmadd_ps(a0, _mm512_broadcastss_ps(_mm_shuffle_ps(bv, bv, 0xaa)), c2);
+      c3 = _mm512_fmadd_ps(a0, _mm512_broadcastss_ps(_mm_shuffle_ps(bv, bv, 0xff)), c3);
+      a += 16;
+      b += 4;
+    }
+    STORE_C16(c + 0 * ldc, c0);
+    STORE_C16(c + 1 * ldc, c1);
+    STORE_C16(c + 2 * ldc, c2);
+    STORE_C16(c + 3 * ldc, c3);
+  } else if (nr == 2) {
+    for (l = 0; l < k; l++) {
+      a0 = LOAD_A16(a);
+      c0 = _mm512_fmadd_ps(a0, _mm512_set1_ps(_cvtsh_ss(b[0])), c0);
+      c1 = _mm512_fmadd_ps(a0, _mm512_set1_ps(_cvtsh_ss(b[1])), c1);
+      a += 16;
+      b += 2;
+    }
+    STORE_C16(c + 0 * ldc, c0);
+    STORE_C16(c + 1 * ldc, c1);
+  } else {
+    for (l = 0; l < k; l++) {
+      c0 = _mm512_fmadd_ps(LOAD_A16(a), _mm512_set1_ps(_cvtsh_ss(b[0])), c0);
+      a += 16;
+      b += 1;
+    }
+    STORE_C16(c, c0);
+  }
+}
+#elif defined(HAVE_SHGEMM_VEC8)
+/* AVX2: a 16-row panel is handled as two interleaved 8-row halves */
+static void shgemm_kernel_16xn(BLASLONG nr, BLASLONG k, float alpha,
+                               hfloat16 *a, hfloat16 *b, float *c, BLASLONG ldc)
+{
+  __m256 valpha = _mm256_set1_ps(alpha);
+  __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+  __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+  __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+  __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+  __m256 a0, a1, b0, b1, b2, b3;
+  BLASLONG l;
+
+  if (nr == 4) {
+    for (l = 0; l < k; l++) {
+      a0 = LOAD_A8(a);
+      a1 = LOAD_A8(a + 8);
+      LOAD_B4(b, b0, b1, b2, b3);
+      c00 = _mm256_fmadd_ps(a0, b0, c00);
+      c01 = _mm256_fmadd_ps(a1, b0, c01);
+      c10 = _mm256_fmadd_ps(a0, b1, c10);
+      c11 = _mm256_fmadd_ps(a1, b1, c11);
+      c20 = _mm256_fmadd_ps(a0, b2, c20);
+      c21 = _mm256_fmadd_ps(a1, b2, c21);
+      c30 = _mm256_fmadd_ps(a0, b3, c30);
+      c31 = _mm256_fmadd_ps(a1, b3, c31);
+      a += 16;
+      b += 4;
+    }
+    STORE_C8(c + 0 * ldc, c00); STORE_C8(c + 0 * ldc + 8, c01);
+    STORE_C8(c + 1 * ldc, c10); STORE_C8(c + 1 * ldc + 8, c11);
+    STORE_C8(c + 2 * ldc, c20); STORE_C8(c + 2 * ldc + 8, c21);
+    STORE_C8(c + 3 * ldc, c30); STORE_C8(c + 3 * ldc + 8, c31);
+  } else {
+    for (l = 0; l < k; l++) {
+      a0 = LOAD_A8(a);
+      a1 = LOAD_A8(a + 8);
+      b0 = _mm256_set1_ps(_cvtsh_ss(b[0]));
+      c00 = _mm256_fmadd_ps(a0, b0, c00);
+      c01 = _mm256_fmadd_ps(a1, b0, c01);
+      if (nr == 2) {
+        b1 = _mm256_set1_ps(_cvtsh_ss(b[1]));
+        c10 = _mm256_fmadd_ps(a0, b1, c10);
+        c11 = _mm256_fmadd_ps(a1, b1, c11);
+      }
+      a += 16;
+      b += nr;
+    }
+    STORE_C8(c, c00); STORE_C8(c + 8, c01);
+    if (nr == 2) {
+      STORE_C8(c + ldc, c10); STORE_C8(c + ldc + 8, c11);
+    }
+  }
+}
+#endif
+
+int CNAME(BLASLONG bm, BLASLONG bn, BLASLONG bk, float alpha,
+          hfloat16 *ba, hfloat16 *bb, float *C, BLASLONG ldc)
+{
+  BLASLONG i, j, mr, nr;
+  hfloat16 *ptrba;
+  float *c;
+
+  if (bm == 0 || bn == 0 || bk == 0) return 0;
+
+  for (j = 0; j < bn; j += nr) {
+    nr = bn - j;
+    if (nr >= 4) nr = 4; else if (nr >= 2) nr = 2;
+
+    ptrba = ba;
+    c = C + j * ldc;
+
+    for (i = 0; i < bm; i += mr) {
+      mr = bm - i;
+      if (mr >= 16) mr = 16;
+      else if (mr >= 8) mr = 8;
+      else if (mr >= 4) mr = 4;
+      else if (mr >= 2) mr = 2;
+
+#ifdef HAVE_SHGEMM_VEC8
+      if (mr == 16)
+        shgemm_kernel_16xn(nr, bk, alpha, ptrba, bb, c + i, ldc);
+      else if (mr == 8)
+        shgemm_kernel_8xn(nr, bk, alpha, ptrba, bb, c + i, ldc);
+      else
+#endif
+        shgemm_tile(mr, nr, bk, alpha, ptrba, bb, c + i, ldc);
+
+      ptrba += mr * bk;
+    }
+
+    bb += nr * bk;
+  }
+
+  return 0;
+}
@@ -0,0 +1,115 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+#if (defined(__F16C__) && defined(__FMA__) && defined(__AVX2__)) || defined(__AVX512F__)
+#include <immintrin.h>
+
+#define LOAD_A8(p) _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)(p)))
+
+/* y += A(:, 0:4) * xv for unit-stride y; xv already scaled by alpha */
+static void shgemv_kernel_4x8(BLASLONG m, hfloat16 **ap, float *xv, float *y)
+{
+	BLASLONG i;
+	__m256 x0 = _mm256_set1_ps(xv[0]);
+	__m256 x1 = _mm256_set1_ps(xv[1]);
+	__m256 x2 = _mm256_set1_ps(xv[2]);
+	__m256 x3 = _mm256_set1_ps(xv[3]);
+
+	for (i = 0; i < (m & -8); i += 8) {
+		__m256 yv = _mm256_loadu_ps(y + i);
+		yv = _mm256_fmadd_ps(LOAD_A8(ap[0] + i), x0, yv);
+		yv = _mm256_fmadd_ps(LOAD_A8(ap[1] + i), x1, yv);
+		yv = _mm256_fmadd_ps(LOAD_A8(ap[2] + i), x2, yv);
+		yv = _mm256_fmadd_ps(LOAD_A8(ap[3] + i), x3, yv);
+		_mm256_storeu_ps(y + i, yv);
+	}
+	for (; i < m; i++) {
+		y[i] += _cvtsh_ss(ap[0][i]) * xv[0] + _cvtsh_ss(ap[1][i]) * xv[1]
+		      + _cvtsh_ss(ap[2][i]) * xv[2] + _cvtsh_ss(ap[3][i]) * xv[3];
+	}
+}
+
+static void shgemv_kernel_1x8(BLASLONG m, hfloat16 *ap, float xv, float *y)
+{
+	BLASLONG i;
+	__m256 x0 = _mm256_set1_ps(xv);
+
+	for (i = 0; i < (m & -8); i += 8)
+		_mm256_storeu_ps(y + i, _mm256_fmadd_ps(LOAD_A8(ap + i), x0, _mm256_loadu_ps(y + i)));
+	for (; i < m; i++)
+		y[i] += _cvtsh_ss(ap[i]) * xv;
+}
+#define HAVE_SHGEMV_N_VEC
+#endif
+
+/* y = alpha * A * x + beta * y with A and x in IEEE binary16, y in fp32 */
+int CNAME(BLASLONG m, BLASLONG n, float alpha, hfloat16 *a, BLASLONG lda, hfloat16 *x, BLASLONG incx, float beta, float *y, BLASLONG incy)
+{
+	BLASLONG i, j, iy;
+
+	if (m < 1 || n < 1) return(0);
+
+	iy = 0;
+	for (i = 0; i < m; i++) {
+		if (beta == ZERO)
+			y[iy] = ZERO;
+		else
+			y[iy] *= beta;
+		iy += incy;
+	}
+
+#ifdef HAVE_SHGEMV_N_VEC
+	if (incy == 1) {
+		hfloat16 *ap[4];
+		float xv[4];
+
+		for (j = 0; j < (n & -4); j += 4) {
+			ap[0] = a + (j + 0) * lda; xv[0] = alpha * _cvtsh_ss(x[(j + 0) * incx]);
+			ap[1] = a + (j + 1) * lda; xv[1] = alpha * _cvtsh_ss(x[(j + 1) * incx]);
+			ap[2] = a + (j + 2) * lda; xv[2] = alpha * _cvtsh_ss(x[(j + 2) * incx]);
+			ap[3] = a + (j + 3) * lda; xv[3] = alpha * _cvtsh_ss(x[(j + 3) * incx]);
+			shgemv_kernel_4x8(m, ap, xv, y);
+		}
+		for (; j < n; j++)
+			shgemv_kernel_1x8(m, a + j * lda, alpha * _cvtsh_ss(x[j * incx]), y);
+		return(0);
+	}
+#endif
+
+	for (j = 0; j < n; j++) {
+		float temp = alpha * hfloat16tof32(x[j * incx]);
+		hfloat16 *a_ptr = a + j * lda;
+		iy = 0;
+		for (i = 0; i < m; i++) {
+			y[iy] += temp * hfloat16tof32(a_ptr[i]);
+			iy += incy;
+		}
+	}
+	return(0);
+}
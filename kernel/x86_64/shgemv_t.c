@@ -0,0 +1,133 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+#if (defined(__F16C__) && defined(__FMA__) && defined(__AVX2__)) || defined(__AVX512F__)
+#include <immintrin.h>
+
+#define LOAD_8(p) _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)(p)))
+
+static float hsum256(__m256 v)
+{
+	__m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+	s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+	s = _mm_add_ss(s, _mm_movehdup_ps(s));
+	return _mm_cvtss_f32(s);
+}
+
+/* dot products of four columns of A with a unit-stride x */
+static void shgemv_kernel_4x8(BLASLONG m, hfloat16 **ap, hfloat16 *x, float *dot)
+{
+	BLASLONG i;
+	__m256 d0 = _mm256_setzero_ps(), d1 = _mm256_setzero_ps();
+	__m256 d2 = _mm256_setzero_ps(), d3 = _mm256_setzero_ps();
+
+	for (i = 0; i < (m & -8); i += 8) {
+		__m256 xv = LOAD_8(x + i);
+		d0 = _mm256_fmadd_ps(LOAD_8(ap[0] + i), xv, d0);
+		d1 = _mm256_fmadd_ps(LOAD_8(ap[1] + i), xv, d1);
+		d2 = _mm256_fmadd_ps(LOAD_8(ap[2] + i), xv, d2);
+		d3 = _mm256_fmadd_ps(LOAD_8(ap[3] + i), xv, d3);
+	}
+	dot[0] = hsum256(d0);
+	dot[1] = hsum256(d1);
+	dot[2] = hsum256(d2);
+	dot[3] = hsum256(d3);
+	for (; i < m; i++) {
+		float xs = _cvtsh_ss(x[i]);
+		dot[0] += _cvtsh_ss(ap[0][i]) * xs;
+		dot[1] += _cvtsh_ss(ap[1][i]) * xs;
+		dot[2] += _cvtsh_ss(ap[2][i]) * xs;
+		dot[3] += _cvtsh_ss(ap[3][i]) * xs;
+	}
+}
+
+static float shgemv_kernel_1x8(BLASLONG m, hfloat16 *ap, hfloat16 *x)
+{
+	BLASLONG i;
+	__m256 d0 = _mm256_setzero_ps();
+	float dot;
+
+	for (i = 0; i < (m & -8); i += 8)
+		d0 = _mm256_fmadd_ps(LOAD_8(ap + i), LOAD_8(x + i), d0);
+	dot = hsum256(d0);
+	for (; i < m; i++)
+		dot += _cvtsh_ss(ap[i]) * _cvtsh_ss(x[i]);
+	return dot;
+}
+#define HAVE_SHGEMV_T_VEC
+#endif
+
+/* y = alpha * A**T * x + beta * y with A and x in IEEE binary16, y in fp32 */
+int CNAME(BLASLONG m, BLASLONG n, float alpha, hfloat16 *a, BLASLONG lda, hfloat16 *x, BLASLONG incx, float beta, float *y, BLASLONG incy)
+{
+	BLASLONG i, j;
+	float dot[4];
+
+	if (m < 1 || n < 1) return(0);
+
+	for (j = 0; j < n; ) {
+#ifdef HAVE_SHGEMV_T_VEC
+		if (incx == 1 && j + 4 <= n) {
+			hfloat16 *ap[4];
+			BLASLONG jj;
+
+			ap[0] = a + (j + 0) * lda;
+			ap[1] = a + (j + 1) * lda;
+			ap[2] = a + (j + 2) * lda;
+			ap[3] = a + (j + 3) * lda;
+			shgemv_kernel_4x8(m, ap, x, dot);
+
+			for (jj = 0; jj < 4; jj++) {
+				if (beta == ZERO)
+					y[(j + jj) * incy] = alpha * dot[jj];
+				else
+					y[(j + jj) * incy] = alpha * dot[jj] + beta * y[(j + jj) * incy];
+			}
+			j += 4;
+			continue;
+		}
+		if (incx == 1) {
+			dot[0] = shgemv_kernel_1x8(m, a + j * lda, x);
+		} else
+#endif
+		{
+			hfloat16 *a_ptr = a + j * lda;
+			dot[0] = 0.0;
+			for (i = 0; i < m; i++)
+				dot[0] += hfloat16tof32(a_ptr[i]) * hfloat16tof32(x[i * incx]);
+		}
+
+		if (beta == ZERO)
+			y[j * incy] = alpha * dot[0];
+		else
+			y[j * incy] = alpha * dot[0] + beta * y[j * incy];
+		j++;
+	}
+	return(0);
+}
@@ -0,0 +1,200 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "common.h"
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+/*****************************************************
+ * b = alpha * a' (column major, or row major with ROWM),
+ * b = alpha * conj(a') with CONJ
+ *
+ * The matrix is walked in TILE x TILE blocks, so that
+ * the rows of b written for one block stay in L1, and
+ * each block is transposed in RB x RB register tiles.
+ *
+******************************************************/
+
+#define TILE 16
+
+#if defined(__AVX__)
+
+/* alpha * x as x * ar + swap(x) * ai, with the signs for CONJ folded into ar and ai */
+
+#ifndef DOUBLE
+
+#define RB 4
+
+static inline __m256 cmul(__m256 x, __m256 ar, __m256 ai)
+{
+	return _mm256_add_ps(_mm256_mul_ps(x, ar), _mm256_mul_ps(_mm256_permute_ps(x, 0xb1), ai));
+}
+
+static inline void trans_micro(FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+#ifndef CONJ
+	__m256 ar = _mm256_set1_ps(alpha_r);
+	__m256 ai = _mm256_set_ps(alpha_i, -alpha_i, alpha_i, -alpha_i, alpha_i, -alpha_i, alpha_i, -alpha_i);
+#else
+	__m256 ar = _mm256_set_ps(-alpha_r, alpha_r, -alpha_r, alpha_r, -alpha_r, alpha_r, -alpha_r, alpha_r);
+	__m256 ai = _mm256_set1_ps(alpha_i);
+#endif
+	__m256d r0, r1, r2, r3, t0, t1, t2, t3;
+
+	/* a single complex is 64 bits wide, so the 4x4 tile is transposed like one of doubles */
+	r0 = _mm256_castps_pd(cmul(_mm256_loadu_ps(a + 0 * lda), ar, ai));
+	r1 = _mm256_castps_pd(cmul(_mm256_loadu_ps(a + 1 * lda), ar, ai));
+	r2 = _mm256_castps_pd(cmul(_mm256_loadu_ps(a + 2 * lda), ar, ai));
+	r3 = _mm256_castps_pd(cmul(_mm256_loadu_ps(a + 3 * lda), ar, ai));
+
+	t0 = _mm256_unpacklo_pd(r0, r1);
+	t1 = _mm256_unpackhi_pd(r0, r1);
+	t2 = _mm256_unpacklo_pd(r2, r3);
+	t3 = _mm256_unpackhi_pd(r2, r3);
+
+	_mm256_storeu_pd((double *)(b + 0 * ldb), _mm256_permute2f128_pd(t0, t2, 0x20));
+	_mm256_storeu_pd((double *)(b + 1 * ldb), _mm256_permute2f128_pd(t1, t3, 0x20));
+	_mm256_storeu_pd((double *)(b + 2 * ldb), _mm256_permute2f128_pd(t0, t2, 0x31));
+	_mm256_storeu_pd((double *)(b + 3 * ldb), _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+#else
+
+#define RB 2
+
+static inline __m256d cmul(__m256d x, __m256d ar, __m256d ai)
+{
+	return _mm256_add_pd(_mm256_mul_pd(x, ar), _mm256_mul_pd(_mm256_permute_pd(x, 0x5), ai));
+}
+
+static inline void trans_micro(FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+#ifndef CONJ
+	__m256d ar = _mm256_set1_pd(alpha_r);
+	__m256d ai = _mm256_set_pd(alpha_i, -alpha_i, alpha_i, -alpha_i);
+#else
+	__m256d ar = _mm256_set_pd(-alpha_r, alpha_r, -alpha_r, alpha_r);
+	__m256d ai = _mm256_set1_pd(alpha_i);
+#endif
+	__m256d r0, r1;
+
+	r0 = cmul(_mm256_loadu_pd(a + 0 * lda), ar, ai);
+	r1 = cmul(_mm256_loadu_pd(a + 1 * lda), ar, ai);
+
+	_mm256_storeu_pd(b + 0 * ldb, _mm256_permute2f128_pd(r0, r1, 0x20));
+	_mm256_storeu_pd(b + 1 * ldb, _mm256_permute2f128_pd(r0, r1, 0x31));
+}
+
+#endif
+
+#else
+
+#define RB 1
+
+static inline void trans_micro(FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+#ifndef CONJ
+	b[0] = alpha_r * a[0] - alpha_i * a[1];
+	b[1] = alpha_r * a[1] + alpha_i * a[0];
+#else
+	b[0] = alpha_r * a[0] + alpha_i * a[1];
+	b[1] = - alpha_r * a[1] + alpha_i * a[0];
+#endif
+}
+
+#endif
+
+static void trans_tile(BLASLONG m, BLASLONG n, FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i, j, ii, jj;
+	BLASLONG m_rb = m & -RB;
+	BLASLONG n_rb = n & -RB;
+	FLOAT *ap, *bp;
+
+	for (j = 0; j < n; j += RB) {
+		for (i = 0; i < m; i += RB) {
+			ap = a + (i + j * lda) * 2;
+			bp = b + (j + i * ldb) * 2;
+			if (i < m_rb && j < n_rb) {
+				trans_micro(alpha_r, alpha_i, ap, lda * 2, bp, ldb * 2);
+			} else {
+				for (jj = 0; jj < MIN(RB, n - j); jj++)
+					for (ii = 0; ii < MIN(RB, m - i); ii++)
+#ifndef CONJ
+					{
+						bp[(jj + ii * ldb) * 2    ] = alpha_r * ap[(ii + jj * lda) * 2    ] - alpha_i * ap[(ii + jj * lda) * 2 + 1];
+						bp[(jj + ii * ldb) * 2 + 1] = alpha_r * ap[(ii + jj * lda) * 2 + 1] + alpha_i * ap[(ii + jj * lda) * 2    ];
+					}
+#else
+					{
+						bp[(jj + ii * ldb) * 2    ] =   alpha_r * ap[(ii + jj * lda) * 2    ] + alpha_i * ap[(ii + jj * lda) * 2 + 1];
+						bp[(jj + ii * ldb) * 2 + 1] = - alpha_r * ap[(ii + jj * lda) * 2 + 1] + alpha_i * ap[(ii + jj * lda) * 2    ];
+					}
+#endif
+			}
+		}
+	}
+}
+
+int CNAME(BLASLONG rows, BLASLONG cols, FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i, j, m, n;
+
+	if ( rows <= 0     )  return(0);
+	if ( cols <= 0     )  return(0);
+
+#ifdef ROWM
+	m = cols;
+	n = rows;
+#else
+	m = rows;
+	n = cols;
+#endif
+
+	/* b is cleared rather than scaled, so that NaN or Inf in a do not propagate */
+	if ( alpha_r == ZERO && alpha_i == ZERO )
+	{
+		for (i = 0; i < m; i++)
+			for (j = 0; j < n * 2; j++)
+				b[j + i * ldb * 2] = ZERO;
+		return(0);
+	}
+
+	for (j = 0; j < n; j += TILE)
+		for (i = 0; i < m; i += TILE)
+			trans_tile(MIN(TILE, m - i), MIN(TILE, n - j), alpha_r, alpha_i,
+				   a + (i + j * lda) * 2, lda, b + (j + i * ldb) * 2, ldb);
+
+	return(0);
+}
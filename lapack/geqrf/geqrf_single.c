@@ -0,0 +1,172 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* Blocked Householder QR, A = Q R, as LAPACK ?geqrf.                   */
+/*                                                                      */
+/*   args -> m, n : size of A          args -> a : A (lda)              */
+/*   args -> c    : tau                args -> b : workspace            */
+/*                                                                      */
+/* The workspace holds T (QR_NB x QR_NB) followed by W (QR_NB x n).     */
+/* Panels of QR_NB columns are factored recursively, so that the panel  */
+/* itself runs mostly in TRMM and GEMM, and the trailing matrix is then */
+/* updated with one ?larfb.  The T of the last panel is left at the     */
+/* start of the workspace for GEQRF_PARALLEL.                           */
+
+static FLOAT dp1 =  1.;
+static FLOAT dm1 = -1.;
+
+/* Factors an m x n panel (m >= n) and forms its T. */
+static void qr_rec(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG lda, FLOAT *tau,
+		   FLOAT *t, BLASLONG ldt, FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG n1, n2;
+  FLOAT *t12;
+  blas_arg_t newarg;
+
+  if (n == 1) {
+    tau[0] = LARFG(m, a);
+    t[0]   = tau[0];
+    return;
+  }
+
+  n1  = n / 2;
+  n2  = n - n1;
+  t12 = t + n1 * ldt;
+
+  qr_rec(m, n1, a, lda, tau, t, ldt, sa, sb);
+
+  /* A2 := H1' A2, with T12 as the scratch block */
+  newarg.m   = m;
+  newarg.n   = n2;
+  newarg.k   = n1;
+  newarg.a   = a;
+  newarg.lda = lda;
+  newarg.b   = t;
+  newarg.ldb = ldt;
+  newarg.c   = a + n1 * lda;
+  newarg.ldc = lda;
+  newarg.d   = t12;
+  newarg.ldd = ldt;
+  LARFB_LT(&newarg, NULL, NULL, sa, sb, 0);
+
+  qr_rec(m - n1, n2, a + n1 + n1 * lda, lda, tau + n1, t + n1 + n1 * ldt, ldt, sa, sb);
+
+  /* T12 := -T11 (V1' V2) T22 */
+  OMATCOPY_K_CT(n2, n1, ONE, a + n1, lda, t12, ldt);
+
+  newarg.m     = n1;
+  newarg.n     = n2;
+  newarg.a     = a + n1 + n1 * lda;
+  newarg.lda   = lda;
+  newarg.b     = t12;
+  newarg.ldb   = ldt;
+  newarg.alpha = NULL;
+  newarg.beta  = NULL;
+  TRMM_RNLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  if (m > n) {
+    newarg.m     = n1;
+    newarg.n     = n2;
+    newarg.k     = m - n;
+    newarg.a     = a + n;
+    newarg.lda   = lda;
+    newarg.b     = a + n + n1 * lda;
+    newarg.ldb   = lda;
+    newarg.c     = t12;
+    newarg.ldc   = ldt;
+    newarg.alpha = &dp1;
+    newarg.beta  = &dp1;
+    GEMM_TN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  newarg.m     = n1;
+  newarg.n     = n2;
+  newarg.a     = t;
+  newarg.lda   = ldt;
+  newarg.b     = t12;
+  newarg.ldb   = ldt;
+  newarg.alpha = NULL;
+  newarg.beta  = &dm1;
+  TRMM_LNUN(&newarg, NULL, NULL, sa, sb, 0);
+
+  newarg.a     = t + n1 + n1 * ldt;
+  newarg.beta  = NULL;
+  TRMM_RNUN(&newarg, NULL, NULL, sa, sb, 0);
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, mn, lda;
+  BLASLONG i, ib;
+  FLOAT *a, *tau, *t, *w;
+  blas_arg_t newarg;
+
+  m   = args -> m;
+  n   = args -> n;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> c;
+
+  t = (FLOAT *)args -> b;
+  w = t + QR_NB * QR_NB;
+
+  mn = MIN(m, n);
+
+  for (i = 0; i < mn; i += QR_NB) {
+
+    ib = MIN(QR_NB, mn - i);
+
+    qr_rec(m - i, ib, a + i + i * lda, lda, tau + i, t, QR_NB, sa, sb);
+
+    if (i + ib < n) {
+      newarg.m   = m - i;
+      newarg.n   = n - i - ib;
+      newarg.k   = ib;
+      newarg.a   = a + i + i * lda;
+      newarg.lda = lda;
+      newarg.b   = t;
+      newarg.ldb = QR_NB;
+      newarg.c   = a + i + (i + ib) * lda;
+      newarg.ldc = lda;
+      newarg.d   = w;
+      newarg.ldd = QR_NB;
+      LARFB_LT(&newarg, NULL, NULL, sa, sb, 0);
+    }
+  }
+
+  return 0;
+}
@@ -384,6 +384,260 @@ static int inner_advanced_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *
   return 0;
 }
 
+/* Task graph implementation for large matrices.
+
+   The columns are cut into blocks of width nb, and block k (k < nstep)
+   is also the k-th panel. Two kinds of tasks are scheduled:
+
+     P(k)    factor panel k, once all earlier steps have been applied to it
+     U(s, j) apply step s (swaps, TRSM and GEMM) to block j, once panel s
+             is factored and steps 0 .. s-1 have been applied to block j
+
+   Any thread picks the next ready task under a lock, so the panel of the
+   next step is factored while the other threads still update the trailing
+   matrix of the current one. The panel may run up to depth steps ahead of
+   the oldest step that still has updates outstanding
+   (OPENBLAS_GETRF_LOOKAHEAD). */
+
+#ifndef GETRF_DAG_MIN
+#define GETRF_DAG_MIN 1024
+#endif
+
+#ifndef GETRF_LOOKAHEAD
+#define GETRF_LOOKAHEAD 2
+#endif
+
+extern int openblas_getrf_lookahead_env(void);
+
+typedef struct {
+  volatile BLASULONG lock;
+  BLASLONG m, n, mn, lda, offset;
+  BLASLONG nb, nstep, nblk, depth;
+  BLASLONG panel;
+  BLASLONG oldest;
+  BLASLONG left;
+  BLASLONG *done;
+  BLASLONG *remain;
+  char *busy;
+  blasint info;
+} dag_t;
+
+static __inline BLASLONG dag_start(dag_t *dag, BLASLONG j) {
+
+  if (j < dag -> nstep) return j * dag -> nb;
+
+  return MIN(dag -> mn + (j - dag -> nstep) * dag -> nb, dag -> n);
+}
+
+/* Returns the block of the next ready task and its step in *step, with
+   *step == block for a panel, or -1 if nothing is ready. Called locked. */
+static BLASLONG dag_pick(dag_t *dag, BLASLONG *step) {
+
+  BLASLONG j, s, best = -1, best_s = 0;
+  BLASLONG k = dag -> panel;
+
+  if (k < dag -> nstep && !dag -> busy[k] && dag -> done[k] == k
+      && k - dag -> oldest <= dag -> depth) {
+    *step = k;
+    return k;
+  }
+
+  for (j = k; j < dag -> nblk; j++) {
+    if (dag -> busy[j]) continue;
+
+    s = dag -> done[j];
+    if (s >= MIN(j, dag -> nstep) || s >= dag -> panel) continue;
+
+    /* Updates to the next panel are on the critical path */
+    if (j == k) {
+      *step = s;
+      return j;
+    }
+
+    if (best < 0 || s < best_s) {
+      best   = j;
+      best_s = s;
+    }
+  }
+
+  *step = best_s;
+  return best;
+}
+
+static int dag_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  dag_t *dag = (dag_t *)args -> common;
+
+  BLASLONG lda = dag -> lda;
+  BLASLONG offset = dag -> offset;
+  FLOAT *a = (FLOAT *)args -> a + offset * (lda + 1) * COMPSIZE;
+
+  BLASLONG j, s, is, bk, range[2];
+  blasint iinfo = 0;
+  blas_arg_t newarg;
+
+  newarg.a   = NULL;
+  newarg.c   = args -> c;
+  newarg.d   = NULL;
+  newarg.lda = lda;
+
+  while (1) {
+
+    blas_lock(&dag -> lock);
+
+    if (dag -> left == 0) {
+      blas_unlock(&dag -> lock);
+      break;
+    }
+
+    j = dag_pick(dag, &s);
+    if (j >= 0) dag -> busy[j] = 1;
+
+    blas_unlock(&dag -> lock);
+
+    if (j < 0) {
+      YIELDING;
+      continue;
+    }
+
+    is = dag_start(dag, s);
+    bk = dag_start(dag, s + 1) - is;
+
+    if (s == j) {
+
+      range[0] = offset + is;
+      range[1] = offset + is + bk;
+
+      iinfo = GETRF_SINGLE(args, NULL, range, sa, sb, 0);
+
+    } else {
+
+      newarg.b   = a + (is + is * lda) * COMPSIZE;
+      newarg.m   = dag -> m - is - bk;
+      newarg.n   = dag -> n - is - bk;
+      newarg.k   = bk;
+      newarg.ldb = is + offset;
+
+      range[0] = dag_start(dag, j)     - is - bk;
+      range[1] = dag_start(dag, j + 1) - is - bk;
+
+      inner_basic_thread(&newarg, NULL, range, sa, sb, -1);
+    }
+
+    MB;
+    blas_lock(&dag -> lock);
+
+    if (s == j) {
+      if (iinfo && !dag -> info) dag -> info = iinfo + is;
+      dag -> done[j] = j + 1;
+      dag -> panel ++;
+    } else {
+      dag -> done[j] ++;
+      dag -> remain[s] --;
+    }
+
+    while (dag -> oldest < dag -> panel && dag -> remain[dag -> oldest] == 0) dag -> oldest ++;
+
+    dag -> busy[j] = 0;
+    dag -> left --;
+
+    blas_unlock(&dag -> lock);
+  }
+
+  return 0;
+}
+
+static blasint dag_getrf(blas_arg_t *args, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, int mode) {
+
+  dag_t dag;
+  blas_arg_t newarg;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  FLOAT dummyalpha[2] = {ZERO, ZERO};
+  FLOAT *a;
+  BLASLONG i, j, is, bk, nthreads;
+
+  dag.m      = args -> m;
+  dag.n      = args -> n;
+  dag.lda    = args -> lda;
+  dag.offset = 0;
+
+  if (range_n) {
+    dag.m     -= range_n[0];
+    dag.n      = range_n[1] - range_n[0];
+    dag.offset = range_n[0];
+  }
+
+  a = (FLOAT *)args -> a + dag.offset * (dag.lda + 1) * COMPSIZE;
+
+  nthreads = args -> nthreads;
+  dag.mn   = MIN(dag.m, dag.n);
+
+  /* Several blocks per thread, but not so narrow that GEMM suffers */
+  dag.nb = GEMM_Q;
+  while ((dag.nb > GEMM_Q / 4) && ((dag.n + dag.nb - 1) / dag.nb < nthreads * 4)) dag.nb /= 2;
+  dag.nb = ((dag.nb + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+
+  dag.nstep = (dag.mn + dag.nb - 1) / dag.nb;
+  dag.nblk  = dag.nstep + (dag.n - dag.mn + dag.nb - 1) / dag.nb;
+
+  dag.depth = openblas_getrf_lookahead_env();
+  if (dag.depth <= 0) dag.depth = GETRF_LOOKAHEAD;
+
+  dag.done = (BLASLONG *)malloc(dag.nblk * (2 * sizeof(BLASLONG) + 1));
+  if (dag.done == NULL) {
+    fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+    exit(1);
+  }
+  dag.remain = dag.done + dag.nblk;
+  dag.busy   = (char *)(dag.remain + dag.nblk);
+
+  dag.left = dag.nstep;
+  for (j = 0; j < dag.nblk; j++) {
+    dag.done[j]   = 0;
+    dag.remain[j] = dag.nblk - j - 1;
+    dag.busy[j]   = 0;
+    dag.left     += MIN(j, dag.nstep);
+  }
+
+  dag.lock   = 0;
+  dag.panel  = 0;
+  dag.oldest = 0;
+  dag.info   = 0;
+
+  newarg = *args;
+  newarg.common = (void *)&dag;
+
+  for (i = 0; i < nthreads; i++) {
+    queue[i].mode    = mode;
+    queue[i].routine = dag_thread;
+    queue[i].args    = &newarg;
+    queue[i].range_m = NULL;
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[nthreads - 1].next = NULL;
+
+  exec_blas(nthreads, queue);
+
+  /* Swaps of later steps on the columns left of each panel */
+  for (is = 0; is < dag.mn; is += bk) {
+    bk = MIN(dag.mn - is, dag.nb);
+
+    blas_level1_thread(mode, bk, is + bk + dag.offset + 1, dag.mn + dag.offset, (void *)dummyalpha,
+		       a + (- dag.offset + is * dag.lda) * COMPSIZE, dag.lda, NULL, 0,
+		       args -> c, 1, (int (*)(void))LASWP_PLUS, nthreads);
+  }
+
+  free(dag.done);
+
+  return dag.info;
+}
+
 #if 1
 
 blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
@@ -469,6 +723,8 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
     return info;
   }
 
+  if ((args -> nthreads > 1) && (mn >= GETRF_DAG_MIN)) return dag_getrf(args, range_n, sa, sb, mode);
+
   next_bk = init_bk;
 
   bk = mn;
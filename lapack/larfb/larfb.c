@@ -0,0 +1,237 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* Applies the block reflector H = I - V T V' (or H') held in the first */
+/* k columns of V to C, as LAPACK ?larfb with DIRECT = 'F' and          */
+/* STOREV = 'C'.  The unit lower trapezoidal V is read in place, so the */
+/* upper triangle of its first k rows may still hold R.                 */
+/*                                                                      */
+/*   args -> m, n : size of C          args -> k   : number of reflectors */
+/*   args -> a    : V (lda)            args -> b   : T (ldb), upper       */
+/*   args -> c    : C (ldc)            args -> d   : W (ldd), workspace   */
+/*                                                                      */
+/* W is k x n for the left side and m x k for the right side.  A range  */
+/* selects a block of columns (left) or rows (right) of C together with */
+/* the matching part of W, so that gemm_thread_n / gemm_thread_m can    */
+/* hand disjoint tiles of the update to different threads.              */
+
+static FLOAT dp1 =  1.;
+static FLOAT dm1 = -1.;
+
+int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, lda, ldc, ldd;
+  FLOAT *v, *c, *w;
+  blas_arg_t newarg;
+
+  m   = args -> m;
+  n   = args -> n;
+  k   = args -> k;
+  v   = (FLOAT *)args -> a;
+  c   = (FLOAT *)args -> c;
+  w   = (FLOAT *)args -> d;
+  lda = args -> lda;
+  ldc = args -> ldc;
+  ldd = args -> ldd;
+
+#ifndef RSIDE
+  if (range_n) {
+    n  = range_n[1] - range_n[0];
+    c += range_n[0] * ldc;
+    w += range_n[0] * ldd;
+  }
+
+  if ((m <= 0) || (n <= 0) || (k <= 0)) return 0;
+
+  newarg.alpha = NULL;
+  newarg.beta  = NULL;
+
+  /* W := V1' C1 + V2' C2 */
+  OMATCOPY_K_CN(k, n, ONE, c, ldc, w, ldd);
+
+  newarg.m   = k;
+  newarg.n   = n;
+  newarg.a   = v;
+  newarg.lda = lda;
+  newarg.b   = w;
+  newarg.ldb = ldd;
+  TRMM_LTLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  if (m > k) {
+    newarg.m     = k;
+    newarg.n     = n;
+    newarg.k     = m - k;
+    newarg.a     = v + k;
+    newarg.lda   = lda;
+    newarg.b     = c + k;
+    newarg.ldb   = ldc;
+    newarg.c     = w;
+    newarg.ldc   = ldd;
+    newarg.alpha = &dp1;
+    newarg.beta  = &dp1;
+    GEMM_TN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* W := T W or T' W */
+  newarg.m     = k;
+  newarg.n     = n;
+  newarg.a     = args -> b;
+  newarg.lda   = args -> ldb;
+  newarg.b     = w;
+  newarg.ldb   = ldd;
+  newarg.alpha = NULL;
+  newarg.beta  = NULL;
+#ifndef TRANS
+  TRMM_LNUN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+  TRMM_LTUN(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+
+  /* C2 := C2 - V2 W */
+  if (m > k) {
+    newarg.m     = m - k;
+    newarg.n     = n;
+    newarg.k     = k;
+    newarg.a     = v + k;
+    newarg.lda   = lda;
+    newarg.b     = w;
+    newarg.ldb   = ldd;
+    newarg.c     = c + k;
+    newarg.ldc   = ldc;
+    newarg.alpha = &dm1;
+    newarg.beta  = &dp1;
+    GEMM_NN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* C1 := C1 - V1 W */
+  newarg.m     = k;
+  newarg.n     = n;
+  newarg.a     = v;
+  newarg.lda   = lda;
+  newarg.b     = w;
+  newarg.ldb   = ldd;
+  newarg.alpha = NULL;
+  newarg.beta  = NULL;
+  TRMM_LNLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  GEADD_K(k, n, dm1, w, ldd, dp1, c, ldc);
+
+#else
+  if (range_m) {
+    m  = range_m[1] - range_m[0];
+    c += range_m[0];
+    w += range_m[0];
+  }
+
+  if ((m <= 0) || (n <= 0) || (k <= 0)) return 0;
+
+  newarg.alpha = NULL;
+  newarg.beta  = NULL;
+
+  /* W := C1 V1 + C2 V2 */
+  OMATCOPY_K_CN(m, k, ONE, c, ldc, w, ldd);
+
+  newarg.m   = m;
+  newarg.n   = k;
+  newarg.a   = v;
+  newarg.lda = lda;
+  newarg.b   = w;
+  newarg.ldb = ldd;
+  TRMM_RNLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  if (n > k) {
+    newarg.m     = m;
+    newarg.n     = k;
+    newarg.k     = n - k;
+    newarg.a     = c + k * ldc;
+    newarg.lda   = ldc;
+    newarg.b     = v + k;
+    newarg.ldb   = lda;
+    newarg.c     = w;
+    newarg.ldc   = ldd;
+    newarg.alpha = &dp1;
+    newarg.beta  = &dp1;
+    GEMM_NN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* W := W T or W T' */
+  newarg.m     = m;
+  newarg.n     = k;
+  newarg.a     = args -> b;
+  newarg.lda   = args -> ldb;
+  newarg.b     = w;
+  newarg.ldb   = ldd;
+  newarg.alpha = NULL;
+  newarg.beta  = NULL;
+#ifndef TRANS
+  TRMM_RNUN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+  TRMM_RTUN(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+
+  /* C2 := C2 - W V2' */
+  if (n > k) {
+    newarg.m     = m;
+    newarg.n     = n - k;
+    newarg.k     = k;
+    newarg.a     = w;
+    newarg.lda   = ldd;
+    newarg.b     = v + k;
+    newarg.ldb   = lda;
+    newarg.c     = c + k * ldc;
+    newarg.ldc   = ldc;
+    newarg.alpha = &dm1;
+    newarg.beta  = &dp1;
+    GEMM_NT(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* C1 := C1 - W V1' */
+  newarg.m     = m;
+  newarg.n     = k;
+  newarg.a     = v;
+  newarg.lda   = lda;
+  newarg.b     = w;
+  newarg.ldb   = ldd;
+  newarg.alpha = NULL;
+  newarg.beta  = NULL;
+  TRMM_RTLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  GEADD_K(m, k, dm1, w, ldd, dp1, c, ldc);
+#endif
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include "common.h"
+
+/* Generates the elementary reflector H = I - tau v v' that zeroes      */
+/* x(1:n-1), as LAPACK ?larfg.  On return x(0) holds beta, x(1:n-1)     */
+/* holds v(1:n-1) (v(0) = 1 is implied) and tau is returned.            */
+
+static FLOAT dp1 =  1.;
+
+FLOAT CNAME(BLASLONG n, FLOAT *x) {
+
+  FLOAT alpha, beta, xnorm, safmin, rsafmn, tau;
+  BLASLONG j, knt;
+
+  if (n <= 1) return ZERO;
+
+  xnorm = NRM2_K(n - 1, x + 1, 1);
+  if (xnorm == ZERO) return ZERO;
+
+  alpha = x[0];
+  beta  = -copysign(hypot(alpha, xnorm), alpha);
+
+#if defined(DOUBLE)
+  safmin = DBL_MIN / DBL_EPSILON;
+#else
+  safmin = FLT_MIN / FLT_EPSILON;
+#endif
+  rsafmn = dp1 / safmin;
+  knt    = 0;
+
+  if (fabs(beta) < safmin) {
+    do {
+      knt ++;
+      SCAL_K(n - 1, 0, 0, rsafmn, x + 1, 1, NULL, 0, NULL, 0);
+      beta  *= rsafmn;
+      alpha *= rsafmn;
+    } while ((fabs(beta) < safmin) && (knt < 20));
+
+    xnorm = NRM2_K(n - 1, x + 1, 1);
+    beta  = -copysign(hypot(alpha, xnorm), alpha);
+  }
+
+  tau = (beta - alpha) / beta;
+  SCAL_K(n - 1, 0, 0, dp1 / (alpha - beta), x + 1, 1, NULL, 0, NULL, 0);
+
+  for (j = 0; j < knt; j++) beta *= safmin;
+  x[0] = beta;
+
+  return tau;
+}
@@ -0,0 +1,124 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* Forms the upper triangular factor T of the block reflector           */
+/* H = H(0) H(1) ... H(k-1) = I - V T V', as LAPACK ?larft with         */
+/* DIRECT = 'F' and STOREV = 'C'.                                       */
+/*                                                                      */
+/*   args -> m : rows of V            args -> n : number of reflectors  */
+/*   args -> a : V (lda)              args -> b : T (ldb)               */
+/*   args -> c : tau                                                    */
+/*                                                                      */
+/* The columns are split in halves recursively and the two factors are  */
+/* joined by T12 = -T11 (V1' V2) T22, so the work is done by TRMM and   */
+/* GEMM instead of the column by column GEMV of the reference code.     */
+
+static FLOAT dp1 =  1.;
+static FLOAT dm1 = -1.;
+
+static void larft_rec(BLASLONG m, BLASLONG k, FLOAT *v, BLASLONG lda, FLOAT *tau,
+		      FLOAT *t, BLASLONG ldt, FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG n1, n2;
+  FLOAT *t12;
+  blas_arg_t newarg;
+
+  if (k == 1) {
+    t[0] = tau[0];
+    return;
+  }
+
+  n1  = k / 2;
+  n2  = k - n1;
+  t12 = t + n1 * ldt;
+
+  larft_rec(m,      n1, v,                  lda, tau,      t,                  ldt, sa, sb);
+  larft_rec(m - n1, n2, v + n1 + n1 * lda, lda, tau + n1, t + n1 + n1 * ldt, ldt, sa, sb);
+
+  /* T12 := V1(n1:k, :)' V2(n1:k, :) + V1(k:m, :)' V2(k:m, :) */
+  OMATCOPY_K_CT(n2, n1, ONE, v + n1, lda, t12, ldt);
+
+  newarg.m     = n1;
+  newarg.n     = n2;
+  newarg.a     = v + n1 + n1 * lda;
+  newarg.lda   = lda;
+  newarg.b     = t12;
+  newarg.ldb   = ldt;
+  newarg.alpha = NULL;
+  newarg.beta  = NULL;
+  TRMM_RNLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  if (m > k) {
+    newarg.m     = n1;
+    newarg.n     = n2;
+    newarg.k     = m - k;
+    newarg.a     = v + k;
+    newarg.lda   = lda;
+    newarg.b     = v + k + n1 * lda;
+    newarg.ldb   = lda;
+    newarg.c     = t12;
+    newarg.ldc   = ldt;
+    newarg.alpha = &dp1;
+    newarg.beta  = &dp1;
+    GEMM_TN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* T12 := -T11 T12 T22 */
+  newarg.m     = n1;
+  newarg.n     = n2;
+  newarg.a     = t;
+  newarg.lda   = ldt;
+  newarg.b     = t12;
+  newarg.ldb   = ldt;
+  newarg.alpha = NULL;
+  newarg.beta  = &dm1;
+  TRMM_LNUN(&newarg, NULL, NULL, sa, sb, 0);
+
+  newarg.a     = t + n1 + n1 * ldt;
+  newarg.beta  = NULL;
+  TRMM_RNUN(&newarg, NULL, NULL, sa, sb, 0);
+}
+
+int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  if ((args -> m <= 0) || (args -> n <= 0)) return 0;
+
+  larft_rec(args -> m, args -> n, (FLOAT *)args -> a, args -> lda, (FLOAT *)args -> c,
+	    (FLOAT *)args -> b, args -> ldb, sa, sb);
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* Same blocking as ORGQR_SINGLE, with the ?larfb on the columns to the */
+/* right of each block shared out by gemm_thread_n.                     */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, lda;
+  BLASLONG i, j, jj, ib, nthreads;
+  FLOAT *a, *tau, *t, *w;
+  blas_arg_t newarg;
+  int mode;
+
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+
+  m   = args -> m;
+  n   = args -> n;
+  k   = args -> k;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> c;
+
+  t = (FLOAT *)args -> b;
+  w = t + QR_NB * QR_NB;
+
+  if ((args -> nthreads == 1) || (n <= 2 * QR_NB)) {
+    ORGQR_SINGLE(args, NULL, NULL, sa, sb, 0);
+    return 0;
+  }
+
+  for (j = k; j < n; j++) {
+    for (i = 0; i < m; i++) a[i + j * lda] = ZERO;
+    a[j + j * lda] = ONE;
+  }
+
+  if (k <= 0) return 0;
+
+  for (i = ((k - 1) / QR_NB) * QR_NB; i >= 0; i -= QR_NB) {
+
+    ib = MIN(QR_NB, k - i);
+
+    if (i + ib < n) {
+      newarg.m   = m - i;
+      newarg.n   = ib;
+      newarg.a   = a + i + i * lda;
+      newarg.lda = lda;
+      newarg.b   = t;
+      newarg.ldb = QR_NB;
+      newarg.c   = tau + i;
+      LARFT(&newarg, NULL, NULL, sa, sb, 0);
+
+      newarg.m   = m - i;
+      newarg.n   = n - i - ib;
+      newarg.k   = ib;
+      newarg.c   = a + i + (i + ib) * lda;
+      newarg.ldc = lda;
+      newarg.d   = w;
+      newarg.ldd = QR_NB;
+
+      nthreads = MIN(args -> nthreads, newarg.n / QR_NB);
+
+      if (nthreads > 1) {
+	gemm_thread_n(mode, &newarg, NULL, NULL, LARFB_LN, sa, sb, nthreads);
+      } else {
+	LARFB_LN(&newarg, NULL, NULL, sa, sb, 0);
+      }
+    }
+
+    newarg.m   = m - i;
+    newarg.n   = ib;
+    newarg.k   = ib;
+    newarg.a   = a + i + i * lda;
+    newarg.lda = lda;
+    newarg.b   = t;
+    newarg.c   = tau + i;
+    ORGQR_SINGLE(&newarg, NULL, NULL, sa, sb, 0);
+
+    for (j = i; j < i + ib; j++)
+      for (jj = 0; jj < i; jj++) a[jj + j * lda] = ZERO;
+  }
+
+  return 0;
+}
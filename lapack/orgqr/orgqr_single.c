@@ -0,0 +1,133 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* Generates the m x n matrix Q with orthonormal columns defined by the */
+/* first k reflectors left by ?geqrf, as LAPACK ?orgqr.                 */
+/*                                                                      */
+/*   args -> m, n, k : sizes            args -> a : A (lda)             */
+/*   args -> c       : tau              args -> b : workspace           */
+/*                                                                      */
+/* The workspace holds T (QR_NB x QR_NB) followed by W (QR_NB x n).     */
+/* Blocks are applied backwards; the columns to the right of a block    */
+/* take it as one ?larfb, its own columns are generated unblocked.      */
+
+static FLOAT dp1 =  1.;
+
+/* Unblocked generation of an m x k block from its k reflectors. */
+static void org2r(BLASLONG m, BLASLONG k, FLOAT *a, BLASLONG lda, FLOAT *tau,
+		  FLOAT *w, FLOAT *buffer) {
+
+  BLASLONG i, j;
+
+  for (j = k - 1; j >= 0; j--) {
+
+    if (j < k - 1) {
+      a[j + j * lda] = dp1;
+
+      for (i = 0; i < k - j - 1; i++) w[i] = ZERO;
+
+      GEMV_T(m - j, k - j - 1, 0, dp1,
+	     a + j + (j + 1) * lda, lda, a + j + j * lda, 1, w, 1, buffer);
+
+      GERU_K(m - j, k - j - 1, 0, -tau[j],
+	     a + j + j * lda, 1, w, 1, a + j + (j + 1) * lda, lda, buffer);
+    }
+
+    if (j < m - 1) SCAL_K(m - j - 1, 0, 0, -tau[j], a + j + 1 + j * lda, 1, NULL, 0, NULL, 0);
+
+    a[j + j * lda] = dp1 - tau[j];
+
+    for (i = 0; i < j; i++) a[i + j * lda] = ZERO;
+  }
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, lda;
+  BLASLONG i, j, jj, ib;
+  FLOAT *a, *tau, *t, *w;
+  blas_arg_t newarg;
+
+  m   = args -> m;
+  n   = args -> n;
+  k   = args -> k;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> c;
+
+  t = (FLOAT *)args -> b;
+  w = t + QR_NB * QR_NB;
+
+  for (j = k; j < n; j++) {
+    for (i = 0; i < m; i++) a[i + j * lda] = ZERO;
+    a[j + j * lda] = dp1;
+  }
+
+  if (k <= 0) return 0;
+
+  for (i = ((k - 1) / QR_NB) * QR_NB; i >= 0; i -= QR_NB) {
+
+    ib = MIN(QR_NB, k - i);
+
+    if (i + ib < n) {
+      newarg.m   = m - i;
+      newarg.n   = ib;
+      newarg.a   = a + i + i * lda;
+      newarg.lda = lda;
+      newarg.b   = t;
+      newarg.ldb = QR_NB;
+      newarg.c   = tau + i;
+      LARFT(&newarg, NULL, NULL, sa, sb, 0);
+
+      newarg.m   = m - i;
+      newarg.n   = n - i - ib;
+      newarg.k   = ib;
+      newarg.c   = a + i + (i + ib) * lda;
+      newarg.ldc = lda;
+      newarg.d   = w;
+      newarg.ldd = QR_NB;
+      LARFB_LN(&newarg, NULL, NULL, sa, sb, 0);
+    }
+
+    org2r(m - i, ib, a + i + i * lda, lda, tau + i, w, sb);
+
+    for (j = i; j < i + ib; j++)
+      for (jj = 0; jj < i; jj++) a[jj + j * lda] = ZERO;
+  }
+
+  return 0;
+}
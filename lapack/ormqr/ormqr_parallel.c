@@ -0,0 +1,155 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* Same blocking as ORMQR_SINGLE.  The ?larfb of each block is shared   */
+/* out by columns of C (gemm_thread_n) for the left side and by rows    */
+/* (gemm_thread_m) for the right side, as these tiles do not interact.  */
+
+#ifndef RSIDE
+#ifndef TRANS
+#define LARFB	LARFB_LN
+#else
+#define LARFB	LARFB_LT
+#endif
+#else
+#ifndef TRANS
+#define LARFB	LARFB_RN
+#else
+#define LARFB	LARFB_RT
+#endif
+#endif
+
+#if (!defined(RSIDE) && defined(TRANS)) || (defined(RSIDE) && !defined(TRANS))
+#define FORWARD
+#endif
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, nq, lda, ldc;
+  BLASLONG i, ib, start, step, nthreads;
+  FLOAT *a, *c, *tau, *t, *w;
+  blas_arg_t newarg;
+  int mode;
+
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+
+  m   = args -> m;
+  n   = args -> n;
+  k   = args -> k;
+  a   = (FLOAT *)args -> a;
+  c   = (FLOAT *)args -> b;
+  tau = (FLOAT *)args -> c;
+  lda = args -> lda;
+  ldc = args -> ldb;
+
+  t = (FLOAT *)args -> d;
+  w = t + QR_NB * QR_NB;
+
+#ifndef RSIDE
+  nq = m;
+  nthreads = MIN(args -> nthreads, n / QR_NB);
+#else
+  nq = n;
+  nthreads = MIN(args -> nthreads, m / QR_NB);
+#endif
+
+  if ((m <= 0) || (n <= 0) || (k <= 0)) return 0;
+
+  if (nthreads <= 1) {
+#ifndef RSIDE
+#ifndef TRANS
+    ORMQR_LN_SINGLE(args, NULL, NULL, sa, sb, 0);
+#else
+    ORMQR_LT_SINGLE(args, NULL, NULL, sa, sb, 0);
+#endif
+#else
+#ifndef TRANS
+    ORMQR_RN_SINGLE(args, NULL, NULL, sa, sb, 0);
+#else
+    ORMQR_RT_SINGLE(args, NULL, NULL, sa, sb, 0);
+#endif
+#endif
+    return 0;
+  }
+
+#ifdef FORWARD
+  start = 0;
+  step  = QR_NB;
+#else
+  start = ((k - 1) / QR_NB) * QR_NB;
+  step  = -QR_NB;
+#endif
+
+  for (i = start; (i >= 0) && (i < k); i += step) {
+
+    ib = MIN(QR_NB, k - i);
+
+    newarg.m   = nq - i;
+    newarg.n   = ib;
+    newarg.a   = a + i + i * lda;
+    newarg.lda = lda;
+    newarg.b   = t;
+    newarg.ldb = QR_NB;
+    newarg.c   = tau + i;
+    LARFT(&newarg, NULL, NULL, sa, sb, 0);
+
+    newarg.k   = ib;
+    newarg.ldc = ldc;
+    newarg.d   = w;
+#ifndef RSIDE
+    newarg.m   = m - i;
+    newarg.n   = n;
+    newarg.c   = c + i;
+    newarg.ldd = QR_NB;
+    gemm_thread_n(mode, &newarg, NULL, NULL, LARFB, sa, sb, nthreads);
+#else
+    newarg.m   = m;
+    newarg.n   = n - i;
+    newarg.c   = c + i * ldc;
+    newarg.ldd = m;
+    gemm_thread_m(mode, &newarg, NULL, NULL, LARFB, sa, sb, nthreads);
+#endif
+  }
+
+  return 0;
+}
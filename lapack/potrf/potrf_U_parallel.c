@@ -41,7 +41,7 @@
 
 blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
 
-  BLASLONG n, bk, i, blocking, lda;
+  BLASLONG n, n1, n2, lda;
   BLASLONG info;
   int mode;
   blas_arg_t newarg;
@@ -77,7 +77,9 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
 
   if (range_n) n  = range_n[1] - range_n[0];
 
-  if (n <= GEMM_UNROLL_N * 4) {
+  /* Below this size the blocked single thread code is faster */
+  /* than splitting again and synchronizing the threads.       */
+  if (n <= GEMM_Q / 2) {
     info = POTRF_U_SINGLE(args, NULL, range_n, sa, sb, 0);
     return info;
   }
@@ -89,42 +91,44 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
   newarg.beta = NULL;
   newarg.nthreads = args -> nthreads;
 
-  blocking = ((n / 2 + GEMM_UNROLL_N - 1)/GEMM_UNROLL_N) * GEMM_UNROLL_N;
-  if (blocking > GEMM_Q) blocking = GEMM_Q;
+  /* Split in halves and recurse, so that each level runs one TRSM */
+  /* and one HERK on the whole panel, with inner dimension n / 2.  */
+  n1 = ((n / 2 + GEMM_UNROLL_N - 1)/GEMM_UNROLL_N) * GEMM_UNROLL_N;
+  n2 = n - n1;
 
-  for (i = 0; i < n; i += blocking) {
-    bk = n - i;
-    if (bk > blocking) bk = blocking;
+  newarg.m = n1;
+  newarg.n = n1;
+  newarg.a = a;
 
-    newarg.m = bk;
-    newarg.n = bk;
-    newarg.a = a + (i + i * lda) * COMPSIZE;
+  info = CNAME(&newarg, NULL, NULL, sa, sb, 0);
+  if (info) return info;
 
-    info = CNAME(&newarg, NULL, NULL, sa, sb, 0);
-    if (info) return info + i;
+  newarg.m = n1;
+  newarg.n = n2;
+  newarg.a = a;
+  newarg.b = a + n1 * lda * COMPSIZE;
 
-    if (n - i - bk > 0) {
-      newarg.m = bk;
-      newarg.n = n - i - bk;
-      newarg.a = a + (i +  i       * lda) * COMPSIZE;
-      newarg.b = a + (i + (i + bk) * lda) * COMPSIZE;
+  gemm_thread_n(mode | BLAS_TRANSA_T,
+		&newarg, NULL, NULL, (int (*)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG))TRSM_LCUN, sa, sb, args -> nthreads);
 
-      gemm_thread_n(mode | BLAS_TRANSA_T,
-		    &newarg, NULL, NULL, (int (*)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG))TRSM_LCUN, sa, sb, args -> nthreads);
-
-      newarg.n = n - i - bk;
-      newarg.k = bk;
-      newarg.a = a + ( i       + (i + bk) * lda) * COMPSIZE;
-      newarg.c = a + ((i + bk) + (i + bk) * lda) * COMPSIZE;
+  newarg.n = n2;
+  newarg.k = n1;
+  newarg.a = a + n1 * lda * COMPSIZE;
+  newarg.c = a + (n1 + n1 * lda) * COMPSIZE;
 
 #ifndef USE_SIMPLE_THREADED_LEVEL3
-      HERK_THREAD_UC(&newarg, NULL, NULL, sa, sb, 0);
+  HERK_THREAD_UC(&newarg, NULL, NULL, sa, sb, 0);
 #else
-      syrk_thread(mode | BLAS_TRANSA_N | BLAS_TRANSB_T,
-		  &newarg, NULL, NULL, (int (*)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG))HERK_UC, sa, sb, args -> nthreads);
+  syrk_thread(mode | BLAS_TRANSA_N | BLAS_TRANSB_T,
+	      &newarg, NULL, NULL, (int (*)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG))HERK_UC, sa, sb, args -> nthreads);
 #endif
-    }
-  }
+
+  newarg.m = n2;
+  newarg.n = n2;
+  newarg.a = a + (n1 + n1 * lda) * COMPSIZE;
+
+  info = CNAME(&newarg, NULL, NULL, sa, sb, 0);
+  if (info) return info + n1;
 
   return 0;
 }
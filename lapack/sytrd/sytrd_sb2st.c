@@ -0,0 +1,291 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* Second stage of the two-stage tridiagonal reduction: reduces the     */
+/* symmetric band AB with kd sub (super) diagonals to tridiagonal form  */
+/* by bulge chasing, as LAPACK ?sytrd_sb2st with VECT = 'N'.            */
+/*                                                                      */
+/*   args -> n  : order of AB          args -> k  : kd                  */
+/*   args -> a  : AB (lda >= kd + 1)   args -> d  : workspace           */
+/*   args -> b  : diagonal d (n)       args -> c  : off diagonal e (n-1)*/
+/*                                                                      */
+/* The band is copied to a lower band of 2 kd + 1 rows in the           */
+/* workspace, which is read as a general matrix with leading dimension  */
+/* 2 kd, so that A(r, c) = w[r + c * 2 kd] for 0 <= r - c <= 2 kd.      */
+/*                                                                      */
+/* Sweep s zeroes column s below the subdiagonal and chases the bulge   */
+/* down the band in blocks of kd rows.  Its tasks are, in turn, the     */
+/* two-sided update of a diagonal block and the one-sided update of     */
+/* the block below it, where the next reflector is generated.  Task t   */
+/* of sweep s only overlaps task t + 2 of sweep s - 1, so with          */
+/* args -> nthreads > 1 the sweeps are dealt out round robin and each   */
+/* thread runs at least three tasks behind the sweep before its own.    */
+/*                                                                      */
+/* The workspace is (2 kd + 1) n elements.                              */
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 8
+#endif
+
+/* A := H A H for the symmetric A (lower), H = I - tau v v', as ?larfy */
+static void larfy(BLASLONG n, FLOAT *v, FLOAT tau, FLOAT *a, BLASLONG lda, FLOAT *w, FLOAT *buffer) {
+
+  BLASLONG i;
+  FLOAT alpha;
+
+  if (tau == ZERO) return;
+
+  for (i = 0; i < n; i++) w[i] = ZERO;
+
+  SYMV_L(n, n, tau, a, lda, v, 1, w, 1, buffer);
+
+  alpha = - tau * DOTU_K(n, w, 1, v, 1) / 2;
+  AXPYU_K(n, 0, 0, alpha, v, 1, w, 1, NULL, 0);
+
+  for (i = 0; i < n; i++) {
+    AXPYU_K(n - i, 0, 0, -v[i], w + i, 1, a, 1, NULL, 0);
+    AXPYU_K(n - i, 0, 0, -w[i], v + i, 1, a, 1, NULL, 0);
+    a += lda + 1;
+  }
+}
+
+/* Runs sweep s.  prev / mine are the progress counters of the sweep    */
+/* before and of this one, biased by base; NULL when running alone.     */
+static void sweep(BLASLONG s, BLASLONG n, BLASLONG kd, FLOAT *a, BLASLONG lda,
+		  volatile BLASLONG *prev, volatile BLASLONG *mine, BLASLONG base, BLASLONG stride,
+		  FLOAT *v, FLOAT *w, FLOAT *buffer) {
+
+  BLASLONG st, ed, j1, j2, lm, ln, task, i;
+  FLOAT tau;
+
+  st = s + 1;
+  ed = MIN(s + kd, n - 1);
+  lm = ed - st + 1;
+
+  task = 0;
+
+  while (1) {
+
+    if (prev) {
+      while (*prev < base - stride + task + 3) YIELDING;
+      MB;
+    }
+
+    if (task == 0) {
+
+      /* Zero column s below the subdiagonal */
+      tau  = LARFG(lm, a + st + s * lda);
+      v[0] = ONE;
+      for (i = 1; i < lm; i++) {
+	v[i] = a[st + i + s * lda];
+	a[st + i + s * lda] = ZERO;
+      }
+
+      larfy(lm, v, tau, a + st + st * lda, lda, w, buffer);
+
+    } else if (task & 1) {
+
+      j1 = ed + 1;
+      j2 = MIN(ed + kd, n - 1);
+      ln = lm;
+      lm = j2 - j1 + 1;
+
+      /* The block below takes H from the right, which fills it ... */
+      for (i = 0; i < lm; i++) w[i] = ZERO;
+      GEMV_N(lm, ln, 0, ONE, a + j1 + st * lda, lda, v, 1, w, 1, buffer);
+      GERU_K(lm, ln, 0, -tau, w, 1, v, 1, a + j1 + st * lda, lda, buffer);
+
+      /* ... and the next reflector zeroes the first column of the bulge */
+      tau  = LARFG(lm, a + j1 + st * lda);
+      v[0] = ONE;
+      for (i = 1; i < lm; i++) {
+	v[i] = a[j1 + i + st * lda];
+	a[j1 + i + st * lda] = ZERO;
+      }
+
+      if ((ln > 1) && (tau != ZERO)) {
+	for (i = 0; i < ln - 1; i++) w[i] = ZERO;
+	GEMV_T(lm, ln - 1, 0, ONE, a + j1 + (st + 1) * lda, lda, v, 1, w, 1, buffer);
+	GERU_K(lm, ln - 1, 0, -tau, v, 1, w, 1, a + j1 + (st + 1) * lda, lda, buffer);
+      }
+
+      st = j1;
+      ed = j2;
+
+    } else {
+
+      larfy(lm, v, tau, a + st + st * lda, lda, w, buffer);
+
+    }
+
+    if (mine) {
+      WMB;
+      *mine = base + task + 1;
+    }
+
+    task ++;
+
+    if ((task & 1) && (ed >= n - 1)) break;
+  }
+
+  if (mine) {
+    WMB;
+    *mine = base + stride - 1;
+  }
+}
+
+#ifdef SMP
+static int sweep_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  volatile BLASLONG *flag = (volatile BLASLONG *)args -> common;
+
+  BLASLONG n = args -> n;
+  BLASLONG kd = args -> k;
+  BLASLONG lda = args -> lda;
+  BLASLONG nthreads = args -> nthreads;
+  BLASLONG stride = args -> ldb;
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *v = sa;
+  FLOAT *w = v + kd;
+  BLASLONG s;
+
+  for (s = mypos; s < n - 2; s += nthreads)
+    sweep(s, n, kd, a, lda,
+	  (s > 0) ? flag + ((s - 1) % nthreads) * CACHE_LINE_SIZE : NULL,
+	  flag + mypos * CACHE_LINE_SIZE, s * stride, stride, v, w, sb);
+
+  return 0;
+}
+#endif
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n, kd, ldab, lda, ldw, i, j, s;
+  FLOAT *ab, *d, *e, *a;
+#ifdef SMP
+  BLASLONG nthreads;
+  blas_arg_t newarg;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  volatile BLASLONG flag[MAX_CPU_NUMBER * CACHE_LINE_SIZE] __attribute__((aligned(128)));
+  int mode;
+
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#endif
+
+  n    = args -> n;
+  kd   = args -> k;
+  ab   = (FLOAT *)args -> a;
+  ldab = args -> lda;
+  d    = (FLOAT *)args -> b;
+  e    = (FLOAT *)args -> c;
+
+  if (n <= 0) return 0;
+
+#ifndef UPPER
+  for (i = 0; i < n; i++) d[i] = ab[i * ldab];
+  if (kd == 0) for (i = 0; i < n - 1; i++) e[i] = ZERO;
+  if (kd == 1) for (i = 0; i < n - 1; i++) e[i] = ab[1 + i * ldab];
+#else
+  for (i = 0; i < n; i++) d[i] = ab[kd + i * ldab];
+  if (kd == 0) for (i = 0; i < n - 1; i++) e[i] = ZERO;
+  if (kd == 1) for (i = 0; i < n - 1; i++) e[i] = ab[(i + 1) * ldab];
+#endif
+
+  if (kd <= 1) return 0;
+
+  a   = (FLOAT *)args -> d;
+  ldw = 2 * kd + 1;
+  lda = ldw - 1;
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < ldw; i++) a[i + j * ldw] = ZERO;
+#ifndef UPPER
+    COPY_K(MIN(kd, n - 1 - j) + 1, ab + j * ldab, 1, a + j * ldw, 1);
+#else
+    for (i = 0; i <= MIN(kd, n - 1 - j); i++) a[i + j * ldw] = ab[kd - i + (j + i) * ldab];
+#endif
+  }
+
+#ifdef SMP
+  nthreads = MIN(args -> nthreads, n / (2 * kd));
+
+  if (nthreads > 1) {
+
+    newarg.n      = n;
+    newarg.k      = kd;
+    newarg.a      = a;
+    newarg.lda    = lda;
+    newarg.ldb    = 2 * ((n + kd - 1) / kd) + 4;
+    newarg.common = (void *)flag;
+    newarg.nthreads = nthreads;
+
+    for (i = 0; i < nthreads; i++) {
+      flag[i * CACHE_LINE_SIZE] = 0;
+
+      queue[i].mode    = mode;
+      queue[i].routine = sweep_thread;
+      queue[i].args    = &newarg;
+      queue[i].range_m = NULL;
+      queue[i].range_n = NULL;
+      queue[i].sa      = NULL;
+      queue[i].sb      = NULL;
+      queue[i].next    = &queue[i + 1];
+    }
+
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[nthreads - 1].next = NULL;
+
+    WMB;
+    exec_blas(nthreads, queue);
+
+  } else
+#endif
+    for (s = 0; s < n - 2; s++)
+      sweep(s, n, kd, a, lda, NULL, NULL, 0, 0, sa, sa + kd, sb);
+
+  for (i = 0; i < n; i++) d[i] = a[i * ldw];
+  for (i = 0; i < n - 1; i++) e[i] = a[1 + i * ldw];
+
+  return 0;
+}
@@ -0,0 +1,282 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* First stage of the two-stage tridiagonal reduction: reduces the      */
+/* symmetric A to a band of kd sub (super) diagonals, Q' A Q = B, as    */
+/* LAPACK ?sytrd_sy2sb.                                                 */
+/*                                                                      */
+/*   args -> n  : order of A           args -> k   : kd                 */
+/*   args -> a  : A (lda)              args -> b   : AB (ldb >= kd + 1) */
+/*   args -> c  : tau (n - kd)         args -> d   : workspace          */
+/*                                                                      */
+/* Each step factors the next panel of kd columns (rows with UPPER,     */
+/* which are factored transposed) below the band by QR and applies the  */
+/* block reflector I - V T V' from both sides of the trailing matrix    */
+/* with one SYMM and one SYR2K, which are threaded when                 */
+/* args -> nthreads > 1.  On exit A holds the band and the reflectors   */
+/* in the layout of ?sytrd_sy2sb, and the band is copied to AB.         */
+/*                                                                      */
+/* The workspace is 2 n kd + 2 kd^2 + QR_NB (QR_NB + kd) elements.      */
+
+static FLOAT dp1 =  1.;
+static FLOAT dm1 = -1.;
+static FLOAT dm5 = -.5;
+static FLOAT dz0 =  0.;
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n, kd, lda, ldab;
+  BLASLONG i, j, m, pk, len;
+  FLOAT *a, *ab, *tau, *a21, *a22;
+  FLOAT *v, *y, *t, *p, *qr;
+  blas_arg_t newarg;
+#ifdef SMP
+  BLASLONG nthreads;
+  int mode;
+
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+
+  nthreads = args -> nthreads;
+#endif
+
+  n    = args -> n;
+  kd   = args -> k;
+  a    = (FLOAT *)args -> a;
+  lda  = args -> lda;
+  ab   = (FLOAT *)args -> b;
+  ldab = args -> ldb;
+  tau  = (FLOAT *)args -> c;
+
+  v  = (FLOAT *)args -> d;
+  y  = v + n * kd;
+  t  = y + n * kd;
+  p  = t + kd * kd;
+  qr = p + kd * kd;
+
+#ifdef SMP
+  newarg.common   = NULL;
+  newarg.nthreads = nthreads;
+#endif
+
+  for (i = 0; i + kd < n; i += kd) {
+
+    m   = n - i - kd;
+    pk  = MIN(m, kd);
+    a22 = a + (i + kd) + (i + kd) * lda;
+
+    /* The panel is factored in V and then written back */
+#ifndef UPPER
+    a21 = a + (i + kd) + i * lda;
+    OMATCOPY_K_CN(m, kd, ONE, a21, lda, v, m);
+#else
+    a21 = a + i + (i + kd) * lda;
+    OMATCOPY_K_CT(kd, m, ONE, a21, lda, v, m);
+#endif
+
+    newarg.m   = m;
+    newarg.n   = kd;
+    newarg.a   = v;
+    newarg.lda = m;
+    newarg.b   = qr;
+    newarg.c   = tau + i;
+    GEQRF_SINGLE(&newarg, NULL, NULL, sa, sb, 0);
+
+#ifndef UPPER
+    OMATCOPY_K_CN(m, kd, ONE, v, m, a21, lda);
+#else
+    OMATCOPY_K_CT(m, kd, ONE, v, m, a21, lda);
+#endif
+
+    newarg.m   = m;
+    newarg.n   = pk;
+    newarg.a   = v;
+    newarg.lda = m;
+    newarg.b   = t;
+    newarg.ldb = kd;
+    newarg.c   = tau + i;
+    LARFT(&newarg, NULL, NULL, sa, sb, 0);
+
+    for (j = 0; j < pk; j++) {
+      for (len = 0; len < j; len++) v[len + j * m] = ZERO;
+      v[j + j * m] = ONE;
+    }
+
+    /* Y := A22 V T */
+    newarg.m     = m;
+    newarg.n     = pk;
+    newarg.a     = a22;
+    newarg.lda   = lda;
+    newarg.b     = v;
+    newarg.ldb   = m;
+    newarg.c     = y;
+    newarg.ldc   = m;
+    newarg.alpha = &dp1;
+    newarg.beta  = &dz0;
+
+#ifdef SMP
+    if (nthreads > 1) {
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+#ifndef UPPER
+      SYMM_THREAD_LL(&newarg, NULL, NULL, sa, sb, 0);
+#else
+      SYMM_THREAD_LU(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+#else
+#ifndef UPPER
+      gemm_thread_n(mode, &newarg, NULL, NULL, SYMM_LL, sa, sb, nthreads);
+#else
+      gemm_thread_n(mode, &newarg, NULL, NULL, SYMM_LU, sa, sb, nthreads);
+#endif
+#endif
+    } else
+#endif
+    {
+#ifndef UPPER
+      SYMM_LL(&newarg, NULL, NULL, sa, sb, 0);
+#else
+      SYMM_LU(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+    }
+
+    newarg.m     = m;
+    newarg.n     = pk;
+    newarg.a     = t;
+    newarg.lda   = kd;
+    newarg.b     = y;
+    newarg.ldb   = m;
+    newarg.alpha = NULL;
+    newarg.beta  = NULL;
+#ifdef SMP
+    if (nthreads > 1)
+      gemm_thread_m(mode, &newarg, NULL, NULL, TRMM_RNUN, sa, sb, nthreads);
+    else
+#endif
+      TRMM_RNUN(&newarg, NULL, NULL, sa, sb, 0);
+
+    /* P := T' V' Y */
+    newarg.m     = pk;
+    newarg.n     = pk;
+    newarg.k     = m;
+    newarg.a     = v;
+    newarg.lda   = m;
+    newarg.b     = y;
+    newarg.ldb   = m;
+    newarg.c     = p;
+    newarg.ldc   = kd;
+    newarg.alpha = &dp1;
+    newarg.beta  = &dz0;
+    GEMM_TN(&newarg, NULL, NULL, sa, sb, 0);
+
+    newarg.m     = pk;
+    newarg.n     = pk;
+    newarg.a     = t;
+    newarg.lda   = kd;
+    newarg.b     = p;
+    newarg.ldb   = kd;
+    newarg.alpha = NULL;
+    newarg.beta  = NULL;
+    TRMM_LTUN(&newarg, NULL, NULL, sa, sb, 0);
+
+    /* Y := Y - V P / 2 */
+    newarg.m     = m;
+    newarg.n     = pk;
+    newarg.k     = pk;
+    newarg.a     = v;
+    newarg.lda   = m;
+    newarg.b     = p;
+    newarg.ldb   = kd;
+    newarg.c     = y;
+    newarg.ldc   = m;
+    newarg.alpha = &dm5;
+    newarg.beta  = NULL;
+#ifdef SMP
+    if (nthreads > 1)
+      gemm_thread_m(mode, &newarg, NULL, NULL, GEMM_NN, sa, sb, nthreads);
+    else
+#endif
+      GEMM_NN(&newarg, NULL, NULL, sa, sb, 0);
+
+    /* A22 := A22 - V Y' - Y V' */
+    newarg.n     = m;
+    newarg.k     = pk;
+    newarg.a     = v;
+    newarg.lda   = m;
+    newarg.b     = y;
+    newarg.ldb   = m;
+    newarg.c     = a22;
+    newarg.ldc   = lda;
+    newarg.alpha = &dm1;
+    newarg.beta  = NULL;
+
+#ifdef SMP
+    if (nthreads > 1) {
+#ifndef UPPER
+      syrk_thread(mode | BLAS_TRANSA_N | BLAS_TRANSB_T | BLAS_UPLO,
+		  &newarg, NULL, NULL, SYR2K_LN, sa, sb, nthreads);
+#else
+      syrk_thread(mode | BLAS_TRANSA_N | BLAS_TRANSB_T,
+		  &newarg, NULL, NULL, SYR2K_UN, sa, sb, nthreads);
+#endif
+    } else
+#endif
+    {
+#ifndef UPPER
+      SYR2K_LN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+      SYR2K_UN(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+    }
+  }
+
+  for (j = 0; j < n; j++) {
+#ifndef UPPER
+    len = MIN(kd, n - 1 - j) + 1;
+    COPY_K(len, a + j + j * lda, 1, ab + j * ldab, 1);
+#else
+    len = MIN(kd, j) + 1;
+    COPY_K(len, a + (j - len + 1) + j * lda, 1, ab + (kd - len + 1) + j * ldab, 1);
+#endif
+  }
+
+  return 0;
+}
@@ -81,6 +81,18 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SBGEMM_DEFAULT_Q 256
 #define SBGEMM_ALIGN_K 1  // must be 2^x
 
+#define SHGEMM_DEFAULT_UNROLL_N 4
+#define SHGEMM_DEFAULT_UNROLL_M 8
+#define SHGEMM_DEFAULT_P 256
+#define SHGEMM_DEFAULT_R 256
+#define SHGEMM_DEFAULT_Q 256
+
+#define I8GEMM_DEFAULT_UNROLL_N 4
+#define I8GEMM_DEFAULT_UNROLL_M 4
+#define I8GEMM_DEFAULT_P 256
+#define I8GEMM_DEFAULT_R 4096
+#define I8GEMM_DEFAULT_Q 512
+
 #ifdef OPTERON
 
 #define SNUMOPT		4
@@ -614,6 +626,17 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SYMV_P  8
 
+#undef SHGEMM_DEFAULT_UNROLL_N
+#undef SHGEMM_DEFAULT_UNROLL_M
+#undef SHGEMM_DEFAULT_P
+#undef SHGEMM_DEFAULT_R
+#undef SHGEMM_DEFAULT_Q
+#define SHGEMM_DEFAULT_UNROLL_N 4
+#define SHGEMM_DEFAULT_UNROLL_M 16
+#define SHGEMM_DEFAULT_P 384
+#define SHGEMM_DEFAULT_Q 768
+#define SHGEMM_DEFAULT_R 4096
+
 #if defined(XDOUBLE) || defined(DOUBLE)
 #define SWITCH_RATIO            4
 #define GEMM_PREFERED_SIZE      4
@@ -1523,6 +1546,17 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SYMV_P  8
 
+#undef SHGEMM_DEFAULT_UNROLL_N
+#undef SHGEMM_DEFAULT_UNROLL_M
+#undef SHGEMM_DEFAULT_P
+#undef SHGEMM_DEFAULT_R
+#undef SHGEMM_DEFAULT_Q
+#define SHGEMM_DEFAULT_UNROLL_N 4
+#define SHGEMM_DEFAULT_UNROLL_M 16
+#define SHGEMM_DEFAULT_P 384
+#define SHGEMM_DEFAULT_Q 768
+#define SHGEMM_DEFAULT_R 4096
+
 #if defined(XDOUBLE) || defined(DOUBLE)
 #define SWITCH_RATIO            4
 #define GEMM_PREFERED_SIZE      4
@@ -1649,6 +1683,28 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SYMV_P  8
 
+#undef SHGEMM_DEFAULT_UNROLL_N
+#undef SHGEMM_DEFAULT_UNROLL_M
+#undef SHGEMM_DEFAULT_P
+#undef SHGEMM_DEFAULT_R
+#undef SHGEMM_DEFAULT_Q
+#define SHGEMM_DEFAULT_UNROLL_N 4
+#define SHGEMM_DEFAULT_UNROLL_M 16
+#define SHGEMM_DEFAULT_P 384
+#define SHGEMM_DEFAULT_Q 768
+#define SHGEMM_DEFAULT_R 4096
+
+#undef I8GEMM_DEFAULT_UNROLL_N
+#undef I8GEMM_DEFAULT_UNROLL_M
+#undef I8GEMM_DEFAULT_P
+#undef I8GEMM_DEFAULT_R
+#undef I8GEMM_DEFAULT_Q
+#define I8GEMM_DEFAULT_UNROLL_N 8
+#define I8GEMM_DEFAULT_UNROLL_M 32
+#define I8GEMM_DEFAULT_P 384
+#define I8GEMM_DEFAULT_Q 1024
+#define I8GEMM_DEFAULT_R 4096
+
 #if defined(XDOUBLE) || defined(DOUBLE)
 #define SWITCH_RATIO           8
 #define GEMM_PREFERED_SIZE     8
@@ -1770,6 +1826,28 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SYMV_P  8
 
+#undef SHGEMM_DEFAULT_UNROLL_N
+#undef SHGEMM_DEFAULT_UNROLL_M
+#undef SHGEMM_DEFAULT_P
+#undef SHGEMM_DEFAULT_R
+#undef SHGEMM_DEFAULT_Q
+#define SHGEMM_DEFAULT_UNROLL_N 4
+#define SHGEMM_DEFAULT_UNROLL_M 16
+#define SHGEMM_DEFAULT_P 384
+#define SHGEMM_DEFAULT_Q 768
+#define SHGEMM_DEFAULT_R 4096
+
+#undef I8GEMM_DEFAULT_UNROLL_N
+#undef I8GEMM_DEFAULT_UNROLL_M
+#undef I8GEMM_DEFAULT_P
+#undef I8GEMM_DEFAULT_R
+#undef I8GEMM_DEFAULT_Q
+#define I8GEMM_DEFAULT_UNROLL_N 8
+#define I8GEMM_DEFAULT_UNROLL_M 32
+#define I8GEMM_DEFAULT_P 384
+#define I8GEMM_DEFAULT_Q 1024
+#define I8GEMM_DEFAULT_R 4096
+
 #if defined(XDOUBLE) || defined(DOUBLE)
 #define SWITCH_RATIO           8
 #define GEMM_PREFERED_SIZE     8
@@ -1903,6 +1981,28 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SYMV_P  8
 
+#undef SHGEMM_DEFAULT_UNROLL_N
+#undef SHGEMM_DEFAULT_UNROLL_M
+#undef SHGEMM_DEFAULT_P
+#undef SHGEMM_DEFAULT_R
+#undef SHGEMM_DEFAULT_Q
+#define SHGEMM_DEFAULT_UNROLL_N 4
+#define SHGEMM_DEFAULT_UNROLL_M 16
+#define SHGEMM_DEFAULT_P 384
+#define SHGEMM_DEFAULT_Q 768
+#define SHGEMM_DEFAULT_R 4096
+
+#undef I8GEMM_DEFAULT_UNROLL_N
+#undef I8GEMM_DEFAULT_UNROLL_M
+#undef I8GEMM_DEFAULT_P
+#undef I8GEMM_DEFAULT_R
+#undef I8GEMM_DEFAULT_Q
+#define I8GEMM_DEFAULT_UNROLL_N 8
+#define I8GEMM_DEFAULT_UNROLL_M 32
+#define I8GEMM_DEFAULT_P 384
+#define I8GEMM_DEFAULT_Q 1024
+#define I8GEMM_DEFAULT_R 4096
+
 #if defined(XDOUBLE) || defined(DOUBLE)
 #define SWITCH_RATIO           8
 #define GEMM_PREFERED_SIZE     8
@@ -0,0 +1,147 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include "../cblas.h"
+
+#define I8GEMM_LARGEST  256
+
+static int32_t
+round_sat (double x)
+{
+  if (x >= 2147483647.0) return 2147483647;
+  if (x <= -2147483648.0) return (-2147483647 - 1);
+  return (int32_t) (x < 0. ? x - 0.5 : x + 0.5);
+}
+
+void *malloc_safe(size_t size)
+{
+  if (size == 0)
+    return malloc(1);
+  else
+    return malloc(size);
+}
+
+/* op(X)(i, l) of a matrix stored with leading dimension ld in the given order */
+#define ELEM(X, order, trans, i, l, ld) \
+  ((((order) == CblasColMajor) ^ ((trans) == CblasTrans)) ? (X)[(i) + (l) * (ld)] : (X)[(l) + (i) * (ld)])
+
+int
+main (int argc, char *argv[])
+{
+  blasint m, n, k, lda, ldb, ldc;
+  int i, j, l, y, z;
+  blasint x;
+  int ret = 0;
+  int loop = I8GEMM_LARGEST;
+  enum CBLAS_ORDER order;
+  enum CBLAS_TRANSPOSE transA, transB;
+  enum CBLAS_OFFSET offsetC;
+  float alpha, beta;
+  int8_t ao, bo;
+
+  for (x = 0; x <= loop; x++)
+  {
+    if ((x > 100) && (x != I8GEMM_LARGEST)) continue;
+    /* odd and uneven shapes reach the edge and k-tail paths of the kernels */
+    m = x;
+    n = x / 2 + 1;
+    k = x + 3;
+    uint8_t *A = (uint8_t *)malloc_safe((k + 2) * (m + 2) * sizeof(uint8_t));
+    int8_t *B = (int8_t *)malloc_safe((k + 2) * (n + 2) * sizeof(int8_t));
+    int32_t *C = (int32_t *)malloc_safe((m + 2) * (n + 2) * sizeof(int32_t));
+    int32_t *CC = (int32_t *)malloc_safe((m + 2) * (n + 2) * sizeof(int32_t));
+    int32_t *co = (int32_t *)malloc_safe((m + n + 1) * sizeof(int32_t));
+    if ((A == NULL) || (B == NULL) || (C == NULL) || (CC == NULL) || (co == NULL))
+      return 1;
+
+    for (j = 0; j < (k + 2) * (m + 2); j++)
+      A[j] = (uint8_t) (rand () % 256);
+    for (j = 0; j < (k + 2) * (n + 2); j++)
+      B[j] = (int8_t) (rand () % 256 - 128);
+    for (j = 0; j < m + n + 1; j++)
+      co[j] = rand () % 2001 - 1000;
+
+    for (y = 0; y < 8; y++)
+    {
+      order  = (y & 1) ? CblasRowMajor : CblasColMajor;
+      transA = (y & 2) ? CblasTrans : CblasNoTrans;
+      transB = (y & 4) ? CblasTrans : CblasNoTrans;
+
+      lda = (((order == CblasColMajor) ^ (transA == CblasTrans)) ? m : k) + 2;
+      ldb = (((order == CblasColMajor) ^ (transB == CblasTrans)) ? k : n) + 2;
+      ldc = ((order == CblasColMajor) ? m : n) + 2;
+
+      for (z = 0; z < 3; z++)
+      {
+        /* plain product, accumulation into C, then scaling with offsets */
+        if (z == 0) { alpha = 1.0f; beta = 0.0f; ao = 0;  bo = 0; offsetC = CblasFixOffset; }
+        if (z == 1) { alpha = 1.0f; beta = 1.0f; ao = 0;  bo = 0; offsetC = CblasColOffset; }
+        if (z == 2) { alpha = 0.5f; beta = -2.0f; ao = -3; bo = 5; offsetC = CblasRowOffset; }
+
+        for (j = 0; j < (m + 2) * (n + 2); j++)
+          C[j] = CC[j] = rand () % 20001 - 10000;
+
+        cblas_gemm_s8u8s32 (order, transA, transB, offsetC, m, n, k, alpha,
+                            A, lda, ao, B, ldb, bo, beta, CC, ldc, co);
+
+        for (i = 0; i < m; i++)
+          for (j = 0; j < n; j++)
+          {
+            double sum = 0.;
+            int32_t *c, *cc;
+            for (l = 0; l < k; l++)
+              sum += ((double) ELEM (A, order, transA, i, l, lda) + ao) *
+                     ((double) ELEM (B, order, transB, l, j, ldb) + bo);
+            if (order == CblasColMajor) {
+              c = C + i + j * ldc;
+              cc = CC + i + j * ldc;
+            } else {
+              c = C + j + i * ldc;
+              cc = CC + j + i * ldc;
+            }
+            sum = alpha * sum;
+            if (beta != 0.0f) sum += beta * (double) *c;
+            if (offsetC == CblasFixOffset) sum += co[0];
+            if (offsetC == CblasColOffset) sum += co[i];
+            if (offsetC == CblasRowOffset) sum += co[j];
+            if (*cc != round_sat (sum))
+              ret++;
+          }
+      }
+    }
+    free(A);
+    free(B);
+    free(C);
+    free(CC);
+    free(co);
+  }
+
+  if (ret != 0)
+    fprintf (stderr, "FATAL ERROR I8GEMM - Return code: %d\n", ret);
+  return ret;
+}
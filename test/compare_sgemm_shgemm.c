@@ -0,0 +1,240 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include "../common.h"
+#define SGEMM   BLASFUNC(sgemm)
+#define SHGEMM   BLASFUNC(shgemm)
+#define SGEMV   BLASFUNC(sgemv)
+#define SHGEMV   BLASFUNC(shgemv)
+
+typedef union
+{
+  float v;
+  uint32_t u;
+} float32_bits;
+
+/* Inputs are drawn from 0.5 + j/1024, which is exact in binary16, so the
+   reference sgemm sees exactly the same operands as shgemm. */
+static hfloat16
+float32to16 (float f)
+{
+  float32_bits f32;
+  f32.v = f;
+  return (hfloat16) (((f32.u >> 16) & 0x8000U) |
+                     ((((f32.u >> 23) & 0xffU) - 112) << 10) |
+                     ((f32.u >> 13) & 0x3ffU));
+}
+
+static float
+random_half_exact (void)
+{
+  return 0.5f + (float) (rand () % 1024) / 1024.0f;
+}
+
+static int
+mismatch (float x, float ref)
+{
+  return fabs (x - ref) > 1.0e-4 * fabs (ref) + 1.0e-6;
+}
+
+#define SHGEMM_LARGEST  256
+
+void *malloc_safe(size_t size)
+{
+  if (size == 0)
+    return malloc(1);
+  else
+    return malloc(size);
+}
+
+int
+main (int argc, char *argv[])
+{
+  blasint m, n, k;
+  int i, j, l;
+  blasint x, y;
+  int ret = 0;
+  int loop = SHGEMM_LARGEST;
+  char transA = 'N', transB = 'N';
+  float alpha = 1.0, beta = 0.0;
+
+  for (x = 0; x <= loop; x++)
+  {
+    if ((x > 100) && (x != SHGEMM_LARGEST)) continue;
+    m = k = n = x;
+    float *A = (float *)malloc_safe(m * k * sizeof(FLOAT));
+    float *B = (float *)malloc_safe(k * n * sizeof(FLOAT));
+    float *C = (float *)malloc_safe(m * n * sizeof(FLOAT));
+    hfloat16 *AA = (hfloat16 *)malloc_safe(m * k * sizeof(hfloat16));
+    hfloat16 *BB = (hfloat16 *)malloc_safe(k * n * sizeof(hfloat16));
+    float *DD = (float *)malloc_safe(m * n * sizeof(FLOAT));
+    float *CC = (float *)malloc_safe(m * n * sizeof(FLOAT));
+    if ((A == NULL) || (B == NULL) || (C == NULL) || (AA == NULL) || (BB == NULL) ||
+        (DD == NULL) || (CC == NULL))
+      return 1;
+
+    for (j = 0; j < m * k; j++)
+    {
+      A[j] = random_half_exact ();
+      AA[j] = float32to16 (A[j]);
+    }
+    for (j = 0; j < k * n; j++)
+    {
+      B[j] = random_half_exact ();
+      BB[j] = float32to16 (B[j]);
+    }
+    for (y = 0; y < 4; y++)
+    {
+      if ((y == 0) || (y == 2)) {
+        transA = 'N';
+      } else {
+        transA = 'T';
+      }
+      if ((y == 0) || (y == 1)) {
+        transB = 'N';
+      } else {
+        transB = 'T';
+      }
+
+      memset(CC, 0, m * n * sizeof(FLOAT));
+      memset(DD, 0, m * n * sizeof(FLOAT));
+      memset(C, 0, m * n * sizeof(FLOAT));
+
+      SGEMM (&transA, &transB, &m, &n, &k, &alpha, A,
+        &m, B, &k, &beta, C, &m);
+      SHGEMM (&transA, &transB, &m, &n, &k, &alpha, AA,
+        &m, BB, &k, &beta, CC, &m);
+
+      for (i = 0; i < n; i++)
+        for (j = 0; j < m; j++)
+        {
+          for (l = 0; l < k; l++)
+            if (transA == 'N' && transB == 'N')
+            {
+              DD[i * m + j] +=
+                hfloat16tof32 (AA[l * m + j]) * hfloat16tof32 (BB[l + k * i]);
+            } else if (transA == 'T' && transB == 'N')
+            {
+              DD[i * m + j] +=
+                hfloat16tof32 (AA[k * j + l]) * hfloat16tof32 (BB[l + k * i]);
+            } else if (transA == 'N' && transB == 'T')
+            {
+              DD[i * m + j] +=
+                hfloat16tof32 (AA[l * m + j]) * hfloat16tof32 (BB[i + l * n]);
+            } else if (transA == 'T' && transB == 'T')
+            {
+              DD[i * m + j] +=
+                hfloat16tof32 (AA[k * j + l]) * hfloat16tof32 (BB[i + l * n]);
+            }
+          if (mismatch (CC[i * m + j], C[i * m + j]))
+            ret++;
+          if (mismatch (CC[i * m + j], DD[i * m + j]))
+            ret++;
+        }
+    }
+    free(A);
+    free(B);
+    free(C);
+    free(AA);
+    free(BB);
+    free(DD);
+    free(CC);
+  }
+
+  if (ret != 0) {
+    fprintf (stderr, "FATAL ERROR SHGEMM - Return code: %d\n", ret);
+    return ret;
+  }
+
+  for (x = 1; x <= loop; x++)
+  {
+    k = 1;
+    float *A = (float *)malloc_safe(x * x * sizeof(FLOAT));
+    float *B = (float *)malloc_safe(x * sizeof(FLOAT));
+    float *C = (float *)malloc_safe(x * sizeof(FLOAT));
+    hfloat16 *AA = (hfloat16 *)malloc_safe(x * x * sizeof(hfloat16));
+    hfloat16 *BB = (hfloat16 *)malloc_safe(x * sizeof(hfloat16));
+    float *DD = (float *)malloc_safe(x * sizeof(FLOAT));
+    float *CC = (float *)malloc_safe(x * sizeof(FLOAT));
+    if ((A == NULL) || (B == NULL) || (C == NULL) || (AA == NULL) || (BB == NULL) ||
+        (DD == NULL) || (CC == NULL))
+      return 1;
+
+    for (j = 0; j < x; j++)
+    {
+      for (i = 0; i < x; i++)
+      {
+        A[j * x + i] = random_half_exact ();
+        AA[j * x + i] = float32to16 (A[j * x + i]);
+      }
+      B[j] = random_half_exact ();
+      BB[j] = float32to16 (B[j]);
+    }
+    for (y = 0; y < 2; y++)
+    {
+      if (y == 0) {
+        transA = 'N';
+      } else {
+        transA = 'T';
+      }
+
+      memset(CC, 0, x * sizeof(FLOAT));
+      memset(DD, 0, x * sizeof(FLOAT));
+      memset(C, 0, x * sizeof(FLOAT));
+
+      SGEMV (&transA, &x, &x, &alpha, A, &x, B, &k, &beta, C, &k);
+      SHGEMV (&transA, &x, &x, &alpha, AA, &x, BB, &k, &beta, CC, &k);
+
+      for (j = 0; j < x; j++)
+        for (i = 0; i < x; i++)
+          if (transA == 'N') {
+            DD[i] += hfloat16tof32 (AA[j * x + i]) * hfloat16tof32 (BB[j]);
+          } else if (transA == 'T') {
+            DD[j] += hfloat16tof32 (AA[j * x + i]) * hfloat16tof32 (BB[i]);
+          }
+
+      for (j = 0; j < x; j++) {
+        if (mismatch (CC[j], C[j]))
+          ret++;
+        if (mismatch (CC[j], DD[j]))
+          ret++;
+      }
+    }
+    free(A);
+    free(B);
+    free(C);
+    free(AA);
+    free(BB);
+    free(DD);
+    free(CC);
+  }
+
+  if (ret != 0)
+    fprintf (stderr, "FATAL ERROR SHGEMV - Return code: %d\n", ret);
+  return ret;
+}
@@ -31,6 +31,8 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 **********************************************************************************/
 
+#include <math.h>
+#include <string.h>
 #include "common.h"
 
 /**
@@ -100,6 +102,46 @@ double dmatrix_difference(double *a, double *b, blasint cols, blasint rows, blas
     return norm/(double)(rows);
 }
 
+/**
+ * Run a call twice on the same data and compare the results
+ * 
+ * param call computes its result in the buffer passed to it
+ * param setup is called with 0 before the first run and after the second,
+ * and with 1 before the second run; may be NULL
+ * param threads_verify, threads_test specify the number of threads of
+ * the runs into c_verify and into c_test
+ * param c_test is set to the contents of c_verify before the runs
+ * param size specifies number of elements of the result
+ * return largest difference
+ */
+double dthreads_difference(void (*call)(double *), void (*setup)(int),
+                           int threads_verify, int threads_test,
+                           double *c_verify, double *c_test, blasint size)
+{
+    int nthreads = openblas_get_num_threads();
+    double diff = 0.0;
+    blasint i;
+
+    memcpy(c_test, c_verify, sizeof(double) * size);
+
+    openblas_set_num_threads(threads_verify);
+    if (setup) setup(0);
+    call(c_verify);
+
+    openblas_set_num_threads(threads_test);
+    if (setup) setup(1);
+    call(c_test);
+
+    if (setup) setup(0);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < size; i++)
+        if (fabs(c_verify[i] - c_test[i]) > diff)
+            diff = fabs(c_verify[i] - c_test[i]);
+
+    return diff;
+}
+
 /**
  * Complex conjugate operation for vector
  * 
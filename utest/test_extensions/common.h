@@ -53,6 +53,10 @@ extern void drand_generate(double *alpha, blasint n);
 extern float smatrix_difference(float *a, float *b, blasint cols, blasint rows, blasint ld);
 extern double dmatrix_difference(double *a, double *b, blasint cols, blasint rows, blasint ld);
 
+extern double dthreads_difference(void (*call)(double *), void (*setup)(int),
+                                  int threads_verify, int threads_test,
+                                  double *c_verify, double *c_test, blasint size);
+
 extern void cconjugate_vector(blasint n, blasint inc_x, float *x_ptr);
 extern void zconjugate_vector(blasint n, blasint inc_x, double *x_ptr);
 
@@ -0,0 +1,107 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 100
+
+#ifdef DYNAMIC_ARCH
+#if defined(BUILD_DOUBLE) && !defined(OS_WINDOWS)
+#include <unistd.h>
+
+static double a_test[DATASIZE * DATASIZE];
+static double b_test[DATASIZE * DATASIZE];
+static double c_test[DATASIZE * DATASIZE];
+
+/**
+ * Test that tuning (on a small GEMM to keep the test short) stores an
+ * entry for every routine in the cache file and that gemm still gives
+ * the right results afterwards
+ */
+CTEST(autotune, tune_and_store)
+{
+    char path[] = "/tmp/openblas_autotune_XXXXXX";
+    char line[512], key[256], name[16];
+    blasint n = DATASIZE;
+    char trans = 'N';
+    double alpha = 1.0, beta = 0.0, sum;
+    int fd, p, q, r, entries = 0, i, j, l;
+    FILE *fp;
+
+    fd = mkstemp(path);
+    ASSERT_TRUE(fd >= 0);
+    close(fd);
+    setenv("OPENBLAS_AUTOTUNE_FILE", path, 1);
+    setenv("OPENBLAS_AUTOTUNE_SIZE", "128", 1);
+
+    ASSERT_EQUAL(0, openblas_autotune());
+
+    fp = fopen(path, "r");
+    ASSERT_TRUE(fp != NULL);
+    while (fgets(line, sizeof(line), fp)) {
+        if (sscanf(line, "%255s %15s %d %d %d", key, name, &p, &q, &r) == 5) {
+            ASSERT_TRUE(p > 0 && q > 0 && r > 0);
+            entries++;
+        }
+    }
+    fclose(fp);
+    remove(path);
+    unsetenv("OPENBLAS_AUTOTUNE_FILE");
+    unsetenv("OPENBLAS_AUTOTUNE_SIZE");
+
+    ASSERT_TRUE(entries >= 1);
+
+    drand_generate(a_test, DATASIZE * DATASIZE);
+    drand_generate(b_test, DATASIZE * DATASIZE);
+    BLASFUNC(dgemm)(&trans, &trans, &n, &n, &n, &alpha, a_test, &n, b_test, &n, &beta, c_test, &n);
+
+    for (j = 0; j < DATASIZE; j++) {
+        for (i = 0; i < DATASIZE; i++) {
+            sum = 0.0;
+            for (l = 0; l < DATASIZE; l++) sum += a_test[i + l * DATASIZE] * b_test[l + j * DATASIZE];
+            ASSERT_DBL_NEAR_TOL(sum, c_test[i + j * DATASIZE], DOUBLE_EPS * DATASIZE);
+        }
+    }
+}
+#endif
+#else
+/**
+ * Test that builds with fixed blocking sizes report that they can not be tuned
+ */
+CTEST(autotune, unsupported)
+{
+    ASSERT_EQUAL(-1, openblas_autotune());
+}
+#endif
@@ -0,0 +1,280 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 1000000
+
+#if !defined(NO_CBLAS)
+static double a_test[DATASIZE];
+static double x_test[DATASIZE];
+static double y_test[DATASIZE];
+static double y_verify[DATASIZE];
+
+#ifdef BUILD_DOUBLE
+/**
+ * Compare cblas_dgemv_batch_strided running on four threads against one
+ * cblas_dgemv call per member.
+ *
+ * return norm of differences
+ */
+static double check_dgemv_batch_strided(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE trans,
+                                        blasint m, blasint n, blasint lda, blasint stride_a,
+                                        blasint incx, blasint stride_x, blasint incy,
+                                        blasint stride_y, blasint batch)
+{
+    int nthreads = openblas_get_num_threads();
+    double alpha = 1.5, beta = -0.5;
+    blasint leny = (trans == CblasNoTrans) ? m : n;
+    blasint i, size = stride_y * (batch - 1) + 1 + (leny - 1) * abs(incy);
+
+    drand_generate(a_test, DATASIZE);
+    drand_generate(x_test, DATASIZE);
+    drand_generate(y_test, size);
+    memcpy(y_verify, y_test, sizeof(double) * size);
+
+    for (i = 0; i < batch; i++)
+        cblas_dgemv(order, trans, m, n, alpha, a_test + i * stride_a, lda,
+                    x_test + i * stride_x, incx, beta, y_verify + i * stride_y, incy);
+
+    openblas_set_num_threads(4);
+    cblas_dgemv_batch_strided(order, trans, m, n, alpha, a_test, lda, stride_a,
+                              x_test, incx, stride_x, beta, y_test, incy, stride_y, batch);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < size; i++)
+        y_verify[i] -= y_test[i];
+
+    return BLASFUNC(dnrm2)(&size, y_verify, &(blasint){1});
+}
+
+/**
+ * Many members of one shape, enough work for all four threads
+ */
+CTEST(blas_batch, dgemv_strided_n)
+{
+    double norm = check_dgemv_batch_strided(CblasColMajor, CblasNoTrans, 120, 100, 130,
+                                            130 * 100, 1, 100, 1, 120, 64);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Row major transposed members sharing one x, with negative increments for y
+ */
+CTEST(blas_batch, dgemv_strided_rowmajor_t)
+{
+    double norm = check_dgemv_batch_strided(CblasRowMajor, CblasTrans, 90, 70, 75,
+                                            90 * 75, 2, 0, -1, 90, 100);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Two groups of different shape and transpose; every member has its own
+ * A, x and y, the members of the second group use negative increments
+ */
+CTEST(blas_batch, dgemv_groups)
+{
+    int nthreads = openblas_get_num_threads();
+    enum CBLAS_TRANSPOSE trans[2] = {CblasNoTrans, CblasTrans};
+    blasint m[2] = {200, 150}, n[2] = {180, 300}, lda[2] = {200, 160};
+    blasint incx[2] = {1, -2}, incy[2] = {1, -1}, group_size[2] = {7, 9};
+    double alpha[2] = {1.0, -0.75}, beta[2] = {0.0, 2.0};
+    double *a[16], *x[16], *y[16];
+    blasint g, i, j = 0, size = 16 * 600 * 2;
+
+    drand_generate(a_test, DATASIZE);
+    drand_generate(x_test, size);
+    drand_generate(y_test, size);
+    memcpy(y_verify, y_test, sizeof(double) * size);
+
+    for (g = 0; g < 2; g++) {
+        for (i = 0; i < group_size[g]; i++, j++) {
+            a[j] = a_test + j * 160 * 300;
+            x[j] = x_test + j * 600;
+            y[j] = y_test + j * 600;
+            cblas_dgemv(CblasColMajor, trans[g], m[g], n[g], alpha[g], a[j], lda[g],
+                        x[j], incx[g], beta[g], y_verify + j * 600, incy[g]);
+        }
+    }
+
+    openblas_set_num_threads(4);
+    cblas_dgemv_batch(CblasColMajor, trans, m, n, alpha, (const double **)a, lda,
+                      (const double **)x, incx, beta, y, incy, 2, group_size);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < size; i++)
+        y_verify[i] -= y_test[i];
+
+    ASSERT_DBL_NEAR_TOL(0.0, BLASFUNC(dnrm2)(&size, y_verify, &(blasint){1}), DOUBLE_EPS);
+}
+
+/**
+ * daxpy, dscal and ddot members of different lengths against the single calls
+ */
+CTEST(blas_batch, dlevel1_groups)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint n[3] = {3000, 1, 4000}, incx[3] = {1, 1, -3}, incy[3] = {2, 1, 1};
+    blasint group_size[3] = {40, 5, 3};
+    double alpha[3] = {0.5, -2.0, 3.0};
+    double *x[48], *y[48], dot[48], dot_verify[48];
+    blasint g, i, j = 0, size = 48 * 12000;
+
+    drand_generate(x_test, size);
+    drand_generate(y_test, size);
+    memcpy(y_verify, y_test, sizeof(double) * size);
+
+    for (g = 0; g < 3; g++) {
+        for (i = 0; i < group_size[g]; i++, j++) {
+            x[j] = x_test + j * 12000;
+            y[j] = y_test + j * 12000;
+            cblas_daxpy(n[g], alpha[g], x[j], incx[g], y_verify + j * 12000, incy[g]);
+            cblas_dscal(n[g], alpha[g], y_verify + j * 12000, 1);
+            dot_verify[j] = cblas_ddot(n[g], x[j], incx[g], y_verify + j * 12000, incy[g]);
+        }
+    }
+
+    openblas_set_num_threads(4);
+    cblas_daxpy_batch(n, alpha, (const double **)x, incx, y, incy, 3, group_size);
+    cblas_dscal_batch(n, alpha, y, (blasint[]){1, 1, 1}, 3, group_size);
+    cblas_ddot_batch(n, (const double **)x, incx, (const double **)y, incy, 3, group_size, dot);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < size; i++)
+        y_verify[i] -= y_test[i];
+
+    ASSERT_DBL_NEAR_TOL(0.0, BLASFUNC(dnrm2)(&size, y_verify, &(blasint){1}), DOUBLE_EPS);
+    for (j = 0; j < 48; j++)
+        ASSERT_DBL_NEAR_TOL(dot_verify[j], dot[j], DOUBLE_TOL * fabs(dot_verify[j]) + DOUBLE_TOL);
+}
+
+/**
+ * Strided daxpy and ddot with a shared x
+ */
+CTEST(blas_batch, dlevel1_strided)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint i, n = 5000, batch = 30, size = 2 * n * batch;
+    double dot[30], dot_verify[30];
+
+    drand_generate(x_test, n);
+    drand_generate(y_test, size);
+    memcpy(y_verify, y_test, sizeof(double) * size);
+
+    for (i = 0; i < batch; i++) {
+        cblas_daxpy(n, -1.25, x_test, 1, y_verify + i * 2 * n, 2);
+        dot_verify[i] = cblas_ddot(n, x_test, 1, y_verify + i * 2 * n, 2);
+    }
+
+    openblas_set_num_threads(4);
+    cblas_daxpy_batch_strided(n, -1.25, x_test, 1, 0, y_test, 2, 2 * n, batch);
+    cblas_ddot_batch_strided(n, x_test, 1, 0, y_test, 2, 2 * n, batch, dot);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < size; i++)
+        y_verify[i] -= y_test[i];
+
+    ASSERT_DBL_NEAR_TOL(0.0, BLASFUNC(dnrm2)(&size, y_verify, &(blasint){1}), DOUBLE_EPS);
+    for (i = 0; i < batch; i++)
+        ASSERT_DBL_NEAR_TOL(dot_verify[i], dot[i], DOUBLE_TOL * fabs(dot_verify[i]) + DOUBLE_TOL);
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when the members of y overlap
+ */
+CTEST(blas_batch, xerbla_dgemv_overlapping_y)
+{
+    set_xerbla("DGEMV_BATCH_STRIDED ", 14);
+    cblas_dgemv_batch_strided(CblasColMajor, CblasNoTrans, 10, 10, 1.0, a_test, 10, 100,
+                              x_test, 1, 10, 0.0, y_test, 1, 9, 2);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when a group size is negative
+ */
+CTEST(blas_batch, xerbla_daxpy_group_size)
+{
+    set_xerbla("DAXPY_BATCH ", 8);
+    cblas_daxpy_batch((blasint[]){10}, (double[]){1.0}, (const double **)&(double *){x_test},
+                      (blasint[]){1}, &(double *){y_test}, (blasint[]){1}, 1, (blasint[]){-1});
+    ASSERT_EQUAL(TRUE, check_error());
+}
+#endif
+
+#ifdef BUILD_COMPLEX
+/**
+ * Transposed and conjugated cgemv members, followed by a caxpy and a cscal
+ * batch over the results
+ */
+CTEST(blas_batch, complex_strided)
+{
+    int nthreads = openblas_get_num_threads();
+    float *a = (float *)a_test, *x = (float *)x_test, *y = (float *)y_test, *yv = (float *)y_verify;
+    float alpha[2] = {0.5f, 1.0f}, beta[2] = {-1.0f, 0.25f};
+    blasint i, m = 70, n = 60, lda = 72, batch = 50, stride_y = 2 * n;
+    blasint size = 2 * stride_y * batch;
+    float norm;
+
+    srand_generate(a, 2 * lda * n * batch);
+    srand_generate(x, 2 * m * batch);
+    srand_generate(y, size);
+    memcpy(yv, y, sizeof(float) * size);
+
+    for (i = 0; i < batch; i++) {
+        cblas_cgemv(CblasColMajor, CblasConjTrans, m, n, alpha, a + 2 * i * lda * n, lda,
+                    x + 2 * i * m, 1, beta, yv + 2 * i * stride_y, 1);
+        cblas_caxpy(n, beta, x + 2 * i * m, 1, yv + 2 * i * stride_y, 1);
+        cblas_cscal(n, alpha, yv + 2 * i * stride_y, 1);
+    }
+
+    openblas_set_num_threads(4);
+    cblas_cgemv_batch_strided(CblasColMajor, CblasConjTrans, m, n, alpha, a, lda, lda * n,
+                              x, 1, m, beta, y, 1, stride_y, batch);
+    cblas_caxpy_batch_strided(n, beta, x, 1, m, y, 1, stride_y, batch);
+    cblas_cscal_batch_strided(n, alpha, y, 1, stride_y, batch);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < size; i++)
+        yv[i] -= y[i];
+
+    norm = BLASFUNC(scnrm2)(&(blasint){size / 2}, yv, &(blasint){1});
+    ASSERT_DBL_NEAR_TOL(0.0, norm, SINGLE_EPS);
+}
+#endif
+#endif
@@ -0,0 +1,131 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+/* More buffers than fit in the first two chunks of the table */
+#define HELD (2 * NUM_BUFFERS + 1)
+
+static void *held[HELD];
+
+/**
+ * Test that more buffers than NUM_BUFFERS can be held at once,
+ * and that each of them is a separate, usable region
+ */
+CTEST(buffer_table, grows_past_num_buffers)
+{
+    int i, j;
+
+    for (i = 0; i < HELD; i++) {
+        held[i] = blas_memory_alloc(1);
+        ASSERT_NOT_NULL(held[i]);
+        ((char *)held[i])[0] = (char)i;
+        ((char *)held[i])[BUFFER_SIZE - 1] = (char)i;
+    }
+
+    for (i = 0; i < HELD; i++) {
+        ASSERT_EQUAL((char)i, ((char *)held[i])[0]);
+        for (j = 0; j < i; j++)
+            ASSERT_TRUE(held[i] != held[j]);
+    }
+
+    for (i = 0; i < HELD; i++) blas_memory_free(held[i]);
+}
+
+/**
+ * Test that freed buffers are handed out again instead of
+ * mapping new ones
+ */
+CTEST(buffer_table, reuses_freed_buffers)
+{
+    size_t before[OPENBLAS_HUGEPAGES_1G + 1], after[OPENBLAS_HUGEPAGES_1G + 1];
+    int i, k;
+
+    for (i = 0; i < HELD; i++) held[i] = blas_memory_alloc(1);
+    for (i = 0; i < HELD; i++) blas_memory_free(held[i]);
+
+    openblas_get_hugepage_stats(before);
+    for (i = 0; i < HELD; i++) held[i] = blas_memory_alloc(1);
+    openblas_get_hugepage_stats(after);
+
+    for (i = 0; i < HELD; i++) blas_memory_free(held[i]);
+
+    for (k = 0; k <= OPENBLAS_HUGEPAGES_1G; k++)
+        ASSERT_EQUAL(before[k], after[k]);
+}
+
+#if (defined(SMP) || defined(USE_LOCKING)) && !defined(OS_WINDOWS)
+#define CALLERS 64
+
+static pthread_barrier_t callers_barrier;
+
+static void *hold_buffer(void *arg)
+{
+    void *buffer = blas_memory_alloc(1);
+
+    if (buffer != NULL) ((char *)buffer)[0] = 1;
+
+    /* all callers hold their buffer at the same time */
+    pthread_barrier_wait(&callers_barrier);
+
+    if (buffer != NULL) blas_memory_free(buffer);
+
+    return buffer;
+}
+
+/**
+ * Test that many threads can hold a buffer concurrently
+ */
+CTEST(buffer_table, concurrent_callers)
+{
+    pthread_t thread[CALLERS];
+    void *buffer[CALLERS];
+    int i, j;
+
+    ASSERT_EQUAL(0, pthread_barrier_init(&callers_barrier, NULL, CALLERS));
+
+    for (i = 0; i < CALLERS; i++)
+        ASSERT_EQUAL(0, pthread_create(&thread[i], NULL, hold_buffer, NULL));
+    for (i = 0; i < CALLERS; i++)
+        ASSERT_EQUAL(0, pthread_join(thread[i], &buffer[i]));
+
+    pthread_barrier_destroy(&callers_barrier);
+
+    for (i = 0; i < CALLERS; i++) {
+        ASSERT_NOT_NULL(buffer[i]);
+        for (j = 0; j < i; j++)
+            ASSERT_TRUE(buffer[i] != buffer[j]);
+    }
+}
+#endif
@@ -0,0 +1,128 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 200
+
+#ifdef BUILD_DOUBLE
+static double a_test[DATASIZE * DATASIZE];
+static double b_test[DATASIZE * DATASIZE];
+static double c_test[DATASIZE * DATASIZE];
+static double c_verify[DATASIZE * DATASIZE];
+
+static void context_gemm(double *c)
+{
+    blasint n = DATASIZE;
+    char trans = 'N';
+    double alpha = 1.0, beta = 0.0;
+
+    BLASFUNC(dgemm)(&trans, &trans, &n, &n, &n, &alpha, a_test, &n, b_test, &n, &beta, c, &n);
+}
+
+#if defined(SMP_SERVER) && !defined(USE_OPENMP) && !defined(OS_WINDOWS)
+/**
+ * Test that a call made with a current context gives the same
+ * result as one on the default pool
+ */
+CTEST(context, dgemm_on_context)
+{
+    openblas_context_t context, previous;
+    int i;
+
+    drand_generate(a_test, DATASIZE * DATASIZE);
+    drand_generate(b_test, DATASIZE * DATASIZE);
+
+    context_gemm(c_verify);
+
+    context = openblas_context_create(3);
+    ASSERT_TRUE(context != NULL);
+    ASSERT_EQUAL(3, openblas_context_get_num_threads(context));
+
+    previous = openblas_context_set_current(context);
+    ASSERT_TRUE(previous == NULL);
+    ASSERT_TRUE(openblas_context_get_current() == context);
+
+    context_gemm(c_test);
+
+    openblas_context_destroy(context);
+    ASSERT_TRUE(openblas_context_get_current() == NULL);
+
+    for (i = 0; i < DATASIZE * DATASIZE; i++)
+        ASSERT_DBL_NEAR_TOL(c_verify[i], c_test[i], DOUBLE_EPS);
+}
+
+/**
+ * Test that the thread count of a context is kept within 1..MAX_CPU_NUMBER
+ */
+CTEST(context, num_threads_limits)
+{
+    openblas_context_t context;
+
+    context = openblas_context_create(0);
+    ASSERT_TRUE(context != NULL);
+    ASSERT_EQUAL(1, openblas_context_get_num_threads(context));
+    openblas_context_destroy(context);
+
+    context = openblas_context_create(MAX_CPU_NUMBER + 1);
+    ASSERT_TRUE(context != NULL);
+    ASSERT_TRUE(openblas_context_get_num_threads(context) <= MAX_CPU_NUMBER);
+    openblas_context_destroy(context);
+}
+#else
+/**
+ * Test that builds without the pthreads server keep using the default pool
+ */
+CTEST(context, unavailable)
+{
+    int i;
+
+    ASSERT_TRUE(openblas_context_create(2) == NULL);
+    ASSERT_TRUE(openblas_context_get_current() == NULL);
+    ASSERT_EQUAL(openblas_get_num_threads(), openblas_context_get_num_threads(NULL));
+
+    drand_generate(a_test, DATASIZE * DATASIZE);
+    drand_generate(b_test, DATASIZE * DATASIZE);
+    context_gemm(c_verify);
+
+    /* Setting no context leaves the calls on the default pool */
+    ASSERT_TRUE(openblas_context_set_current(NULL) == NULL);
+    context_gemm(c_test);
+
+    for (i = 0; i < DATASIZE * DATASIZE; i++)
+        ASSERT_DBL_NEAR_TOL(c_verify[i], c_test[i], DOUBLE_EPS);
+}
+#endif
+#endif
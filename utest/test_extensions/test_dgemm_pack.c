@@ -0,0 +1,233 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 300
+
+struct DATA_DGEMM_PACK {
+    double a_test[DATASIZE * DATASIZE];
+    double b_test[DATASIZE * DATASIZE];
+    double c_test[DATASIZE * DATASIZE];
+    double c_verify[DATASIZE * DATASIZE];
+};
+
+#if defined(BUILD_DOUBLE) && !defined(NO_CBLAS)
+static struct DATA_DGEMM_PACK data_dgemm_pack;
+
+/**
+ * Compare results of cblas_dgemm_compute against cblas_dgemm
+ *
+ * param order specifies row or column major order
+ * param transa specifies op(A), the transposition operation applied to A
+ * param transb specifies op(B), the transposition operation applied to B
+ * param packa, packb - pack A and/or B with cblas_dgemm_pack beforehand
+ * param m, n, k - dimensions of the product op(A) * op(B)
+ * param alpha - scaling factor applied while packing (1.0 for unpacked operands)
+ * param beta - scaling factor for matrix C
+ * return norm of differences
+ */
+static double check_dgemm_pack(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                              enum CBLAS_TRANSPOSE transb, int packa, int packb,
+                              blasint m, blasint n, blasint k, double alpha, double beta)
+{
+    blasint lda, ldb, ldc, a_cols, b_cols, c_cols;
+    blasint i;
+    double *a_pack = NULL, *b_pack = NULL;
+    double gemm_alpha = 1.0;
+
+    if (order == CblasColMajor) {
+        lda = (transa == CblasNoTrans) ? m : k;
+        ldb = (transb == CblasNoTrans) ? k : n;
+        a_cols = (transa == CblasNoTrans) ? k : m;
+        b_cols = (transb == CblasNoTrans) ? n : k;
+        ldc = m; c_cols = n;
+    } else {
+        lda = (transa == CblasNoTrans) ? k : m;
+        ldb = (transb == CblasNoTrans) ? n : k;
+        a_cols = (transa == CblasNoTrans) ? m : k;
+        b_cols = (transb == CblasNoTrans) ? k : n;
+        ldc = n; c_cols = m;
+    }
+
+    drand_generate(data_dgemm_pack.a_test, lda * a_cols);
+    drand_generate(data_dgemm_pack.b_test, ldb * b_cols);
+    drand_generate(data_dgemm_pack.c_test, ldc * c_cols);
+
+    for (i = 0; i < ldc * c_cols; i++)
+        data_dgemm_pack.c_verify[i] = data_dgemm_pack.c_test[i];
+
+    if (packa) gemm_alpha *= alpha;
+    if (packb) gemm_alpha *= alpha;
+
+    cblas_dgemm(order, transa, transb, m, n, k, gemm_alpha, data_dgemm_pack.a_test, lda,
+                data_dgemm_pack.b_test, ldb, beta, data_dgemm_pack.c_verify, ldc);
+
+    if (packa) {
+        a_pack = (double *)malloc(cblas_dgemm_pack_get_size(CblasAMatrix, m, n, k));
+        cblas_dgemm_pack(order, CblasAMatrix, transa, m, n, k, alpha,
+                         data_dgemm_pack.a_test, lda, a_pack);
+    }
+    if (packb) {
+        b_pack = (double *)malloc(cblas_dgemm_pack_get_size(CblasBMatrix, m, n, k));
+        cblas_dgemm_pack(order, CblasBMatrix, transb, m, n, k, alpha,
+                         data_dgemm_pack.b_test, ldb, b_pack);
+    }
+
+    cblas_dgemm_compute(order, packa ? CblasPacked : transa, packb ? CblasPacked : transb,
+                        m, n, k, packa ? a_pack : data_dgemm_pack.a_test, lda,
+                        packb ? b_pack : data_dgemm_pack.b_test, ldb,
+                        beta, data_dgemm_pack.c_test, ldc);
+
+    free(a_pack);
+    free(b_pack);
+
+    return dmatrix_difference(data_dgemm_pack.c_test, data_dgemm_pack.c_verify, ldc, c_cols, ldc);
+}
+
+/**
+ * Test dgemm_compute with packed A, A not transposed, B not transposed
+ */
+CTEST(dgemm_pack, colmajor_pack_a_notrans_notrans)
+{
+    double norm = check_dgemm_pack(CblasColMajor, CblasNoTrans, CblasNoTrans, 1, 0,
+                                  100, 50, 300, 2.0, 1.5);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Test dgemm_compute with packed A, A transposed, B transposed
+ */
+CTEST(dgemm_pack, colmajor_pack_a_trans_trans)
+{
+    double norm = check_dgemm_pack(CblasColMajor, CblasTrans, CblasTrans, 1, 0,
+                                  257, 33, 129, 1.0, 0.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Test dgemm_compute with packed B, A transposed, B not transposed
+ */
+CTEST(dgemm_pack, colmajor_pack_b_trans_notrans)
+{
+    double norm = check_dgemm_pack(CblasColMajor, CblasTrans, CblasNoTrans, 0, 1,
+                                  61, 290, 270, 0.5, 2.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Test dgemm_compute with both operands packed
+ */
+CTEST(dgemm_pack, colmajor_pack_ab_notrans_trans)
+{
+    double norm = check_dgemm_pack(CblasColMajor, CblasNoTrans, CblasTrans, 1, 1,
+                                  150, 99, 280, 0.5, 1.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Test dgemm_compute in row major order with packed A
+ */
+CTEST(dgemm_pack, rowmajor_pack_a_notrans_notrans)
+{
+    double norm = check_dgemm_pack(CblasRowMajor, CblasNoTrans, CblasNoTrans, 1, 0,
+                                  77, 120, 260, 1.0, 0.5);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Test dgemm_compute in row major order with packed B
+ */
+CTEST(dgemm_pack, rowmajor_pack_b_trans_trans)
+{
+    double norm = check_dgemm_pack(CblasRowMajor, CblasTrans, CblasTrans, 0, 1,
+                                  200, 17, 90, 2.0, 0.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when the leading dimension passed to dgemm_pack is too small
+ */
+CTEST(dgemm_pack, xerbla_pack_invalid_ld)
+{
+    set_xerbla("DGEMM_PACK ", 9);
+    cblas_dgemm_pack(CblasColMajor, CblasAMatrix, CblasNoTrans, 50, 50, 50, 1.0,
+                     data_dgemm_pack.a_test, 49, data_dgemm_pack.c_test);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when the packed A does not match the problem size
+ */
+CTEST(dgemm_pack, xerbla_compute_mismatched_pack)
+{
+    double *a_pack = (double *)malloc(cblas_dgemm_pack_get_size(CblasAMatrix, 20, 20, 20));
+
+    cblas_dgemm_pack(CblasColMajor, CblasAMatrix, CblasNoTrans, 20, 20, 20, 1.0,
+                     data_dgemm_pack.a_test, 20, a_pack);
+
+    set_xerbla("DGEMM_COMPUTE ", 6);
+    cblas_dgemm_compute(CblasColMajor, CblasPacked, CblasNoTrans, 20, 20, 30, a_pack, 20,
+                        data_dgemm_pack.b_test, 30, 0.0, data_dgemm_pack.c_test, 20);
+    free(a_pack);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when the packed A was made with other GEMM blocking
+ */
+CTEST(dgemm_pack, xerbla_compute_stale_pack)
+{
+    double *a_pack = (double *)malloc(cblas_dgemm_pack_get_size(CblasAMatrix, 20, 20, 20));
+
+    cblas_dgemm_pack(CblasColMajor, CblasAMatrix, CblasNoTrans, 20, 20, 20, 1.0,
+                     data_dgemm_pack.a_test, 20, a_pack);
+    ((gemm_pack_t *)a_pack)->q += 1;
+
+    set_xerbla("DGEMM_COMPUTE ", 6);
+    cblas_dgemm_compute(CblasColMajor, CblasPacked, CblasNoTrans, 20, 20, 20, a_pack, 20,
+                        data_dgemm_pack.b_test, 20, 0.0, data_dgemm_pack.c_test, 20);
+    free(a_pack);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+#endif
@@ -0,0 +1,179 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#if !defined(NO_CBLAS) && defined(BUILD_SINGLE) && defined(BUILD_DOUBLE)
+
+/* well above double rounding, well below what single precision reaches */
+#define BACKWARD_TOL 1e-12
+
+/**
+ * Solve A X = B with dsgesv and check the backward error
+ * |B - A X|_max / (|A|_max |X|_max) of the returned X.
+ * A is random, with `diag` added to its diagonal. A nonzero `near`
+ * makes column 1 differ from column 0 by only `near` times a random
+ * column, and a nonzero `big` is stored in A(0, 1).
+ *
+ * return backward error, with the ITER output in *iter
+ */
+static double check_dsgesv(blasint n, blasint nrhs, blasint ldx, double diag, double near,
+                           double big, int threads, blasint *iter)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint info;
+    blasint i, *ipiv;
+    double *a, *a0, *b, *x, *r, *work, anorm = 0.0, xnorm = 0.0, rnorm = 0.0;
+    float *swork;
+
+    a     = (double *)malloc(sizeof(double) * n * n);
+    a0    = (double *)malloc(sizeof(double) * n * n);
+    b     = (double *)malloc(sizeof(double) * n * nrhs);
+    x     = (double *)malloc(sizeof(double) * ldx * nrhs);
+    r     = (double *)malloc(sizeof(double) * n * nrhs);
+    work  = (double *)malloc(sizeof(double) * n * nrhs);
+    swork = (float *)malloc(sizeof(float) * n * (n + nrhs));
+    ipiv  = (blasint *)malloc(sizeof(blasint) * n);
+
+    drand_generate(a, n * n);
+    for (i = 0; i < n; i++) a[i + i * n] += diag;
+    if (near != 0.0)
+        for (i = 0; i < n; i++) a[i + n] = a[i] + near * a[i + n];
+    if (big != 0.0) a[n] = big;
+    for (i = 0; i < n * n; i++) a0[i] = a[i];
+    drand_generate(b, n * nrhs);
+    for (i = 0; i < n * nrhs; i++) r[i] = b[i];
+
+    openblas_set_num_threads(threads);
+    BLASFUNC(dsgesv)(&n, &nrhs, a, &n, ipiv, b, &n, x, &ldx, work, swork, iter, &info);
+    openblas_set_num_threads(nthreads);
+    ASSERT_EQUAL(0, info);
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, nrhs, n,
+                -1.0, a0, n, x, ldx, 1.0, r, n);
+
+    for (i = 0; i < n * n; i++) anorm = MAX(anorm, fabs(a0[i]));
+    for (i = 0; i < n * nrhs; i++) {
+        rnorm = MAX(rnorm, fabs(r[i]));
+        xnorm = MAX(xnorm, fabs(x[(i % n) + (i / n) * ldx]));
+    }
+
+    free(a); free(a0); free(b); free(x); free(r); free(work); free(swork); free(ipiv);
+
+    return rnorm / (anorm * xnorm);
+}
+
+/**
+ * Well conditioned system, refined from the single precision factors
+ */
+CTEST(dsgesv, refined)
+{
+    blasint iter;
+    double err = check_dsgesv(300, 1, 300, 300.0, 0.0, 0.0, 1, &iter);
+
+    ASSERT_TRUE(iter >= 0);
+    ASSERT_DBL_NEAR_TOL(0.0, err, BACKWARD_TOL);
+}
+
+/**
+ * Several right-hand sides, padded ldx, threaded factorization
+ */
+CTEST(dsgesv, refined_threaded)
+{
+    blasint iter;
+    double err = check_dsgesv(600, 5, 611, 600.0, 0.0, 0.0, 4, &iter);
+
+    ASSERT_TRUE(iter >= 0);
+    ASSERT_DBL_NEAR_TOL(0.0, err, BACKWARD_TOL);
+}
+
+/**
+ * Too ill conditioned for single precision: refinement does not
+ * converge and the system is solved in double precision
+ */
+CTEST(dsgesv, no_convergence)
+{
+    blasint iter;
+    double err = check_dsgesv(200, 2, 200, 0.0, 1e-9, 0.0, 1, &iter);
+
+    ASSERT_TRUE(iter < 0);
+    ASSERT_DBL_NEAR_TOL(0.0, err, BACKWARD_TOL);
+}
+
+/**
+ * An entry out of single precision range
+ */
+CTEST(dsgesv, overflow)
+{
+    blasint iter;
+    double err = check_dsgesv(50, 1, 50, 50.0, 0.0, 1e300, 1, &iter);
+
+    ASSERT_EQUAL(-2, iter);
+    ASSERT_DBL_NEAR_TOL(0.0, err, BACKWARD_TOL);
+}
+
+/**
+ * Exactly singular matrix is reported by the double precision factorization
+ */
+CTEST(dsgesv, singular)
+{
+    blasint n = 20, nrhs = 1, iter, info;
+    blasint i, ipiv[20];
+    double a[400], b[20], x[20], work[20];
+    float swork[420];
+
+    drand_generate(a, n * n);
+    for (i = 0; i < n; i++) a[i + 5 * n] = 0.0;
+    drand_generate(b, n);
+
+    BLASFUNC(dsgesv)(&n, &nrhs, a, &n, ipiv, b, &n, x, &n, work, swork, &iter, &info);
+    ASSERT_EQUAL(-3, iter);
+    ASSERT_EQUAL(6, info);
+}
+
+CTEST(dsgesv, xerbla_ldx)
+{
+    blasint n = 10, nrhs = 1, ldx = 5, iter, info;
+    blasint ipiv[10];
+    double a[100], b[10], x[10], work[10];
+    float swork[110];
+
+    set_xerbla("DSGESV", 9);
+    BLASFUNC(dsgesv)(&n, &nrhs, a, &n, ipiv, b, &n, x, &ldx, work, swork, &iter, &info);
+    ASSERT_EQUAL(TRUE, check_error());
+    ASSERT_EQUAL(-9, info);
+}
+#endif
@@ -0,0 +1,190 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DIM 600
+
+#ifdef BUILD_DOUBLE
+static double a_test[DIM * DIM * 2];
+static double b_test[DIM * DIM * 2];
+static double c_test[DIM * DIM * 2];
+static double c_verify[DIM * DIM * 2];
+
+static void dynamic_mode(int enable)
+{
+    openblas_set_dynamic_gemm(enable);
+}
+
+/**
+ * Run a call with four threads with static and with dynamic shares
+ * and compare
+ */
+static void check_dynamic(void (*call)(double *), blasint size)
+{
+    int old = openblas_get_dynamic_gemm();
+    double diff;
+
+    drand_generate(a_test, DIM * DIM * 2);
+    drand_generate(b_test, DIM * DIM * 2);
+    drand_generate(c_verify, size);
+
+    diff = dthreads_difference(call, dynamic_mode, 4, 4, c_verify, c_test, size);
+    openblas_set_dynamic_gemm(old);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, 1e-10);
+}
+
+static void dgemm_tall(double *c)
+{
+    blasint m = DIM, n = DIM / 4, k = DIM;
+    double alpha = 1.5, beta = 0.5;
+
+    BLASFUNC(dgemm)("N", "N", &m, &n, &k, &alpha, a_test, &m, b_test, &k, &beta, c, &m);
+}
+
+static void dgemm_wide(double *c)
+{
+    blasint m = DIM / 8, n = DIM, k = DIM / 2;
+    double alpha = 1.5, beta = 0.0;
+
+    BLASFUNC(dgemm)("T", "T", &m, &n, &k, &alpha, a_test, &k, b_test, &n, &beta, c, &m);
+}
+
+#ifdef BUILD_COMPLEX16
+static void zgemm_square(double *c)
+{
+    blasint n = DIM / 2;
+    double alpha[] = {1.5, -0.5}, beta[] = {0.5, 0.25};
+
+    BLASFUNC(zgemm)("N", "C", &n, &n, &n, alpha, a_test, &n, b_test, &n, beta, c, &n);
+}
+#endif
+
+static void dsymm_right(double *c)
+{
+    blasint m = DIM, n = DIM / 3;
+    double alpha = 1.5, beta = 1.0;
+
+    BLASFUNC(dsymm)("R", "L", &m, &n, &alpha, a_test, &n, b_test, &m, &beta, c, &m);
+}
+
+/**
+ * Test switching the mode
+ */
+CTEST(dynamic_gemm, set_and_get)
+{
+    int old = openblas_get_dynamic_gemm();
+
+    ASSERT_EQUAL(old, openblas_set_dynamic_gemm(1));
+    ASSERT_EQUAL(1, openblas_get_dynamic_gemm());
+    ASSERT_EQUAL(1, openblas_set_dynamic_gemm(0));
+    ASSERT_EQUAL(0, openblas_get_dynamic_gemm());
+
+    openblas_set_dynamic_gemm(old);
+}
+
+#ifdef SMP
+/**
+ * Test the order the tasks are claimed in: round after round, and in each
+ * round the chunks of B to pack ahead of the blocks of C that wait for them
+ */
+CTEST(dynamic_gemm, claim_order)
+{
+    BLASLONG tasks = 7, chunks = 3, rounds = 4;
+    BLASLONG task, round, index, last = 0, packed = 0, updated = 0;
+    int block;
+
+    for (task = 0; task < rounds * tasks; task++) {
+        block = blas_dynamic_task(task, tasks, chunks, &round, &index);
+
+        if (round != last) {
+            ASSERT_EQUAL(last + 1, round);
+            ASSERT_EQUAL(tasks - chunks, updated);
+            last = round;
+            packed = 0;
+            updated = 0;
+        }
+
+        if (block) {
+            ASSERT_EQUAL(chunks, packed);
+            ASSERT_EQUAL(updated, index);
+            updated++;
+        } else {
+            ASSERT_EQUAL(0, updated);
+            ASSERT_EQUAL(packed, index);
+            packed++;
+        }
+    }
+
+    ASSERT_EQUAL(rounds - 1, last);
+    ASSERT_EQUAL(tasks - chunks, updated);
+}
+#endif
+
+/**
+ * Tall C with steps in k, blocks taken over m
+ */
+CTEST(dynamic_gemm, dgemm_tall)
+{
+    check_dynamic(dgemm_tall, DIM * DIM / 4);
+}
+
+/**
+ * C of a single block of m, the panel is cut between threads
+ */
+CTEST(dynamic_gemm, dgemm_wide)
+{
+    check_dynamic(dgemm_wide, DIM / 8 * DIM);
+}
+
+#ifdef BUILD_COMPLEX16
+/**
+ * Complex C with complex beta
+ */
+CTEST(dynamic_gemm, zgemm_square)
+{
+    check_dynamic(zgemm_square, DIM * DIM / 2);
+}
+#endif
+
+/**
+ * symm, which shares the level 3 driver with its own copy routines
+ */
+CTEST(dynamic_gemm, dsymm_right)
+{
+    check_dynamic(dsymm_right, DIM * DIM / 3);
+}
+#endif
@@ -0,0 +1,229 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 400000
+
+#if !defined(NO_CBLAS)
+static double a_test[DATASIZE];
+static double b_test[DATASIZE];
+static double c_test[DATASIZE];
+static double c_verify[DATASIZE];
+
+#ifdef BUILD_DOUBLE
+/**
+ * Compare cblas_dgemm_batch_strided running on four threads against one
+ * cblas_dgemm call per member. A, B and C hold the members of the batch
+ * at the given strides, a stride of 0 shares the operand.
+ *
+ * return norm of differences
+ */
+static double check_dgemm_batch_strided(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                                        enum CBLAS_TRANSPOSE transb, blasint m, blasint n, blasint k,
+                                        blasint lda, blasint stride_a, blasint ldb, blasint stride_b,
+                                        blasint ldc, blasint stride_c, blasint batch)
+{
+    int nthreads = openblas_get_num_threads();
+    double alpha = 1.5, beta = -0.5;
+    blasint i, size = stride_c * (batch - 1) + ldc * ((order == CblasColMajor) ? n : m);
+
+    drand_generate(a_test, DATASIZE);
+    drand_generate(b_test, DATASIZE);
+    drand_generate(c_test, size);
+    memcpy(c_verify, c_test, sizeof(double) * size);
+
+    for (i = 0; i < batch; i++)
+        cblas_dgemm(order, transa, transb, m, n, k, alpha, a_test + i * stride_a, lda,
+                    b_test + i * stride_b, ldb, beta, c_verify + i * stride_c, ldc);
+
+    openblas_set_num_threads(4);
+    cblas_dgemm_batch_strided(order, transa, transb, m, n, k, alpha, a_test, lda, stride_a,
+                              b_test, ldb, stride_b, beta, c_test, ldc, stride_c, batch);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < size; i++)
+        c_verify[i] -= c_test[i];
+
+    return BLASFUNC(dnrm2)(&size, c_verify, &(blasint){1});
+}
+
+/**
+ * Many small members, run side by side
+ */
+CTEST(gemm_batch_strided, dgemm_small_members)
+{
+    double norm = check_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasTrans, 13, 9, 11,
+                                            15, 15 * 11, 10, 10 * 11, 14, 14 * 9, 37);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * A few large members, each split over the threads
+ */
+CTEST(gemm_batch_strided, dgemm_large_members)
+{
+    double norm = check_dgemm_batch_strided(CblasColMajor, CblasTrans, CblasNoTrans, 200, 190, 150,
+                                            150, 150 * 200, 150, 150 * 190, 200, 200 * 190, 5);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Shared A with B and C members stored back to back
+ */
+CTEST(gemm_batch_strided, dgemm_shared_a_contiguous)
+{
+    double norm = check_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 64, 20, 48,
+                                            64, 0, 48, 48 * 20, 64, 64 * 20, 12);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Shared, transposed B, packed once for all members
+ */
+CTEST(gemm_batch_strided, dgemm_shared_b)
+{
+    double norm = check_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasTrans, 150, 100, 80,
+                                            150, 150 * 80 + 3, 100, 0, 152, 152 * 100, 9);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Row major members with a shared A, which turns into a shared B
+ */
+CTEST(gemm_batch_strided, dgemm_row_major_shared_a)
+{
+    double norm = check_dgemm_batch_strided(CblasRowMajor, CblasTrans, CblasNoTrans, 120, 100, 90,
+                                            120, 0, 100, 90 * 100, 104, 104 * 120, 11);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when the members of C overlap
+ */
+CTEST(gemm_batch_strided, xerbla_dgemm_overlapping_c)
+{
+    set_xerbla("DGEMM_BATCH_STRIDED ", 16);
+    cblas_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 10, 10, 10, 1.0,
+                              a_test, 10, 100, b_test, 10, 100, 0.0, c_test, 10, 99, 2);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when a stride is negative
+ */
+CTEST(gemm_batch_strided, xerbla_dgemm_negative_stride)
+{
+    set_xerbla("DGEMM_BATCH_STRIDED ", 9);
+    cblas_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 10, 10, 10, 1.0,
+                              a_test, 10, -100, b_test, 10, 100, 0.0, c_test, 10, 100, 2);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when a stride is negative in row major order, where
+ * the positions of A and B are swapped as in cblas_dgemm
+ */
+CTEST(gemm_batch_strided, xerbla_dgemm_row_major_negative_stride)
+{
+    set_xerbla("DGEMM_BATCH_STRIDED ", 12);
+    cblas_dgemm_batch_strided(CblasRowMajor, CblasNoTrans, CblasNoTrans, 10, 10, 10, 1.0,
+                              a_test, 10, -100, b_test, 10, 100, 0.0, c_test, 10, 100, 2);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+/**
+ * Compare cblas_zgemm_batch_strided on four threads against cblas_zgemm
+ * per member, strides count complex elements
+ *
+ * return norm of differences
+ */
+static double check_zgemm_batch_strided(enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                                        blasint m, blasint n, blasint k, blasint stride_a,
+                                        blasint stride_b, blasint batch)
+{
+    int nthreads = openblas_get_num_threads();
+    double alpha[] = {1.0, -2.0}, beta[] = {0.5, 0.25};
+    blasint lda = (transa == CblasNoTrans || transa == CblasConjNoTrans) ? m : k;
+    blasint ldb = (transb == CblasNoTrans || transb == CblasConjNoTrans) ? k : n;
+    blasint i, size = 2 * m * n * batch;
+
+    drand_generate(a_test, DATASIZE);
+    drand_generate(b_test, DATASIZE);
+    drand_generate(c_test, size);
+    memcpy(c_verify, c_test, sizeof(double) * size);
+
+    for (i = 0; i < batch; i++)
+        cblas_zgemm(CblasColMajor, transa, transb, m, n, k, alpha, a_test + 2 * i * stride_a, lda,
+                    b_test + 2 * i * stride_b, ldb, beta, c_verify + 2 * i * m * n, m);
+
+    openblas_set_num_threads(4);
+    cblas_zgemm_batch_strided(CblasColMajor, transa, transb, m, n, k, alpha, a_test, lda, stride_a,
+                              b_test, ldb, stride_b, beta, c_test, m, m * n, batch);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < size; i++)
+        c_verify[i] -= c_test[i];
+
+    return BLASFUNC(dnrm2)(&size, c_verify, &(blasint){1});
+}
+
+CTEST(gemm_batch_strided, zgemm_conj_members)
+{
+    double norm = check_zgemm_batch_strided(CblasConjTrans, CblasConjNoTrans, 21, 17, 19,
+                                            21 * 19, 19 * 17, 23);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+CTEST(gemm_batch_strided, zgemm_shared_a)
+{
+    double norm = check_zgemm_batch_strided(CblasNoTrans, CblasNoTrans, 40, 12, 30,
+                                            0, 30 * 12, 10);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+#endif
+#endif
@@ -0,0 +1,218 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 1000000
+#define MAX_RHS 8
+
+#if !defined(NO_CBLAS)
+#ifdef BUILD_DOUBLE
+static double a_test[DATASIZE];
+static double b_test[DATASIZE];
+static double c_test[DATASIZE];
+static double c_verify[DATASIZE];
+
+/**
+ * Compare cblas_dgemm_multi_rhs on the given number of threads against one
+ * cblas_dgemm call per right-hand side. Member j uses its own slices of
+ * b_test and c_test with ldb and ldc padded by j. The reference calls
+ * may split k over threads, so the results are compared element by element.
+ *
+ * return largest difference
+ */
+static double check_dgemm_multi_rhs(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                                    enum CBLAS_TRANSPOSE transb, blasint m, blasint k,
+                                    blasint nrhs, blasint *n, double alpha, double beta,
+                                    int threads)
+{
+    int nthreads = openblas_get_num_threads();
+    double *b[MAX_RHS], *c[MAX_RHS], diff = 0.0;
+    blasint ldb[MAX_RHS], ldc[MAX_RHS];
+    blasint j, lda, size_b = 0, size_c = 0;
+    blasint col_major = (order == CblasColMajor);
+
+    lda = ((transa == CblasNoTrans) == col_major) ? m + 3 : k + 3;
+
+    for (j = 0; j < nrhs; j++) {
+        ldb[j] = ((transb == CblasNoTrans) == col_major) ? k + j : n[j] + j;
+        ldc[j] = col_major ? m + j : n[j] + j;
+        if (ldb[j] < 1) ldb[j] = 1;
+        if (ldc[j] < 1) ldc[j] = 1;
+        b[j] = b_test + size_b;
+        c[j] = c_test + size_c;
+        size_b += ldb[j] * (((transb == CblasNoTrans) == col_major) ? n[j] : k);
+        size_c += ldc[j] * (col_major ? n[j] : m);
+    }
+
+    drand_generate(a_test, DATASIZE);
+    drand_generate(b_test, size_b);
+    drand_generate(c_test, size_c);
+    memcpy(c_verify, c_test, sizeof(double) * size_c);
+
+    for (j = 0; j < nrhs; j++)
+        cblas_dgemm(order, transa, transb, m, n[j], k, alpha, a_test, lda,
+                    b[j], ldb[j], beta, c_verify + (c[j] - c_test), ldc[j]);
+
+    openblas_set_num_threads(threads);
+    cblas_dgemm_multi_rhs(order, transa, transb, m, k, alpha, a_test, lda,
+                          nrhs, n, (const double **)b, ldb, beta, c, ldc);
+    openblas_set_num_threads(nthreads);
+
+    for (j = 0; j < size_c; j++)
+        diff = MAX(diff, fabs(c_verify[j] - c_test[j]));
+
+    return diff;
+}
+
+/**
+ * Column major, members narrower than the kernel's register block and an
+ * empty one, with more rows than one block of A
+ */
+CTEST(gemm_multi_rhs, dgemm_colmajor_nn)
+{
+    blasint n[6] = {7, 33, 0, 1, 64, 19};
+    double diff = check_dgemm_multi_rhs(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                                        1100, 150, 6, n, 1.5, -0.5, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * Column major with transposed operands on one thread
+ */
+CTEST(gemm_multi_rhs, dgemm_colmajor_tt_serial)
+{
+    blasint n[4] = {50, 3, 81, 12};
+    double diff = check_dgemm_multi_rhs(CblasColMajor, CblasTrans, CblasTrans,
+                                        700, 120, 4, n, -1.0, 2.0, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * Row major: the members become blocks of rows for the driver and the
+ * shared A is the operand packed once
+ */
+CTEST(gemm_multi_rhs, dgemm_rowmajor_nt)
+{
+    blasint n[5] = {300, 5, 129, 0, 260};
+    double diff = check_dgemm_multi_rhs(CblasRowMajor, CblasNoTrans, CblasTrans,
+                                        90, 140, 5, n, 0.75, 1.0, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * Row major on one thread, with blocks of A that have to end at the
+ * member boundaries
+ */
+CTEST(gemm_multi_rhs, dgemm_rowmajor_tn_serial)
+{
+    blasint n[3] = {530, 610, 17};
+    double diff = check_dgemm_multi_rhs(CblasRowMajor, CblasTrans, CblasNoTrans,
+                                        40, 100, 3, n, 1.0, 0.0, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * Without a product only C_j = beta * C_j is left
+ */
+CTEST(gemm_multi_rhs, dgemm_k_zero)
+{
+    blasint n[3] = {10, 20, 30};
+    double diff = check_dgemm_multi_rhs(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                                        50, 0, 3, n, 1.0, 3.0, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info for a leading dimension of B_j that is too small
+ */
+CTEST(gemm_multi_rhs, xerbla_ldb)
+{
+    blasint n[2] = {10, 10}, ldb[2] = {20, 5}, ldc[2] = {20, 20};
+    double *b[2] = {b_test, b_test}, *c[2] = {c_test, c_test};
+
+    set_xerbla("DGEMM_MULTI_RHS ", 11);
+    cblas_dgemm_multi_rhs(CblasColMajor, CblasNoTrans, CblasNoTrans, 20, 10, 1.0,
+                          a_test, 20, 2, n, (const double **)b, ldb, 0.0, c, ldc);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+#endif
+
+#ifdef BUILD_SINGLE
+static float sa_test[60 * 300];
+static float sb_test[3 * 60 * 70];
+static float sc_test[3 * 300 * 70];
+static float sc_verify[3 * 300 * 70];
+
+/**
+ * Single precision, column major, transposed A
+ */
+CTEST(gemm_multi_rhs, sgemm_colmajor_tn)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint n[3] = {40, 9, 70}, ldb[3] = {60, 60, 60}, ldc[3] = {300, 300, 300};
+    float *a = sa_test, *bb = sb_test, *cc = sc_test, *cv = sc_verify;
+    float *b[3], *c[3];
+    blasint j, size = 3 * 300 * 70;
+
+    srand_generate(a, 60 * 300);
+    srand_generate(bb, 3 * 60 * 70);
+    srand_generate(cc, size);
+    memcpy(cv, cc, sizeof(float) * size);
+
+    for (j = 0; j < 3; j++) {
+        b[j] = bb + j * 60 * 70;
+        c[j] = cc + j * 300 * 70;
+        cblas_sgemm(CblasColMajor, CblasTrans, CblasNoTrans, 300, n[j], 60, 2.0f,
+                    a, 60, b[j], ldb[j], 0.5f, cv + j * 300 * 70, ldc[j]);
+    }
+
+    openblas_set_num_threads(4);
+    cblas_sgemm_multi_rhs(CblasColMajor, CblasTrans, CblasNoTrans, 300, 60, 2.0f, a, 60,
+                          3, n, (const float **)b, ldb, 0.5f, c, ldc);
+    openblas_set_num_threads(nthreads);
+
+    for (j = 0; j < size; j++)
+        ASSERT_DBL_NEAR_TOL(cv[j], cc[j], SINGLE_EPS);
+}
+#endif
+#endif
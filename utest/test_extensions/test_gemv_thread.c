@@ -0,0 +1,205 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+/**
+ * Largest difference between x and y relative to the largest element of y
+ */
+static double relative_difference(double *x, double *y, blasint n)
+{
+    blasint i;
+    double d = 0.0, ymax = 1.0;
+
+    for (i = 0; i < n; i++) {
+        d = MAX(d, fabs(x[i] - y[i]));
+        ymax = MAX(ymax, fabs(y[i]));
+    }
+
+    return d / ymax;
+}
+
+#ifdef BUILD_DOUBLE
+/**
+ * dgemv on four threads against one thread
+ *
+ * return largest relative difference of the results
+ */
+static double check_dgemv(char trans, blasint m, blasint n, blasint incx, blasint incy)
+{
+    int nthreads = openblas_get_num_threads();
+    double alpha = 1.25, beta = 0.5, diff;
+    blasint lda = m + 3;
+    blasint lenx = (trans == 'N') ? n : m, leny = (trans == 'N') ? m : n;
+    blasint sizey = leny * abs(incy);
+    double *a = malloc(sizeof(double) * lda * n);
+    double *x = malloc(sizeof(double) * lenx * abs(incx));
+    double *y = malloc(sizeof(double) * sizey);
+    double *y_verify = malloc(sizeof(double) * sizey);
+
+    drand_generate(a, lda * n);
+    drand_generate(x, lenx * abs(incx));
+    drand_generate(y, sizey);
+    memcpy(y_verify, y, sizeof(double) * sizey);
+
+    openblas_set_num_threads(1);
+    BLASFUNC(dgemv)(&trans, &m, &n, &alpha, a, &lda, x, &incx, &beta, y_verify, &incy);
+
+    openblas_set_num_threads(4);
+    BLASFUNC(dgemv)(&trans, &m, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+    openblas_set_num_threads(nthreads);
+
+    diff = relative_difference(y, y_verify, sizey);
+
+    free(a);
+    free(x);
+    free(y);
+    free(y_verify);
+
+    return diff;
+}
+
+/**
+ * Square matrix, split over the rows only
+ */
+CTEST(gemv_thread, dgemv_n_square)
+{
+    double diff = check_dgemv('N', 1500, 1500, 1, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * Wide, short matrix, split over the columns with a reduction of partial y
+ */
+CTEST(gemv_thread, dgemv_n_wide)
+{
+    double diff = check_dgemv('N', 37, 40000, 2, -1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * Tall, narrow matrix, split over the rows with a reduction of partial y
+ */
+CTEST(gemv_thread, dgemv_t_tall)
+{
+    double diff = check_dgemv('T', 200000, 6, 1, 3);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * Transposed matrix split in both dimensions
+ */
+CTEST(gemv_thread, dgemv_t_grid)
+{
+    double diff = check_dgemv('T', 120000, 9, -2, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+#endif
+
+#ifdef BUILD_COMPLEX
+/**
+ * cgemv on four threads against one thread
+ *
+ * return largest relative difference of the results
+ */
+static double check_cgemv(char trans, blasint m, blasint n)
+{
+    int nthreads = openblas_get_num_threads();
+    float alpha[] = {1.25f, -0.5f}, beta[] = {0.5f, 0.25f};
+    blasint i, lda = m, inc = 1;
+    blasint lenx = (trans == 'N' || trans == 'R') ? n : m, leny = (trans == 'N' || trans == 'R') ? m : n;
+    float *a = malloc(sizeof(float) * lda * n * 2);
+    float *x = malloc(sizeof(float) * lenx * 2);
+    float *y = malloc(sizeof(float) * leny * 2);
+    float *y_verify = malloc(sizeof(float) * leny * 2);
+    double *y_d = malloc(sizeof(double) * leny * 2);
+    double *y_verify_d = malloc(sizeof(double) * leny * 2);
+    double diff;
+
+    srand_generate(a, lda * n * 2);
+    srand_generate(x, lenx * 2);
+    srand_generate(y, leny * 2);
+    memcpy(y_verify, y, sizeof(float) * leny * 2);
+
+    openblas_set_num_threads(1);
+    BLASFUNC(cgemv)(&trans, &m, &n, alpha, a, &lda, x, &inc, beta, y_verify, &inc);
+
+    openblas_set_num_threads(4);
+    BLASFUNC(cgemv)(&trans, &m, &n, alpha, a, &lda, x, &inc, beta, y, &inc);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < leny * 2; i++) {
+        y_d[i] = y[i];
+        y_verify_d[i] = y_verify[i];
+    }
+    diff = relative_difference(y_d, y_verify_d, leny * 2);
+
+    free(a);
+    free(x);
+    free(y);
+    free(y_verify);
+    free(y_d);
+    free(y_verify_d);
+
+    return diff;
+}
+
+/**
+ * Wide, short matrix with conjugated A
+ */
+CTEST(gemv_thread, cgemv_r_wide)
+{
+    double diff = check_cgemv('R', 20, 30000);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, 1e-4);
+}
+
+/**
+ * Tall, narrow matrix, conjugate transposed
+ */
+CTEST(gemv_thread, cgemv_c_tall)
+{
+    double diff = check_cgemv('C', 30000, 3);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, 1e-4);
+}
+#endif
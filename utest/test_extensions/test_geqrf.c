@@ -0,0 +1,274 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#if !defined(NO_CBLAS)
+#ifdef BUILD_DOUBLE
+
+/**
+ * Factor a random m x n matrix with dgeqrf on the given number of
+ * threads, form Q with dorgqr and compare Q * R with the matrix.
+ * A work array shorter than the optimal one makes the routines
+ * allocate their own.
+ *
+ * return largest of |Q * R - A| and |Q' * Q - I|
+ */
+static double check_dgeqrf(blasint m, blasint n, blasint lda, int threads, int short_work)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint mn = MIN(m, n), lwork = -1, info;
+    blasint i, j;
+    double *a, *qr, *r, *qtq, *tau, *work, query, diff = 0.0;
+
+    a   = (double *)malloc(sizeof(double) * lda * n);
+    qr  = (double *)malloc(sizeof(double) * lda * n);
+    r   = (double *)calloc((size_t)mn * n, sizeof(double));
+    qtq = (double *)malloc(sizeof(double) * mn * mn);
+    tau = (double *)malloc(sizeof(double) * mn);
+
+    drand_generate(a, lda * n);
+    for (i = 0; i < lda * n; i++) qr[i] = a[i];
+
+    BLASFUNC(dgeqrf)(&m, &n, qr, &lda, tau, &query, &lwork, &info);
+    lwork = short_work ? MAX(1, n) : (blasint)query;
+    work  = (double *)malloc(sizeof(double) * lwork);
+
+    openblas_set_num_threads(threads);
+    BLASFUNC(dgeqrf)(&m, &n, qr, &lda, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i <= MIN(j, mn - 1); i++) r[i + j * mn] = qr[i + j * lda];
+
+    BLASFUNC(dorgqr)(&m, &mn, &mn, qr, &lda, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+    openblas_set_num_threads(nthreads);
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, mn,
+                -1.0, qr, lda, r, mn, 1.0, a, lda);
+    for (j = 0; j < n; j++)
+        for (i = 0; i < m; i++)
+            diff = MAX(diff, fabs(a[i + j * lda]));
+
+    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, mn, mn, m,
+                1.0, qr, lda, qr, lda, 0.0, qtq, mn);
+    for (j = 0; j < mn; j++)
+        for (i = 0; i < mn; i++)
+            diff = MAX(diff, fabs(qtq[i + j * mn] - (i == j ? 1.0 : 0.0)));
+
+    free(a); free(qr); free(r); free(qtq); free(tau); free(work);
+
+    return diff;
+}
+
+/**
+ * Apply Q or Q' from dgeqrf of a random nq x k matrix to a random
+ * m x n matrix C with dormqr, and compare with a product by the
+ * explicit Q from dorgqr.
+ *
+ * return largest difference between the two results
+ */
+static double check_dormqr(char side, char trans, blasint m, blasint n, blasint k, int threads)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint nq = (side == 'L') ? m : n;
+    blasint lwork, info;
+    blasint i;
+    double *a, *q, *c, *cq, *tau, *work, diff = 0.0;
+
+    a   = (double *)malloc(sizeof(double) * nq * k);
+    q   = (double *)malloc(sizeof(double) * nq * nq);
+    c   = (double *)malloc(sizeof(double) * m * n);
+    cq  = (double *)malloc(sizeof(double) * m * n);
+    tau = (double *)malloc(sizeof(double) * k);
+
+    lwork = 64 * (64 + MAX(m, n) + nq);
+    work  = (double *)malloc(sizeof(double) * lwork);
+
+    drand_generate(a, nq * k);
+    drand_generate(c, m * n);
+
+    BLASFUNC(dgeqrf)(&nq, &k, a, &nq, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+
+    for (i = 0; i < nq * k; i++) q[i] = a[i];
+    BLASFUNC(dorgqr)(&nq, &nq, &k, q, &nq, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+
+    if (side == 'L')
+        cblas_dgemm(CblasColMajor, (trans == 'N') ? CblasNoTrans : CblasTrans, CblasNoTrans,
+                    m, n, m, 1.0, q, m, c, m, 0.0, cq, m);
+    else
+        cblas_dgemm(CblasColMajor, CblasNoTrans, (trans == 'N') ? CblasNoTrans : CblasTrans,
+                    m, n, n, 1.0, c, m, q, n, 0.0, cq, m);
+
+    openblas_set_num_threads(threads);
+    BLASFUNC(dormqr)(&side, &trans, &m, &n, &k, a, &nq, tau, c, &m, work, &lwork, &info);
+    openblas_set_num_threads(nthreads);
+    ASSERT_EQUAL(0, info);
+
+    for (i = 0; i < m * n; i++)
+        diff = MAX(diff, fabs(c[i] - cq[i]));
+
+    free(a); free(q); free(c); free(cq); free(tau); free(work);
+
+    return diff;
+}
+
+/**
+ * Square matrix, several panels
+ */
+CTEST(geqrf, dgeqrf_square)
+{
+    double diff = check_dgeqrf(400, 400, 400, 4, 0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * More rows than columns, with padded lda and a partial last panel
+ */
+CTEST(geqrf, dgeqrf_tall)
+{
+    double diff = check_dgeqrf(700, 300, 703, 4, 0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * More columns than rows
+ */
+CTEST(geqrf, dgeqrf_wide)
+{
+    double diff = check_dgeqrf(250, 530, 250, 3, 0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * Small matrix on one thread with the minimal work array
+ */
+CTEST(geqrf, dgeqrf_small)
+{
+    double diff = check_dgeqrf(7, 5, 9, 1, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * Minimal work array on the threaded path
+ */
+CTEST(geqrf, dgeqrf_short_work)
+{
+    double diff = check_dgeqrf(500, 300, 500, 4, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+CTEST(geqrf, dormqr_left_notrans)
+{
+    double diff = check_dormqr('L', 'N', 300, 350, 200, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+CTEST(geqrf, dormqr_left_trans)
+{
+    double diff = check_dormqr('L', 'T', 300, 350, 200, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+CTEST(geqrf, dormqr_right_notrans)
+{
+    double diff = check_dormqr('R', 'N', 330, 270, 150, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+CTEST(geqrf, dormqr_right_trans)
+{
+    double diff = check_dormqr('R', 'T', 330, 270, 150, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+#endif
+
+#ifdef BUILD_SINGLE
+
+/**
+ * Single precision factorization, checked by |Q * R - A|
+ */
+CTEST(geqrf, sgeqrf_tall)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint m = 520, n = 300, lwork, info;
+    blasint i, j;
+    float *a, *qr, *r, *tau, *work, diff = 0.0f;
+
+    lwork = 64 * (64 + n);
+    a    = (float *)malloc(sizeof(float) * m * n);
+    qr   = (float *)malloc(sizeof(float) * m * n);
+    r    = (float *)calloc((size_t)n * n, sizeof(float));
+    tau  = (float *)malloc(sizeof(float) * n);
+    work = (float *)malloc(sizeof(float) * lwork);
+
+    srand_generate(a, m * n);
+    for (i = 0; i < m * n; i++) qr[i] = a[i];
+
+    openblas_set_num_threads(4);
+    BLASFUNC(sgeqrf)(&m, &n, qr, &m, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i <= j; i++) r[i + j * n] = qr[i + j * m];
+
+    BLASFUNC(sorgqr)(&m, &n, &n, qr, &m, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+    openblas_set_num_threads(nthreads);
+
+    cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, n,
+                -1.0f, qr, m, r, n, 1.0f, a, m);
+    for (i = 0; i < m * n; i++)
+        diff = MAX(diff, fabsf(a[i]));
+
+    free(a); free(qr); free(r); free(tau); free(work);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, diff, SINGLE_TOL);
+}
+#endif
+#endif
@@ -0,0 +1,214 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#if !defined(NO_CBLAS)
+#ifdef BUILD_DOUBLE
+
+/**
+ * Factor a random m x n matrix on the given number of threads, with
+ * column sing zeroed if it is not negative, and rebuild P * L * U.
+ * The sizes are above the threshold of the task graph scheduler.
+ *
+ * return largest difference between P * L * U and the matrix
+ */
+static double check_dgetrf(blasint m, blasint n, blasint lda, blasint sing,
+                           int threads, blasint *info)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint mn = MIN(m, n), one = 1, minus_one = -1;
+    blasint i, j;
+    double *a, *lu, *l, *u, *r, diff = 0.0;
+    blasint *ipiv;
+
+    a    = (double *)malloc(sizeof(double) * lda * n);
+    lu   = (double *)malloc(sizeof(double) * lda * n);
+    l    = (double *)calloc((size_t)m * mn, sizeof(double));
+    u    = (double *)calloc((size_t)mn * n, sizeof(double));
+    r    = (double *)malloc(sizeof(double) * m * n);
+    ipiv = (blasint *)malloc(sizeof(blasint) * mn);
+
+    drand_generate(a, lda * n);
+    if (sing >= 0)
+        for (i = 0; i < m; i++) a[i + sing * lda] = 0.0;
+    for (i = 0; i < lda * n; i++) lu[i] = a[i];
+
+    openblas_set_num_threads(threads);
+    BLASFUNC(dgetrf)(&m, &n, lu, &lda, ipiv, info);
+    openblas_set_num_threads(nthreads);
+
+    for (j = 0; j < mn; j++) {
+        l[j + j * m] = 1.0;
+        for (i = j + 1; i < m; i++) l[i + j * m] = lu[i + j * lda];
+    }
+    for (j = 0; j < n; j++)
+        for (i = 0; i <= MIN(j, mn - 1); i++) u[i + j * mn] = lu[i + j * lda];
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, mn,
+                1.0, l, m, u, mn, 0.0, r, m);
+    BLASFUNC(dlaswp)(&n, r, &m, &one, &mn, ipiv, &minus_one);
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i < m; i++)
+            diff = MAX(diff, fabs(r[i + j * m] - a[i + j * lda]));
+
+    free(a); free(lu); free(l); free(u); free(r); free(ipiv);
+
+    return diff;
+}
+
+/**
+ * Square matrix
+ */
+CTEST(getrf_thread, dgetrf_square)
+{
+    blasint info;
+    double diff = check_dgetrf(1100, 1100, 1100, -1, 4, &info);
+
+    ASSERT_EQUAL(0, info);
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * More rows than columns, with padded lda
+ */
+CTEST(getrf_thread, dgetrf_tall)
+{
+    blasint info;
+    double diff = check_dgetrf(1500, 1100, 1503, -1, 4, &info);
+
+    ASSERT_EQUAL(0, info);
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * More columns than rows, so that blocks right of the last panel
+ * only receive updates
+ */
+CTEST(getrf_thread, dgetrf_wide)
+{
+    blasint info;
+    double diff = check_dgetrf(1100, 1700, 1100, -1, 3, &info);
+
+    ASSERT_EQUAL(0, info);
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * A zero column inside a later panel is reported in info
+ */
+CTEST(getrf_thread, dgetrf_singular)
+{
+    blasint info;
+    double diff = check_dgetrf(1100, 1100, 1100, 700, 4, &info);
+
+    ASSERT_EQUAL(701, info);
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+
+/**
+ * Complex version of check_dgetrf, without the zero column
+ *
+ * return largest difference between P * L * U and the matrix
+ */
+static double check_zgetrf(blasint m, blasint n, blasint lda, int threads, blasint *info)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint mn = MIN(m, n), one = 1, minus_one = -1;
+    blasint i, j;
+    double *a, *lu, *l, *u, *r, diff = 0.0;
+    double alpha[2] = {1.0, 0.0}, beta[2] = {0.0, 0.0};
+    blasint *ipiv;
+
+    a    = (double *)malloc(sizeof(double) * 2 * lda * n);
+    lu   = (double *)malloc(sizeof(double) * 2 * lda * n);
+    l    = (double *)calloc((size_t)2 * m * mn, sizeof(double));
+    u    = (double *)calloc((size_t)2 * mn * n, sizeof(double));
+    r    = (double *)malloc(sizeof(double) * 2 * m * n);
+    ipiv = (blasint *)malloc(sizeof(blasint) * mn);
+
+    drand_generate(a, 2 * lda * n);
+    for (i = 0; i < 2 * lda * n; i++) lu[i] = a[i];
+
+    openblas_set_num_threads(threads);
+    BLASFUNC(zgetrf)(&m, &n, lu, &lda, ipiv, info);
+    openblas_set_num_threads(nthreads);
+
+    for (j = 0; j < mn; j++) {
+        l[2 * (j + j * m)] = 1.0;
+        for (i = j + 1; i < m; i++) {
+            l[2 * (i + j * m)]     = lu[2 * (i + j * lda)];
+            l[2 * (i + j * m) + 1] = lu[2 * (i + j * lda) + 1];
+        }
+    }
+    for (j = 0; j < n; j++)
+        for (i = 0; i <= MIN(j, mn - 1); i++) {
+            u[2 * (i + j * mn)]     = lu[2 * (i + j * lda)];
+            u[2 * (i + j * mn) + 1] = lu[2 * (i + j * lda) + 1];
+        }
+
+    cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, mn,
+                alpha, l, m, u, mn, beta, r, m);
+    BLASFUNC(zlaswp)(&n, r, &m, &one, &mn, ipiv, &minus_one);
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i < m; i++) {
+            diff = MAX(diff, fabs(r[2 * (i + j * m)] - a[2 * (i + j * lda)]));
+            diff = MAX(diff, fabs(r[2 * (i + j * m) + 1] - a[2 * (i + j * lda) + 1]));
+        }
+
+    free(a); free(lu); free(l); free(u); free(r); free(ipiv);
+
+    return diff;
+}
+
+/**
+ * Complex matrix with more rows than columns
+ */
+CTEST(getrf_thread, zgetrf_tall)
+{
+    blasint info;
+    double diff = check_zgetrf(1040, 1030, 1043, 4, &info);
+
+    ASSERT_EQUAL(0, info);
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+#endif
+#endif
@@ -0,0 +1,153 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+/* Enough to exhaust the free buffers left behind by other tests */
+#define MAX_HELD (4 * NUM_BUFFERS)
+
+static size_t total_buffers(size_t *counts)
+{
+    int i;
+    size_t total = 0;
+
+    for (i = 0; i <= OPENBLAS_HUGEPAGES_1G; i++) total += counts[i];
+
+    return total;
+}
+
+/**
+ * Take buffers from the memory pool until one of them had to be
+ * newly mapped, and return it after touching both of its ends.
+ * The buffers taken before are returned to the pool.
+ */
+static void *map_new_buffer(size_t *before, size_t *after)
+{
+    static void *held[MAX_HELD];
+    char *buffer = NULL;
+    int i, n;
+
+    openblas_get_hugepage_stats(before);
+
+    for (n = 0; n < MAX_HELD; n++) {
+        held[n] = blas_memory_alloc(1);
+        openblas_get_hugepage_stats(after);
+        if (total_buffers(after) != total_buffers(before)) {
+            buffer = (char *)held[n];
+            break;
+        }
+    }
+
+    for (i = 0; i < n; i++) blas_memory_free(held[i]);
+
+    if (buffer != NULL) {
+        buffer[0] = 1;
+        buffer[BUFFER_SIZE - 1] = 1;
+    }
+
+    return buffer;
+}
+
+/**
+ * Test switching the backend and rejecting unknown ones
+ */
+CTEST(hugepage, set_and_get)
+{
+    int old = openblas_get_hugepages();
+
+    ASSERT_EQUAL(old, openblas_set_hugepages(OPENBLAS_HUGEPAGES_THP));
+    ASSERT_EQUAL(OPENBLAS_HUGEPAGES_THP, openblas_get_hugepages());
+
+    ASSERT_EQUAL(-1, openblas_set_hugepages(OPENBLAS_HUGEPAGES_1G + 1));
+    ASSERT_EQUAL(-1, openblas_set_hugepages(-1));
+    ASSERT_EQUAL(OPENBLAS_HUGEPAGES_THP, openblas_get_hugepages());
+
+    ASSERT_EQUAL(OPENBLAS_HUGEPAGES_THP, openblas_set_hugepages(old));
+}
+
+/**
+ * Test that a buffer mapped without huge pages is counted as such
+ */
+CTEST(hugepage, regular_pages)
+{
+    size_t before[OPENBLAS_HUGEPAGES_1G + 1], after[OPENBLAS_HUGEPAGES_1G + 1];
+    int old = openblas_set_hugepages(OPENBLAS_HUGEPAGES_NONE);
+    void *buffer = map_new_buffer(before, after);
+
+    ASSERT_NOT_NULL(buffer);
+    ASSERT_EQUAL(before[OPENBLAS_HUGEPAGES_NONE] + 1, after[OPENBLAS_HUGEPAGES_NONE]);
+
+    blas_memory_free(buffer);
+    openblas_set_hugepages(old);
+}
+
+/**
+ * Test that a transparent huge page buffer is either mapped as one
+ * or falls back to regular pages
+ */
+CTEST(hugepage, transparent)
+{
+    size_t before[OPENBLAS_HUGEPAGES_1G + 1], after[OPENBLAS_HUGEPAGES_1G + 1];
+    int old = openblas_set_hugepages(OPENBLAS_HUGEPAGES_THP);
+    void *buffer = map_new_buffer(before, after);
+
+    ASSERT_NOT_NULL(buffer);
+    ASSERT_EQUAL(total_buffers(before) + 1, total_buffers(after));
+    ASSERT_EQUAL(before[OPENBLAS_HUGEPAGES_2M], after[OPENBLAS_HUGEPAGES_2M]);
+    ASSERT_EQUAL(before[OPENBLAS_HUGEPAGES_1G], after[OPENBLAS_HUGEPAGES_1G]);
+#if defined(OS_LINUX)
+    if (after[OPENBLAS_HUGEPAGES_THP] != before[OPENBLAS_HUGEPAGES_THP])
+        ASSERT_EQUAL(0, (BLASULONG)buffer & ((2UL << 20) - 1));
+#endif
+
+    blas_memory_free(buffer);
+    openblas_set_hugepages(old);
+}
+
+/**
+ * Test that 1GB pages fall back to a smaller page size when the
+ * system has none reserved, and that the buffer is still usable
+ */
+CTEST(hugepage, fallback)
+{
+    size_t before[OPENBLAS_HUGEPAGES_1G + 1], after[OPENBLAS_HUGEPAGES_1G + 1];
+    int old = openblas_set_hugepages(OPENBLAS_HUGEPAGES_1G);
+    void *buffer = map_new_buffer(before, after);
+
+    ASSERT_NOT_NULL(buffer);
+    ASSERT_EQUAL(total_buffers(before) + 1, total_buffers(after));
+
+    blas_memory_free(buffer);
+    openblas_set_hugepages(old);
+}
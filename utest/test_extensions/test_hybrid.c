@@ -0,0 +1,223 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define LONG_SIDE  2000
+#define SHORT_SIDE 40
+
+#ifdef BUILD_DOUBLE
+#if defined(SMP_SERVER) && !defined(USE_OPENMP) && !defined(OS_WINDOWS)
+static double a_test[LONG_SIDE * LONG_SIDE / 4];
+static double b_test[LONG_SIDE * LONG_SIDE / 4];
+static double c_test[LONG_SIDE * LONG_SIDE / 4];
+static double c_verify[LONG_SIDE * LONG_SIDE / 4];
+
+/**
+ * Give three threads and the caller (index 3) unequal capacities, or
+ * reset them
+ */
+static void set_capacities(int weighted)
+{
+    int i;
+
+    if (weighted) {
+        ASSERT_EQUAL(0, openblas_set_thread_capacity(0, 1024));
+        ASSERT_EQUAL(0, openblas_set_thread_capacity(1, 410));
+        ASSERT_EQUAL(0, openblas_set_thread_capacity(2, 200));
+        ASSERT_EQUAL(0, openblas_set_thread_capacity(3, 700));
+    } else {
+        for (i = 0; i < 4; i++) openblas_set_thread_capacity(i, 0);
+    }
+}
+
+/**
+ * Builds for fewer than four threads have no four capacities to set
+ */
+static int four_threads(void)
+{
+    int nthreads = openblas_get_num_threads();
+    int ret;
+
+    openblas_set_num_threads(4);
+    ret = (openblas_get_num_threads() >= 4);
+    openblas_set_num_threads(nthreads);
+
+    return ret;
+}
+
+/**
+ * Run a call with one thread and with four threads of unequal capacity
+ * and compare
+ */
+static void check_weighted(void (*call)(double *), blasint size)
+{
+    if (!four_threads()) return;
+
+    drand_generate(a_test, LONG_SIDE * LONG_SIDE / 4);
+    drand_generate(b_test, LONG_SIDE * LONG_SIDE / 4);
+    memset(c_verify, 0, sizeof(double) * size);
+
+    ASSERT_DBL_NEAR_TOL(0.0, dthreads_difference(call, set_capacities, 1, 4, c_verify, c_test, size), 1e-10);
+}
+
+static void gemm_tall(double *c)
+{
+    blasint m = LONG_SIDE, n = SHORT_SIDE, k = LONG_SIDE / 8;
+    double alpha = 1.0, beta = 0.0;
+
+    BLASFUNC(dgemm)("N", "N", &m, &n, &k, &alpha, a_test, &m, b_test, &k, &beta, c, &m);
+}
+
+static void gemm_square(double *c)
+{
+    blasint n = LONG_SIDE / 2;
+    double alpha = 1.0, beta = 0.0;
+
+    BLASFUNC(dgemm)("N", "T", &n, &n, &n, &alpha, a_test, &n, b_test, &n, &beta, c, &n);
+}
+
+static void gemv_tall(double *c)
+{
+    blasint m = LONG_SIDE, n = LONG_SIDE / 8, inc = 1;
+    double alpha = 1.0, beta = 0.0;
+
+    BLASFUNC(dgemv)("N", &m, &n, &alpha, a_test, &m, b_test, &inc, &beta, c, &inc);
+}
+
+/**
+ * Test setting, reading back and resetting the capacity of a thread
+ */
+CTEST(hybrid, set_and_get)
+{
+    int nthreads = openblas_get_num_threads();
+
+    openblas_set_num_threads(2);
+
+    ASSERT_EQUAL(0, openblas_set_thread_capacity(0, 300));
+    ASSERT_EQUAL(300, openblas_get_thread_capacity(0));
+    ASSERT_EQUAL(0, openblas_set_thread_capacity(1, 5000));
+    ASSERT_EQUAL(1024, openblas_get_thread_capacity(1));
+
+    ASSERT_EQUAL(0, openblas_set_thread_capacity(0, 0));
+    ASSERT_EQUAL(0, openblas_set_thread_capacity(1, 0));
+    ASSERT_TRUE(openblas_get_thread_capacity(0) > 0);
+    ASSERT_TRUE(openblas_get_thread_capacity(1) > 0);
+
+    ASSERT_EQUAL(-1, openblas_set_thread_capacity(2, 100));
+    ASSERT_EQUAL(-1, openblas_set_thread_capacity(0, -1));
+
+    openblas_set_num_threads(nthreads);
+}
+
+/**
+ * Test that resetting every capacity to 0 stops the weighting on cores
+ * of one kind
+ */
+CTEST(hybrid, reset_unweighted)
+{
+    int nthreads = openblas_get_num_threads();
+    int capacity[2];
+
+    openblas_set_num_threads(2);
+
+    ASSERT_EQUAL(0, openblas_set_thread_capacity(0, 300));
+    ASSERT_EQUAL(1, blas_thread_capacities(2, capacity));
+    ASSERT_EQUAL(0, openblas_set_thread_capacity(0, 0));
+    if (!blas_hybrid_cores())
+        ASSERT_EQUAL(0, blas_thread_capacities(2, capacity));
+
+    openblas_set_num_threads(nthreads);
+}
+
+/**
+ * Test the capacities the jobs of a call are weighted with: the caller's,
+ * set through the last index, for its own job, then the threads' from the
+ * fastest down
+ */
+CTEST(hybrid, capacity_shares)
+{
+    int nthreads = openblas_get_num_threads();
+    int capacity[4];
+
+    if (!four_threads()) return;
+
+    openblas_set_num_threads(4);
+    set_capacities(1);
+
+    ASSERT_EQUAL(1, blas_thread_capacities(4, capacity));
+    ASSERT_EQUAL(700, capacity[0]);
+    ASSERT_EQUAL(1024, capacity[1]);
+    ASSERT_EQUAL(410, capacity[2]);
+    ASSERT_EQUAL(200, capacity[3]);
+
+    set_capacities(0);
+    openblas_set_num_threads(nthreads);
+}
+
+/**
+ * Tall C, split over m in proportion to the capacities
+ */
+CTEST(hybrid, dgemm_tall)
+{
+    check_weighted(gemm_tall, LONG_SIDE * SHORT_SIDE);
+}
+
+/**
+ * Square C, split over n between column groups
+ */
+CTEST(hybrid, dgemm_square)
+{
+    check_weighted(gemm_square, LONG_SIDE * LONG_SIDE / 4);
+}
+
+/**
+ * Long y, split over y in proportion to the capacities
+ */
+CTEST(hybrid, dgemv_tall)
+{
+    check_weighted(gemv_tall, LONG_SIDE);
+}
+#else
+/**
+ * Test that builds without the pthreads server have no capacities to set
+ */
+CTEST(hybrid, unavailable)
+{
+    ASSERT_EQUAL(-1, openblas_set_thread_capacity(0, 100));
+    ASSERT_EQUAL(1024, openblas_get_thread_capacity(0));
+}
+#endif
+#endif
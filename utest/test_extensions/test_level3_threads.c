@@ -0,0 +1,240 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define LONG_SIDE  3000
+#define SHORT_SIDE 7
+
+#ifdef BUILD_DOUBLE
+static double a_test[LONG_SIDE * LONG_SIDE / 4];
+static double b_test[LONG_SIDE * LONG_SIDE / 4];
+static double c_test[LONG_SIDE * LONG_SIDE / 4];
+static double c_verify[LONG_SIDE * LONG_SIDE / 4];
+
+/**
+ * Run a level 3 call with one thread and with four threads and compare
+ */
+static void check_threads(void (*call)(double *), blasint size)
+{
+    memset(c_verify, 0, sizeof(double) * size);
+    ASSERT_DBL_NEAR_TOL(0.0, dthreads_difference(call, NULL, 1, 4, c_verify, c_test, size), 1e-10);
+}
+
+static void gemm_tall(double *c)
+{
+    blasint m = LONG_SIDE, n = SHORT_SIDE, k = LONG_SIDE / 8;
+    double alpha = 1.0, beta = 0.0;
+
+    BLASFUNC(dgemm)("N", "N", &m, &n, &k, &alpha, a_test, &m, b_test, &k, &beta, c, &m);
+}
+
+static void gemm_wide(double *c)
+{
+    blasint m = SHORT_SIDE, n = LONG_SIDE, k = LONG_SIDE / 8;
+    double alpha = 1.0, beta = 0.0;
+
+    BLASFUNC(dgemm)("T", "N", &m, &n, &k, &alpha, a_test, &k, b_test, &k, &beta, c, &m);
+}
+
+static void gemm_deep(double *c)
+{
+    blasint m = SHORT_SIDE, n = SHORT_SIDE, k = LONG_SIDE * 50;
+    double alpha = 1.0, beta = 0.0;
+
+    BLASFUNC(dgemm)("N", "N", &m, &n, &k, &alpha, a_test, &m, b_test, &k, &beta, c, &m);
+}
+
+#ifdef BUILD_COMPLEX16
+static void zgemm_deep(double *c)
+{
+    blasint m = SHORT_SIDE, n = SHORT_SIDE, k = LONG_SIDE * 20;
+    double alpha[2] = {1.0, -0.5}, beta[2] = {0.0, 0.0};
+
+    BLASFUNC(zgemm)("C", "N", &m, &n, &k, alpha, a_test, &k, b_test, &k, beta, c, &m);
+}
+#endif
+
+static void syrk_thin(double *c)
+{
+    blasint n = LONG_SIDE / 4, k = SHORT_SIDE;
+    double alpha = 1.0, beta = 0.0;
+
+    BLASFUNC(dsyrk)("U", "N", &n, &k, &alpha, a_test, &n, &beta, c, &n);
+}
+
+static void trsm_wide(double *c)
+{
+    blasint m = SHORT_SIDE * 8, n = LONG_SIDE, i;
+    double alpha = 1.0;
+
+    /* Well conditioned upper triangle */
+    for (i = 0; i < m; i++) a_test[i + i * m] = m;
+    memcpy(c, b_test, sizeof(double) * m * n);
+
+    BLASFUNC(dtrsm)("L", "U", "N", "N", &m, &n, &alpha, a_test, &m, c, &m);
+}
+
+/**
+ * Tall and skinny C, split over m only
+ */
+CTEST(level3_threads, dgemm_tall)
+{
+    drand_generate(a_test, LONG_SIDE * LONG_SIDE / 4);
+    drand_generate(b_test, LONG_SIDE * LONG_SIDE / 4);
+    check_threads(gemm_tall, LONG_SIDE * SHORT_SIDE);
+}
+
+/**
+ * Short and wide C, split over n only
+ */
+CTEST(level3_threads, dgemm_wide)
+{
+    drand_generate(a_test, LONG_SIDE * LONG_SIDE / 4);
+    drand_generate(b_test, LONG_SIDE * LONG_SIDE / 4);
+    check_threads(gemm_wide, LONG_SIDE * SHORT_SIDE);
+}
+
+/**
+ * Small C with a long inner dimension
+ */
+CTEST(level3_threads, dgemm_deep)
+{
+    drand_generate(a_test, LONG_SIDE * LONG_SIDE / 4);
+    drand_generate(b_test, LONG_SIDE * LONG_SIDE / 4);
+    check_threads(gemm_deep, SHORT_SIDE * SHORT_SIDE);
+}
+
+#ifdef BUILD_COMPLEX16
+/**
+ * Same for complex data with a conjugated operand
+ */
+CTEST(level3_threads, zgemm_deep)
+{
+    drand_generate(a_test, LONG_SIDE * LONG_SIDE / 4);
+    drand_generate(b_test, LONG_SIDE * LONG_SIDE / 4);
+    check_threads(zgemm_deep, 2 * SHORT_SIDE * SHORT_SIDE);
+}
+#endif
+
+/**
+ * Large C from a rank-SHORT_SIDE update, only the stored triangle is split
+ */
+CTEST(level3_threads, dsyrk_thin)
+{
+    drand_generate(a_test, LONG_SIDE * LONG_SIDE / 4);
+    check_threads(syrk_thin, LONG_SIDE / 4 * LONG_SIDE / 4);
+}
+
+/**
+ * Small triangle with many right hand sides, split over the columns of B
+ */
+CTEST(level3_threads, dtrsm_wide)
+{
+    drand_generate(a_test, LONG_SIDE * LONG_SIDE / 4);
+    drand_generate(b_test, LONG_SIDE * LONG_SIDE / 4);
+    check_threads(trsm_wide, SHORT_SIDE * 8 * LONG_SIDE);
+}
+
+#ifdef SMP
+/**
+ * Check the split the cost model picks for the shapes above, with the
+ * unroll and Q sizes of a typical double precision kernel
+ */
+CTEST(level3_threads, split_choice)
+{
+    BLASLONG tm, tn;
+    int n;
+
+    /* Tall C: all threads over m */
+    n = blas_level3_nthreads(LONG_SIDE, SHORT_SIDE, LONG_SIDE / 8, BLAS_L3_SPLIT_MN, 4,
+                             4, 8, 256, 1, &tm, &tn);
+    ASSERT_EQUAL(4, n);
+    ASSERT_EQUAL(4, tm);
+    ASSERT_EQUAL(1, tn);
+
+    /* Wide C: all threads over n */
+    n = blas_level3_nthreads(SHORT_SIDE, LONG_SIDE, LONG_SIDE / 8, BLAS_L3_SPLIT_MN, 4,
+                             4, 8, 256, 1, &tm, &tn);
+    ASSERT_EQUAL(4, n);
+    ASSERT_EQUAL(1, tm);
+    ASSERT_EQUAL(4, tn);
+
+    /* Tall C, but the caller (trsm from the left) only splits n */
+    n = blas_level3_nthreads(LONG_SIDE, SHORT_SIDE * 8, LONG_SIDE / 8, BLAS_L3_SPLIT_N, 4,
+                             4, 8, 256, 1, &tm, &tn);
+    ASSERT_EQUAL(1, tm);
+    ASSERT_EQUAL(n, tn);
+
+    /* Too small to be worth a second thread */
+    n = blas_level3_nthreads(16, 16, 16, BLAS_L3_SPLIT_MN, 4, 4, 8, 256, 1, &tm, &tn);
+    ASSERT_EQUAL(1, n);
+    ASSERT_EQUAL(1, tm);
+    ASSERT_EQUAL(1, tn);
+
+    /* A small C with a long k is cut into k slices */
+    ASSERT_TRUE(blas_level3_nthreads_k(SHORT_SIDE, SHORT_SIDE, LONG_SIDE * 50, 4, 4, 8, 256, 1) > 1);
+}
+
+/**
+ * Check that the cost model stops adding threads once the extra ones
+ * cost more in packing and synchronization than they save
+ */
+CTEST(level3_threads, split_economy)
+{
+    BLASLONG tm, tn;
+    int n;
+
+    /* Tall C with a short k: some, but not all, of 16 threads over m */
+    n = blas_level3_nthreads(LONG_SIDE, SHORT_SIDE, 64, BLAS_L3_SPLIT_MN, 16,
+                             4, 8, 256, 1, &tm, &tn);
+    ASSERT_TRUE(n > 1);
+    ASSERT_TRUE(n < 16);
+    ASSERT_EQUAL(n, tm);
+    ASSERT_EQUAL(1, tn);
+
+    /* A square C has enough blocks for every thread */
+    n = blas_level3_nthreads(512, 512, 512, BLAS_L3_SPLIT_MN, 16, 4, 8, 256, 1, &tm, &tn);
+    ASSERT_EQUAL(16, n);
+    ASSERT_EQUAL(16, tm * tn);
+
+    /* A Gram matrix takes every thread as k slices, a square C none */
+    ASSERT_EQUAL(16, blas_level3_nthreads_k(64, 64, 1e7, 16, 4, 8, 256, 1));
+    ASSERT_EQUAL(1, blas_level3_nthreads_k(512, 512, 512, 16, 4, 8, 256, 1));
+}
+#endif
+#endif
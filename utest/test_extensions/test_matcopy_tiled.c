@@ -0,0 +1,352 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <math.h>
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 200000
+
+static double a_test[DATASIZE];
+static double b_test[DATASIZE];
+static double b_verify[DATASIZE];
+static float sa_test[DATASIZE];
+static float sb_test[DATASIZE];
+
+/**
+ * Reference ?omatcopy in double precision. cplx selects complex elements,
+ * trans is one of 'N', 'T', 'C' (conjugate transpose) and 'R' (conjugate).
+ */
+static void ref_matcopy(char order, char trans, int cplx, blasint rows, blasint cols, double *alpha,
+                        double *a, blasint lda, double *b, blasint ldb)
+{
+    blasint i, j, m = rows, n = cols, src, dst;
+    double re, im;
+
+    if (order == 'R') {
+        m = cols; n = rows;
+    }
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            src = i + j * lda;
+            dst = (trans == 'T' || trans == 'C') ? j + i * ldb : i + j * ldb;
+            if (!cplx) {
+                b[dst] = alpha[0] * a[src];
+            } else {
+                re = a[src * 2];
+                im = (trans == 'C' || trans == 'R') ? -a[src * 2 + 1] : a[src * 2 + 1];
+                b[dst * 2]     = alpha[0] * re - alpha[1] * im;
+                b[dst * 2 + 1] = alpha[0] * im + alpha[1] * re;
+            }
+        }
+    }
+}
+
+/**
+ * Leading (outer) dimension of the result of a matcopy
+ */
+static blasint outer_dim(char order, char trans, blasint rows, blasint cols)
+{
+    int t = (trans == 'T' || trans == 'C');
+
+    return (order == 'C') != t ? cols : rows;
+}
+
+/**
+ * Inner dimension of the result of a matcopy
+ */
+static blasint inner_dim(char order, char trans, blasint rows, blasint cols)
+{
+    return outer_dim(order, trans, rows, cols) == cols ? rows : cols;
+}
+
+/**
+ * Largest difference between the inner x outer matrices x and y
+ */
+static double max_difference(double *x, double *y, blasint inner, blasint outer, blasint ld)
+{
+    blasint i, j;
+    double d, dmax = 0.0;
+
+    for (j = 0; j < outer; j++)
+        for (i = 0; i < inner; i++) {
+            d = fabs(x[i + j * ld] - y[i + j * ld]);
+            if (d > dmax) dmax = d;
+        }
+
+    return dmax;
+}
+
+#ifdef BUILD_DOUBLE
+/**
+ * ?omatcopy on four threads (or in place with ?imatcopy when inplace is set)
+ * against the reference, in double or double complex
+ */
+static double check_dmatcopy(char order, char trans, int cplx, int inplace, blasint rows, blasint cols,
+                             blasint lda, blasint ldb)
+{
+    int nthreads = openblas_get_num_threads();
+    double alpha[2] = {1.5, -0.75};
+    blasint w = cplx ? 2 : 1;
+    blasint outer = outer_dim(order, trans, rows, cols), inner = inner_dim(order, trans, rows, cols);
+
+    drand_generate(a_test, DATASIZE);
+    drand_generate(b_test, DATASIZE);
+    memcpy(b_verify, b_test, sizeof(double) * DATASIZE);
+
+    ref_matcopy(order, trans, cplx, rows, cols, alpha, a_test, lda, b_verify, ldb);
+
+    openblas_set_num_threads(4);
+    if (!inplace) {
+        if (cplx) BLASFUNC(zomatcopy)(&order, &trans, &rows, &cols, alpha, a_test, &lda, b_test, &ldb);
+        else      BLASFUNC(domatcopy)(&order, &trans, &rows, &cols, alpha, a_test, &lda, b_test, &ldb);
+    } else {
+        if (cplx) BLASFUNC(zimatcopy)(&order, &trans, &rows, &cols, alpha, a_test, &lda, &ldb);
+        else      BLASFUNC(dimatcopy)(&order, &trans, &rows, &cols, alpha, a_test, &lda, &ldb);
+    }
+    openblas_set_num_threads(nthreads);
+
+    if (!inplace)
+        return max_difference(b_test, b_verify, DATASIZE, 1, DATASIZE);
+
+    return max_difference(a_test, b_verify, inner * w, outer, ldb * w);
+}
+
+/**
+ * Column major, no transpose, split over the threads by columns
+ */
+CTEST(matcopy, domatcopy_col_notrans)
+{
+    double diff = check_dmatcopy('C', 'N', 0, 0, 400, 300, 401, 405);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * Row major transpose, sizes not a multiple of the register tile
+ */
+CTEST(matcopy, domatcopy_row_trans)
+{
+    double diff = check_dmatcopy('R', 'T', 0, 0, 299, 301, 305, 300);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * Row major double complex transpose
+ */
+CTEST(matcopy, zomatcopy_row_trans)
+{
+    double diff = check_dmatcopy('R', 'T', 1, 0, 180, 211, 220, 190);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * In-place row major transpose of a rectangular matrix with padded leading dimensions
+ */
+CTEST(matcopy, dimatcopy_row_trans_rectangular)
+{
+    double diff = check_dmatcopy('R', 'T', 0, 1, 91, 140, 150, 100);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * In-place conjugate transpose of a rectangular matrix, lda > ldb
+ */
+CTEST(matcopy, zimatcopy_col_conjtrans_rectangular)
+{
+    double diff = check_dmatcopy('C', 'C', 1, 1, 64, 45, 70, 50);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * In-place transpose of more elements than one window of the cycle bitmap
+ */
+CTEST(matcopy, dimatcopy_col_trans_windows)
+{
+    double diff = check_dmatcopy('C', 'T', 0, 1, 301, 157, 301, 157);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_EPS);
+}
+
+/**
+ * Same for a complex matrix
+ */
+CTEST(matcopy, zimatcopy_row_trans_windows)
+{
+    double diff = check_dmatcopy('R', 'T', 1, 1, 170, 211, 211, 170);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * With alpha = 0 the result has to be zero even where A holds NaN,
+ * returns how many elements of the result are not zero
+ */
+static blasint check_dmatcopy_zero(char order, char trans, int cplx, int inplace, blasint rows, blasint cols,
+                                   blasint lda, blasint ldb)
+{
+    double alpha[2] = {0.0, 0.0};
+    double *r = inplace ? a_test : b_test;
+    blasint i, j, bad = 0, w = cplx ? 2 : 1;
+    blasint outer = outer_dim(order, trans, rows, cols), inner = inner_dim(order, trans, rows, cols);
+
+    for (i = 0; i < DATASIZE; i++) a_test[i] = NAN;
+    drand_generate(b_test, DATASIZE);
+
+    if (!inplace) {
+        if (cplx) BLASFUNC(zomatcopy)(&order, &trans, &rows, &cols, alpha, a_test, &lda, b_test, &ldb);
+        else      BLASFUNC(domatcopy)(&order, &trans, &rows, &cols, alpha, a_test, &lda, b_test, &ldb);
+    } else {
+        if (cplx) BLASFUNC(zimatcopy)(&order, &trans, &rows, &cols, alpha, a_test, &lda, &ldb);
+        else      BLASFUNC(dimatcopy)(&order, &trans, &rows, &cols, alpha, a_test, &lda, &ldb);
+    }
+
+    for (j = 0; j < outer; j++)
+        for (i = 0; i < inner * w; i++)
+            if (r[i + j * ldb * w] != 0.0) bad++;
+
+    return bad;
+}
+
+/**
+ * alpha = 0 clears the result of the tiled transpose kernels and of the
+ * in-place permutation, whatever A holds
+ */
+CTEST(matcopy, alpha_zero_nan)
+{
+    ASSERT_EQUAL(0, check_dmatcopy_zero('C', 'T', 0, 0, 70, 45, 72, 50));
+    ASSERT_EQUAL(0, check_dmatcopy_zero('R', 'T', 1, 0, 33, 40, 41, 36));
+    ASSERT_EQUAL(0, check_dmatcopy_zero('R', 'T', 0, 1, 31, 20, 20, 31));
+    ASSERT_EQUAL(0, check_dmatcopy_zero('C', 'C', 1, 1, 17, 23, 17, 23));
+}
+#endif
+
+#ifdef BUILD_SINGLE
+/**
+ * ?omatcopy on four threads (or in place with ?imatcopy when inplace is set)
+ * against the reference, in single or single complex
+ */
+static double check_smatcopy(char order, char trans, int cplx, int inplace, blasint rows, blasint cols,
+                             blasint lda, blasint ldb)
+{
+    int nthreads = openblas_get_num_threads();
+    float alpha[2] = {1.5f, -0.75f};
+    double alpha_d[2] = {1.5, -0.75};
+    blasint i, w = cplx ? 2 : 1;
+    blasint outer = outer_dim(order, trans, rows, cols), inner = inner_dim(order, trans, rows, cols);
+
+    srand_generate(sa_test, DATASIZE);
+    srand_generate(sb_test, DATASIZE);
+    for (i = 0; i < DATASIZE; i++) {
+        a_test[i] = sa_test[i];
+        b_verify[i] = sb_test[i];
+    }
+
+    ref_matcopy(order, trans, cplx, rows, cols, alpha_d, a_test, lda, b_verify, ldb);
+
+    openblas_set_num_threads(4);
+    if (!inplace) {
+        if (cplx) BLASFUNC(comatcopy)(&order, &trans, &rows, &cols, alpha, sa_test, &lda, sb_test, &ldb);
+        else      BLASFUNC(somatcopy)(&order, &trans, &rows, &cols, alpha, sa_test, &lda, sb_test, &ldb);
+    } else {
+        if (cplx) BLASFUNC(cimatcopy)(&order, &trans, &rows, &cols, alpha, sa_test, &lda, &ldb);
+        else      BLASFUNC(simatcopy)(&order, &trans, &rows, &cols, alpha, sa_test, &lda, &ldb);
+    }
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < DATASIZE; i++)
+        b_test[i] = inplace ? sa_test[i] : sb_test[i];
+
+    if (!inplace)
+        return max_difference(b_test, b_verify, DATASIZE, 1, DATASIZE);
+
+    return max_difference(b_test, b_verify, inner * w, outer, ldb * w);
+}
+
+/**
+ * Column major transpose, split over the threads by columns of A
+ */
+CTEST(matcopy, somatcopy_col_trans)
+{
+    float diff = check_smatcopy('C', 'T', 0, 0, 301, 257, 310, 270);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, SINGLE_TOL);
+}
+
+/**
+ * Row major transpose, split over the threads by rows of A
+ */
+CTEST(matcopy, somatcopy_row_trans)
+{
+    float diff = check_smatcopy('R', 'T', 0, 0, 255, 333, 340, 260);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, SINGLE_TOL);
+}
+
+/**
+ * Column major single complex conjugate transpose
+ */
+CTEST(matcopy, comatcopy_col_conjtrans)
+{
+    float diff = check_smatcopy('C', 'C', 1, 0, 203, 190, 210, 200);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, SINGLE_TOL);
+}
+
+/**
+ * In-place transpose of a rectangular matrix stored without padding
+ */
+CTEST(matcopy, simatcopy_col_trans_rectangular)
+{
+    float diff = check_smatcopy('C', 'T', 0, 1, 123, 77, 123, 77);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, SINGLE_TOL);
+}
+
+/**
+ * In-place conjugate copy to a larger leading dimension
+ */
+CTEST(matcopy, cimatcopy_row_conj_ld)
+{
+    float diff = check_smatcopy('R', 'R', 1, 1, 33, 55, 60, 80);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, SINGLE_TOL);
+}
+#endif
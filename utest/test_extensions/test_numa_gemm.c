@@ -0,0 +1,164 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DIM 600
+
+#ifdef BUILD_DOUBLE
+static double a_test[DIM * DIM];
+static double b_test[DIM * DIM];
+static double c_test[DIM * DIM];
+static double c_verify[DIM * DIM];
+
+/**
+ * Run dgemm with four threads in and out of the NUMA mode and compare.
+ * On a single node machine both take the same path, which checks that
+ * the mode leaves such calls alone.
+ */
+static void check_numa(char *transa, blasint m, blasint n, blasint k)
+{
+    int nthreads = openblas_get_num_threads();
+    int old;
+    double alpha = 1.5, beta = 0.5;
+    blasint lda = (*transa == 'N') ? m : k;
+    blasint i;
+
+    drand_generate(a_test, DIM * DIM);
+    drand_generate(b_test, DIM * DIM);
+    drand_generate(c_verify, m * n);
+    memcpy(c_test, c_verify, sizeof(double) * m * n);
+
+    openblas_set_num_threads(4);
+
+    old = openblas_set_numa_gemm(0);
+    BLASFUNC(dgemm)(transa, "N", &m, &n, &k, &alpha, a_test, &lda, b_test, &k, &beta, c_verify, &m);
+
+    openblas_set_numa_gemm(1);
+    BLASFUNC(dgemm)(transa, "N", &m, &n, &k, &alpha, a_test, &lda, b_test, &k, &beta, c_test, &m);
+
+    openblas_set_numa_gemm(old);
+    openblas_set_num_threads(nthreads);
+
+    for (i = 0; i < m * n; i++)
+        ASSERT_DBL_NEAR_TOL(c_verify[i], c_test[i], 1e-10);
+}
+
+/**
+ * Test switching the mode
+ */
+CTEST(numa_gemm, set_and_get)
+{
+    int old = openblas_get_numa_gemm();
+
+    ASSERT_EQUAL(old, openblas_set_numa_gemm(1));
+    ASSERT_EQUAL(1, openblas_get_numa_gemm());
+    ASSERT_EQUAL(1, openblas_set_numa_gemm(0));
+    ASSERT_EQUAL(0, openblas_get_numa_gemm());
+
+    openblas_set_numa_gemm(old);
+}
+
+#ifdef SMP
+/**
+ * Test the plan of the split on a fake table of three nodes of four
+ * threads, with the caller on the last node. Six threads take the
+ * caller's node and two threads of the first one.
+ */
+CTEST(numa_gemm, split_two_nodes)
+{
+    int node[3] = {0, 1, 2}, threads[3] = {4, 4, 4};
+    BLASLONG range[4];
+
+    ASSERT_EQUAL(2, blas_node_split(6, 600, 2, 3, node, threads, range));
+    ASSERT_EQUAL(2, node[0]);
+    ASSERT_EQUAL(1, node[1]);
+    ASSERT_EQUAL(4, threads[0]);
+    ASSERT_EQUAL(2, threads[1]);
+    ASSERT_EQUAL(0, range[0]);
+    ASSERT_EQUAL(400, range[1]);
+    ASSERT_EQUAL(600, range[2]);
+}
+
+/**
+ * More threads than the table holds: all nodes are used and the caller's
+ * node takes the excess
+ */
+CTEST(numa_gemm, split_oversubscribed)
+{
+    int node[3] = {0, 1, 2}, threads[3] = {2, 2, 2};
+    BLASLONG range[4];
+
+    ASSERT_EQUAL(3, blas_node_split(8, 600, 0, 3, node, threads, range));
+    ASSERT_EQUAL(0, node[0]);
+    ASSERT_EQUAL(4, threads[0]);
+    ASSERT_EQUAL(2, threads[1]);
+    ASSERT_EQUAL(2, threads[2]);
+    ASSERT_EQUAL(300, range[1]);
+    ASSERT_EQUAL(450, range[2]);
+    ASSERT_EQUAL(600, range[3]);
+}
+
+/**
+ * Threads that fit on the caller's node, or no table at all, do not split
+ */
+CTEST(numa_gemm, split_one_node)
+{
+    int node[2] = {0, 1}, threads[2] = {8, 8};
+    BLASLONG range[3];
+
+    ASSERT_EQUAL(1, blas_node_split(4, 600, 1, 2, node, threads, range));
+    ASSERT_EQUAL(1, node[0]);
+    ASSERT_EQUAL(600, range[1]);
+    ASSERT_EQUAL(0, blas_node_split(4, 600, 0, 0, node, threads, range));
+}
+#endif
+
+/**
+ * C taller than wide, split over m between nodes
+ */
+CTEST(numa_gemm, dgemm_tall)
+{
+    check_numa("N", DIM, DIM / 3, DIM / 2);
+}
+
+/**
+ * C wider than tall, split over n between nodes
+ */
+CTEST(numa_gemm, dgemm_wide)
+{
+    check_numa("T", DIM / 3, DIM, DIM / 2);
+}
+#endif
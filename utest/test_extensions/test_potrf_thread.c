@@ -0,0 +1,201 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#if !defined(NO_CBLAS)
+#ifdef BUILD_DOUBLE
+
+/**
+ * Factor the positive definite A = G G' + n I, with G random, on the
+ * given number of threads and rebuild it from the Cholesky factor.
+ * A nonnegative `neg` makes the diagonal entry A(neg, neg) negative.
+ *
+ * return largest difference between the rebuilt and the original
+ * triangle of A
+ */
+static double check_dpotrf(char uplo, blasint n, blasint lda, blasint neg,
+                           int threads, blasint *info)
+{
+    int nthreads = openblas_get_num_threads();
+    blasint i, j;
+    double *g, *a, *f, *r, diff = 0.0;
+
+    g = (double *)malloc(sizeof(double) * n * n);
+    a = (double *)malloc(sizeof(double) * lda * n);
+    f = (double *)calloc((size_t)n * n, sizeof(double));
+    r = (double *)malloc(sizeof(double) * n * n);
+
+    drand_generate(g, n * n);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans, n, n, n,
+                1.0, g, n, g, n, 0.0, r, n);
+    for (i = 0; i < n; i++) r[i + i * n] += n;
+    if (neg >= 0) r[neg + neg * n] = -1.0;
+    for (j = 0; j < n; j++)
+        for (i = 0; i < n; i++) a[i + j * lda] = r[i + j * n];
+
+    openblas_set_num_threads(threads);
+    BLASFUNC(dpotrf)(&uplo, &n, a, &lda, info);
+    openblas_set_num_threads(nthreads);
+
+    if (*info) {
+        free(g); free(a); free(f); free(r);
+        return 0.0;
+    }
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i < n; i++)
+            if ((uplo == 'L') ? (i >= j) : (i <= j)) f[i + j * n] = a[i + j * lda];
+
+    if (uplo == 'L')
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans, n, n, n,
+                    -1.0, f, n, f, n, 1.0, r, n);
+    else
+        cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, n, n, n,
+                    -1.0, f, n, f, n, 1.0, r, n);
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i < n; i++)
+            diff = MAX(diff, fabs(r[i + j * n]) / n);
+
+    free(g); free(a); free(f); free(r);
+
+    return diff;
+}
+
+/**
+ * Several levels of recursive splitting, with padded lda
+ */
+CTEST(potrf_thread, dpotrf_lower)
+{
+    blasint info;
+    double diff = check_dpotrf('L', 900, 903, -1, 4, &info);
+
+    ASSERT_EQUAL(0, info);
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+CTEST(potrf_thread, dpotrf_upper)
+{
+    blasint info;
+    double diff = check_dpotrf('U', 900, 903, -1, 4, &info);
+
+    ASSERT_EQUAL(0, info);
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * Size that is not a multiple of the unrolling
+ */
+CTEST(potrf_thread, dpotrf_odd)
+{
+    blasint info;
+    double diff = check_dpotrf('L', 517, 517, -1, 3, &info);
+
+    ASSERT_EQUAL(0, info);
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+
+/**
+ * The failing leading minor is reported past the first split
+ */
+CTEST(potrf_thread, dpotrf_not_definite_lower)
+{
+    blasint info;
+
+    check_dpotrf('L', 700, 700, 600, 4, &info);
+    ASSERT_EQUAL(601, info);
+}
+
+CTEST(potrf_thread, dpotrf_not_definite_upper)
+{
+    blasint info;
+
+    check_dpotrf('U', 700, 700, 600, 4, &info);
+    ASSERT_EQUAL(601, info);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+
+/**
+ * Complex Hermitian matrix, through the HERK update
+ */
+CTEST(potrf_thread, zpotrf_lower)
+{
+    int nthreads = openblas_get_num_threads();
+    char uplo = 'L';
+    blasint n = 600, info;
+    blasint i, j;
+    double *g, *a, *f, *r, diff = 0.0;
+    double one[2] = {1.0, 0.0}, zero[2] = {0.0, 0.0}, mone[2] = {-1.0, 0.0};
+
+    g = (double *)malloc(sizeof(double) * 2 * n * n);
+    a = (double *)malloc(sizeof(double) * 2 * n * n);
+    f = (double *)calloc((size_t)2 * n * n, sizeof(double));
+    r = (double *)malloc(sizeof(double) * 2 * n * n);
+
+    drand_generate(g, 2 * n * n);
+    cblas_zgemm(CblasColMajor, CblasNoTrans, CblasConjTrans, n, n, n,
+                one, g, n, g, n, zero, r, n);
+    for (i = 0; i < n; i++) {
+        r[2 * (i + i * n)] += n;
+        r[2 * (i + i * n) + 1] = 0.0;
+    }
+    for (i = 0; i < 2 * n * n; i++) a[i] = r[i];
+
+    openblas_set_num_threads(4);
+    BLASFUNC(zpotrf)(&uplo, &n, a, &n, &info);
+    openblas_set_num_threads(nthreads);
+    ASSERT_EQUAL(0, info);
+
+    for (j = 0; j < n; j++)
+        for (i = j; i < n; i++) {
+            f[2 * (i + j * n)]     = a[2 * (i + j * n)];
+            f[2 * (i + j * n) + 1] = a[2 * (i + j * n) + 1];
+        }
+
+    cblas_zgemm(CblasColMajor, CblasNoTrans, CblasConjTrans, n, n, n,
+                mone, f, n, f, n, one, r, n);
+    for (i = 0; i < 2 * n * n; i++)
+        diff = MAX(diff, fabs(r[i]) / n);
+
+    free(g); free(a); free(f); free(r);
+
+    ASSERT_DBL_NEAR_TOL(0.0, diff, DOUBLE_TOL);
+}
+#endif
+#endif
@@ -0,0 +1,185 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 100000
+
+#if defined(BUILD_SINGLE) && !defined(NO_CBLAS)
+static float a_test[DATASIZE];
+static float b_test[DATASIZE];
+static float c_test[DATASIZE];
+static float c_verify[DATASIZE];
+static float bias[1000];
+static bfloat16 c_bf16[DATASIZE];
+
+static float activate(enum CBLAS_ACTIVATION activation, float x)
+{
+    switch (activation) {
+    case CblasReLU:     return (x > 0.0f) ? x : 0.0f;
+    case CblasGELU:     return 0.5f * x * (1.0f + erff(x / sqrtf(2.0f)));
+    case CblasGELUTanh: return 0.5f * x * (1.0f + tanhf(sqrtf(2.0f / 3.14159265f) * (x + 0.044715f * x * x * x)));
+    case CblasSigmoid:  return 1.0f / (1.0f + expf(-x));
+    default:            return x;
+    }
+}
+
+/**
+ * Compare cblas_sgemm_ex running on four threads against cblas_sgemm
+ * followed by the bias and the activation applied element by element.
+ * C is m x n in the given order with leading dimension ldc.
+ *
+ * return largest difference
+ */
+static float check_sgemm_ex(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                            blasint m, blasint n, blasint k, float alpha, float beta, blasint ldc,
+                            enum CBLAS_BIAS bias_type, enum CBLAS_ACTIVATION activation, int to_bf16)
+{
+    int nthreads = openblas_get_num_threads();
+    openblas_gemm_epilogue_t epilogue;
+    blasint i, j, rows, cols, lda, ldb, size;
+    float x, diff, maxdiff = 0.0f;
+
+    rows = (order == CblasColMajor) ? m : n;
+    cols = (order == CblasColMajor) ? n : m;
+    lda = ((transa == CblasNoTrans) == (order == CblasColMajor)) ? m : k;
+    ldb = ((transb == CblasNoTrans) == (order == CblasColMajor)) ? k : n;
+    if (ldb < 1) ldb = 1;
+    size = ldc * cols;
+
+    srand_generate(a_test, DATASIZE);
+    srand_generate(b_test, DATASIZE);
+    srand_generate(c_test, size);
+    srand_generate(bias, 1000);
+    memcpy(c_verify, c_test, sizeof(float) * size);
+
+    cblas_sgemm(order, transa, transb, m, n, k, alpha, a_test, lda, b_test, ldb, beta, c_verify, ldc);
+
+    for (j = 0; j < cols; j++) {
+        for (i = 0; i < rows; i++) {
+            x = c_verify[i + j * ldc];
+            /* element (i, j) of the storage is C(i, j) in column major and C(j, i) in row major order */
+            if (bias_type == CblasRowBias) x += bias[(order == CblasColMajor) ? i : j];
+            if (bias_type == CblasColBias) x += bias[(order == CblasColMajor) ? j : i];
+            c_verify[i + j * ldc] = activate(activation, x);
+        }
+    }
+
+    epilogue.bias_type  = bias_type;
+    epilogue.bias       = bias;
+    epilogue.activation = activation;
+    epilogue.C_bf16     = to_bf16 ? c_bf16 : NULL;
+    epilogue.ldc_bf16   = rows;
+
+    openblas_set_num_threads(4);
+    cblas_sgemm_ex(order, transa, transb, m, n, k, alpha, a_test, lda, b_test, ldb, beta, c_test, ldc, &epilogue);
+    openblas_set_num_threads(nthreads);
+
+    for (j = 0; j < cols; j++) {
+        for (i = 0; i < rows; i++) {
+            diff = fabsf(c_verify[i + j * ldc] - c_test[i + j * ldc]);
+            if (diff > maxdiff) maxdiff = diff;
+
+            if (to_bf16) {
+                uint32_t bits = (uint32_t)c_bf16[i + j * rows] << 16;
+                memcpy(&x, &bits, sizeof(x));
+                /* bfloat16 keeps 8 significant bits */
+                if (fabsf(x - c_test[i + j * ldc]) > fabsf(c_test[i + j * ldc]) / 128.0f) maxdiff = 1.0f;
+            }
+        }
+    }
+
+    return maxdiff;
+}
+
+/**
+ * Large product split over the threads, bias per row of C and ReLU
+ */
+CTEST(sgemm_ex, relu_row_bias_threads)
+{
+    float diff = check_sgemm_ex(CblasColMajor, CblasNoTrans, CblasTrans, 300, 250, 200,
+                                0.5f, 1.0f, 302, CblasRowBias, CblasReLU, 0);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, diff, SINGLE_TOL);
+}
+
+/**
+ * Row major storage with a bias per column, GELU and beta = 0
+ */
+CTEST(sgemm_ex, gelu_col_bias_row_major)
+{
+    float diff = check_sgemm_ex(CblasRowMajor, CblasTrans, CblasNoTrans, 70, 90, 60,
+                                1.0f, 0.0f, 95, CblasColBias, CblasGELU, 0);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, diff, SINGLE_TOL);
+}
+
+/**
+ * Tanh approximation of GELU with a bfloat16 copy of the result
+ */
+CTEST(sgemm_ex, gelu_tanh_bf16_output)
+{
+    float diff = check_sgemm_ex(CblasColMajor, CblasTrans, CblasTrans, 150, 130, 170,
+                                1.0f, -1.0f, 150, CblasColBias, CblasGELUTanh, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, diff, SINGLE_TOL);
+}
+
+/**
+ * Without a product (k = 0) only beta, the bias and the activation apply
+ */
+CTEST(sgemm_ex, sigmoid_k_zero)
+{
+    float diff = check_sgemm_ex(CblasColMajor, CblasNoTrans, CblasNoTrans, 40, 30, 0,
+                                1.0f, 2.0f, 40, CblasRowBias, CblasSigmoid, 0);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, diff, SINGLE_TOL);
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info for an unknown activation
+ */
+CTEST(sgemm_ex, xerbla_unknown_activation)
+{
+    openblas_gemm_epilogue_t epilogue = {CblasNoBias, NULL, (enum CBLAS_ACTIVATION)0, NULL, 0};
+
+    set_xerbla("SGEMM_EX ", 14);
+    cblas_sgemm_ex(CblasColMajor, CblasNoTrans, CblasNoTrans, 10, 10, 10, 1.0f,
+                   a_test, 10, b_test, 10, 0.0f, c_test, 10, &epilogue);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+#endif
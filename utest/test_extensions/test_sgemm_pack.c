@@ -0,0 +1,214 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 300
+
+struct DATA_SGEMM_PACK {
+    float a_test[DATASIZE * DATASIZE];
+    float b_test[DATASIZE * DATASIZE];
+    float c_test[DATASIZE * DATASIZE];
+    float c_verify[DATASIZE * DATASIZE];
+};
+
+#if defined(BUILD_SINGLE) && !defined(NO_CBLAS)
+static struct DATA_SGEMM_PACK data_sgemm_pack;
+
+/**
+ * Compare results of cblas_sgemm_compute against cblas_sgemm
+ *
+ * param order specifies row or column major order
+ * param transa specifies op(A), the transposition operation applied to A
+ * param transb specifies op(B), the transposition operation applied to B
+ * param packa, packb - pack A and/or B with cblas_sgemm_pack beforehand
+ * param m, n, k - dimensions of the product op(A) * op(B)
+ * param alpha - scaling factor applied while packing (1.0 for unpacked operands)
+ * param beta - scaling factor for matrix C
+ * return norm of differences
+ */
+static float check_sgemm_pack(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                              enum CBLAS_TRANSPOSE transb, int packa, int packb,
+                              blasint m, blasint n, blasint k, float alpha, float beta)
+{
+    blasint lda, ldb, ldc, a_cols, b_cols, c_cols;
+    blasint i;
+    float *a_pack = NULL, *b_pack = NULL;
+    float gemm_alpha = 1.0f;
+
+    if (order == CblasColMajor) {
+        lda = (transa == CblasNoTrans) ? m : k;
+        ldb = (transb == CblasNoTrans) ? k : n;
+        a_cols = (transa == CblasNoTrans) ? k : m;
+        b_cols = (transb == CblasNoTrans) ? n : k;
+        ldc = m; c_cols = n;
+    } else {
+        lda = (transa == CblasNoTrans) ? k : m;
+        ldb = (transb == CblasNoTrans) ? n : k;
+        a_cols = (transa == CblasNoTrans) ? m : k;
+        b_cols = (transb == CblasNoTrans) ? k : n;
+        ldc = n; c_cols = m;
+    }
+
+    srand_generate(data_sgemm_pack.a_test, lda * a_cols);
+    srand_generate(data_sgemm_pack.b_test, ldb * b_cols);
+    srand_generate(data_sgemm_pack.c_test, ldc * c_cols);
+
+    for (i = 0; i < ldc * c_cols; i++)
+        data_sgemm_pack.c_verify[i] = data_sgemm_pack.c_test[i];
+
+    if (packa) gemm_alpha *= alpha;
+    if (packb) gemm_alpha *= alpha;
+
+    cblas_sgemm(order, transa, transb, m, n, k, gemm_alpha, data_sgemm_pack.a_test, lda,
+                data_sgemm_pack.b_test, ldb, beta, data_sgemm_pack.c_verify, ldc);
+
+    if (packa) {
+        a_pack = (float *)malloc(cblas_sgemm_pack_get_size(CblasAMatrix, m, n, k));
+        cblas_sgemm_pack(order, CblasAMatrix, transa, m, n, k, alpha,
+                         data_sgemm_pack.a_test, lda, a_pack);
+    }
+    if (packb) {
+        b_pack = (float *)malloc(cblas_sgemm_pack_get_size(CblasBMatrix, m, n, k));
+        cblas_sgemm_pack(order, CblasBMatrix, transb, m, n, k, alpha,
+                         data_sgemm_pack.b_test, ldb, b_pack);
+    }
+
+    cblas_sgemm_compute(order, packa ? CblasPacked : transa, packb ? CblasPacked : transb,
+                        m, n, k, packa ? a_pack : data_sgemm_pack.a_test, lda,
+                        packb ? b_pack : data_sgemm_pack.b_test, ldb,
+                        beta, data_sgemm_pack.c_test, ldc);
+
+    free(a_pack);
+    free(b_pack);
+
+    return smatrix_difference(data_sgemm_pack.c_test, data_sgemm_pack.c_verify, ldc, c_cols, ldc);
+}
+
+/**
+ * Test sgemm_compute with packed A, A not transposed, B not transposed
+ */
+CTEST(sgemm_pack, colmajor_pack_a_notrans_notrans)
+{
+    float norm = check_sgemm_pack(CblasColMajor, CblasNoTrans, CblasNoTrans, 1, 0,
+                                  100, 50, 300, 2.0f, 1.5f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_TOL);
+}
+
+/**
+ * Test sgemm_compute with packed A, A transposed, B transposed
+ */
+CTEST(sgemm_pack, colmajor_pack_a_trans_trans)
+{
+    float norm = check_sgemm_pack(CblasColMajor, CblasTrans, CblasTrans, 1, 0,
+                                  257, 33, 129, 1.0f, 0.0f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_TOL);
+}
+
+/**
+ * Test sgemm_compute with packed B, A transposed, B not transposed
+ */
+CTEST(sgemm_pack, colmajor_pack_b_trans_notrans)
+{
+    float norm = check_sgemm_pack(CblasColMajor, CblasTrans, CblasNoTrans, 0, 1,
+                                  61, 290, 270, 0.5f, 2.0f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_TOL);
+}
+
+/**
+ * Test sgemm_compute with both operands packed
+ */
+CTEST(sgemm_pack, colmajor_pack_ab_notrans_trans)
+{
+    float norm = check_sgemm_pack(CblasColMajor, CblasNoTrans, CblasTrans, 1, 1,
+                                  150, 99, 280, 0.5f, 1.0f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_TOL);
+}
+
+/**
+ * Test sgemm_compute in row major order with packed A
+ */
+CTEST(sgemm_pack, rowmajor_pack_a_notrans_notrans)
+{
+    float norm = check_sgemm_pack(CblasRowMajor, CblasNoTrans, CblasNoTrans, 1, 0,
+                                  77, 120, 260, 1.0f, 0.5f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_TOL);
+}
+
+/**
+ * Test sgemm_compute in row major order with packed B
+ */
+CTEST(sgemm_pack, rowmajor_pack_b_trans_trans)
+{
+    float norm = check_sgemm_pack(CblasRowMajor, CblasTrans, CblasTrans, 0, 1,
+                                  200, 17, 90, 2.0f, 0.0f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_TOL);
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when the leading dimension passed to sgemm_pack is too small
+ */
+CTEST(sgemm_pack, xerbla_pack_invalid_ld)
+{
+    set_xerbla("SGEMM_PACK ", 9);
+    cblas_sgemm_pack(CblasColMajor, CblasAMatrix, CblasNoTrans, 50, 50, 50, 1.0f,
+                     data_sgemm_pack.a_test, 49, data_sgemm_pack.c_test);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info when the packed A does not match the problem size
+ */
+CTEST(sgemm_pack, xerbla_compute_mismatched_pack)
+{
+    float *a_pack = (float *)malloc(cblas_sgemm_pack_get_size(CblasAMatrix, 20, 20, 20));
+
+    cblas_sgemm_pack(CblasColMajor, CblasAMatrix, CblasNoTrans, 20, 20, 20, 1.0f,
+                     data_sgemm_pack.a_test, 20, a_pack);
+
+    set_xerbla("SGEMM_COMPUTE ", 6);
+    cblas_sgemm_compute(CblasColMajor, CblasPacked, CblasNoTrans, 20, 20, 30, a_pack, 20,
+                        data_sgemm_pack.b_test, 30, 0.0f, data_sgemm_pack.c_test, 20);
+    free(a_pack);
+    ASSERT_EQUAL(TRUE, check_error());
+}
+#endif
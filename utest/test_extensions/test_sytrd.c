@@ -0,0 +1,236 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#if !defined(NO_CBLAS)
+#ifdef BUILD_DOUBLE
+
+/**
+ * Number of eigenvalues of the tridiagonal matrix (d, e) below x,
+ * from the signs of the LDL' pivots of T - x I.
+ */
+static blasint sturm_count(blasint n, double *d, double *e, double x)
+{
+    blasint i, count = 0;
+    double p = d[0] - x;
+
+    if (p < 0.0) count++;
+    for (i = 1; i < n; i++) {
+        if (p == 0.0) p = 1e-300;
+        p = d[i] - x - e[i - 1] * e[i - 1] / p;
+        if (p < 0.0) count++;
+    }
+    return count;
+}
+
+/**
+ * Reduce A = Q diag(1, ..., n) Q', with Q orthogonal from the QR of a
+ * random matrix, to tridiagonal form with dsytrd_2stage and check by
+ * Sturm counts that the eigenvalues of the result are still 1, ..., n.
+ *
+ * return number of eigenvalues found in the wrong unit interval
+ */
+static blasint check_dsytrd_2stage(char uplo, blasint n, int threads, int short_work)
+{
+    int nthreads = openblas_get_num_threads();
+    char vect = 'N';
+    blasint lhous2 = 4 * n, lwork = -1, info;
+    blasint i, j, errors = 0;
+    double *q, *qd, *a, *d, *e, *tau, *hous2, *work, query;
+
+    q     = (double *)malloc(sizeof(double) * n * n);
+    qd    = (double *)malloc(sizeof(double) * n * n);
+    a     = (double *)malloc(sizeof(double) * n * n);
+    d     = (double *)malloc(sizeof(double) * n);
+    e     = (double *)malloc(sizeof(double) * n);
+    tau   = (double *)malloc(sizeof(double) * n);
+    hous2 = (double *)malloc(sizeof(double) * lhous2);
+    work  = (double *)malloc(sizeof(double) * 64 * n);
+
+    drand_generate(q, n * n);
+    lwork = 64 * n;
+    BLASFUNC(dgeqrf)(&n, &n, q, &n, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+    BLASFUNC(dorgqr)(&n, &n, &n, q, &n, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+    free(work);
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i < n; i++) qd[i + j * n] = q[i + j * n] * (j + 1);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans, n, n, n,
+                1.0, qd, n, q, n, 0.0, a, n);
+
+    lwork = -1;
+    BLASFUNC(dsytrd_2stage)(&vect, &uplo, &n, a, &n, d, e, tau, hous2, &lhous2, &query, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+    lwork = short_work ? 98 * n + 2048 : (blasint)query;
+    work  = (double *)malloc(sizeof(double) * lwork);
+
+    openblas_set_num_threads(threads);
+    BLASFUNC(dsytrd_2stage)(&vect, &uplo, &n, a, &n, d, e, tau, hous2, &lhous2, work, &lwork, &info);
+    openblas_set_num_threads(nthreads);
+    ASSERT_EQUAL(0, info);
+
+    for (i = 0; i <= n; i++)
+        if (sturm_count(n, d, e, i + 0.5) != i) errors++;
+
+    free(q); free(qd); free(a); free(d); free(e); free(tau); free(hous2); free(work);
+
+    return errors;
+}
+
+CTEST(sytrd, dsytrd_2stage_lower)
+{
+    blasint errors = check_dsytrd_2stage('L', 300, 1, 0);
+
+    ASSERT_EQUAL(0, errors);
+}
+
+CTEST(sytrd, dsytrd_2stage_upper)
+{
+    blasint errors = check_dsytrd_2stage('U', 300, 1, 0);
+
+    ASSERT_EQUAL(0, errors);
+}
+
+/**
+ * Large enough for the parallel bulge chasing and a wider band
+ */
+CTEST(sytrd, dsytrd_2stage_lower_threaded)
+{
+    blasint errors = check_dsytrd_2stage('L', 600, 4, 0);
+
+    ASSERT_EQUAL(0, errors);
+}
+
+CTEST(sytrd, dsytrd_2stage_upper_threaded)
+{
+    blasint errors = check_dsytrd_2stage('U', 600, 4, 0);
+
+    ASSERT_EQUAL(0, errors);
+}
+
+/**
+ * Bandwidth wider than the matrix
+ */
+CTEST(sytrd, dsytrd_2stage_small)
+{
+    blasint errors = check_dsytrd_2stage('L', 10, 1, 0) + check_dsytrd_2stage('U', 10, 1, 0);
+
+    ASSERT_EQUAL(0, errors);
+}
+
+/**
+ * Minimal work array from the LAPACK formula, so the routine
+ * allocates its own
+ */
+CTEST(sytrd, dsytrd_2stage_short_work)
+{
+    blasint errors = check_dsytrd_2stage('L', 520, 4, 1);
+
+    ASSERT_EQUAL(0, errors);
+}
+
+/**
+ * Only the eigenvalue-only reduction is supported
+ */
+CTEST(sytrd, xerbla_vect)
+{
+    char vect = 'V', uplo = 'L';
+    blasint n = 10, lhous2 = 40, lwork = 4096, info;
+    double a[100], d[10], e[10], tau[10], hous2[40], work[4096];
+
+    set_xerbla("DSYTRD_2STAGE", 1);
+    BLASFUNC(dsytrd_2stage)(&vect, &uplo, &n, a, &n, d, e, tau, hous2, &lhous2, work, &lwork, &info);
+    ASSERT_EQUAL(TRUE, check_error());
+    ASSERT_EQUAL(-1, info);
+}
+#endif
+
+#ifdef BUILD_SINGLE
+
+/**
+ * Single precision, checked against the diagonal of A = Q diag(1, ..., n) Q'
+ * through the trace and the Frobenius norm, which the reduction keeps.
+ */
+CTEST(sytrd, ssytrd_2stage_lower)
+{
+    int nthreads = openblas_get_num_threads();
+    char vect = 'N', uplo = 'L';
+    blasint n = 200, lhous2 = 800, lwork = 128 * 200, info;
+    blasint i, j;
+    float *q, *qd, *a, *d, *e, *tau, *hous2, *work;
+    double trace = 0.0, norm = 0.0;
+
+    q     = (float *)malloc(sizeof(float) * n * n);
+    qd    = (float *)malloc(sizeof(float) * n * n);
+    a     = (float *)malloc(sizeof(float) * n * n);
+    d     = (float *)malloc(sizeof(float) * n);
+    e     = (float *)malloc(sizeof(float) * n);
+    tau   = (float *)malloc(sizeof(float) * n);
+    hous2 = (float *)malloc(sizeof(float) * lhous2);
+    work  = (float *)malloc(sizeof(float) * lwork);
+
+    srand_generate(q, n * n);
+    BLASFUNC(sgeqrf)(&n, &n, q, &n, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+    BLASFUNC(sorgqr)(&n, &n, &n, q, &n, tau, work, &lwork, &info);
+    ASSERT_EQUAL(0, info);
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i < n; i++) qd[i + j * n] = q[i + j * n] * (j + 1);
+    cblas_sgemm(CblasColMajor, CblasNoTrans, CblasTrans, n, n, n,
+                1.0f, qd, n, q, n, 0.0f, a, n);
+
+    openblas_set_num_threads(4);
+    BLASFUNC(ssytrd_2stage)(&vect, &uplo, &n, a, &n, d, e, tau, hous2, &lhous2, work, &lwork, &info);
+    openblas_set_num_threads(nthreads);
+    ASSERT_EQUAL(0, info);
+
+    for (i = 0; i < n; i++) {
+        trace += d[i];
+        norm  += (double)d[i] * d[i];
+        if (i < n - 1) norm += 2.0 * (double)e[i] * e[i];
+    }
+
+    free(q); free(qd); free(a); free(d); free(e); free(tau); free(hous2); free(work);
+
+    ASSERT_DBL_NEAR_TOL(n * (n + 1) / 2.0, trace, 1e-4 * n * n);
+    ASSERT_DBL_NEAR_TOL(n * (n + 1.0) * (2 * n + 1) / 6.0, norm, 1e-4 * n * n * n);
+}
+#endif
+#endif
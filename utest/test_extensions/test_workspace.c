@@ -0,0 +1,146 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define DATASIZE 200
+
+#if defined(BUILD_DOUBLE) && !defined(OS_WINDOWS)
+static double a_test[DATASIZE * DATASIZE];
+static double b_test[DATASIZE * DATASIZE];
+static double c_test[DATASIZE * DATASIZE];
+
+static void *workspace_gemm(void *arg)
+{
+    blasint n = DATASIZE;
+    char trans = 'N';
+    double alpha = 1.0, beta = 0.0;
+    int i;
+
+    for (i = 0; i < 2; i++)
+        BLASFUNC(dgemm)(&trans, &trans, &n, &n, &n, &alpha, a_test, &n, b_test, &n, &beta, c_test, &n);
+
+    return arg;
+}
+
+/**
+ * Test that a second level 3 call from the same thread reuses
+ * the workspace of the first one
+ */
+CTEST(workspace, reuse_in_thread)
+{
+    size_t hits, misses, hits2, misses2;
+
+    drand_generate(a_test, DATASIZE * DATASIZE);
+    drand_generate(b_test, DATASIZE * DATASIZE);
+
+    openblas_get_workspace_stats(&hits, &misses);
+    workspace_gemm(NULL);
+    openblas_get_workspace_stats(&hits2, &misses2);
+
+    ASSERT_TRUE(hits2 >= hits + 1);
+    ASSERT_EQUAL(hits + misses + 2, hits2 + misses2);
+}
+
+#if defined(SMP) || defined(USE_LOCKING)
+/**
+ * Test that the counts of a thread that used the workspace
+ * are kept after the thread exits
+ */
+CTEST(workspace, counts_survive_thread_exit)
+{
+    size_t hits, misses, hits2, misses2;
+    pthread_t thread;
+
+    drand_generate(a_test, DATASIZE * DATASIZE);
+    drand_generate(b_test, DATASIZE * DATASIZE);
+
+    openblas_get_workspace_stats(&hits, &misses);
+    ASSERT_EQUAL(0, pthread_create(&thread, NULL, workspace_gemm, NULL));
+    ASSERT_EQUAL(0, pthread_join(thread, NULL));
+    openblas_get_workspace_stats(&hits2, &misses2);
+
+    ASSERT_EQUAL(hits + 1, hits2);
+    ASSERT_EQUAL(misses + 1, misses2);
+}
+
+#define MANY_THREADS (NUM_BUFFERS / 2 + 4)
+
+static pthread_mutex_t hold_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  hold_wakeup = PTHREAD_COND_INITIALIZER;
+static int hold_count;
+
+static void *workspace_gemm_hold(void *arg)
+{
+    workspace_gemm(arg);
+
+    /* Stay alive, and keep the buffer, until all threads have run */
+    pthread_mutex_lock(&hold_lock);
+    hold_count ++;
+    pthread_cond_broadcast(&hold_wakeup);
+    while (hold_count < MANY_THREADS)
+        pthread_cond_wait(&hold_wakeup, &hold_lock);
+    pthread_mutex_unlock(&hold_lock);
+
+    return arg;
+}
+
+/**
+ * Test that no more than half of the memory table is kept by
+ * threads, the others borrow a buffer per call
+ */
+CTEST(workspace, cached_threads_limited)
+{
+    size_t hits, misses, hits2, misses2;
+    pthread_t thread[MANY_THREADS];
+    int i;
+
+    drand_generate(a_test, DATASIZE * DATASIZE);
+    drand_generate(b_test, DATASIZE * DATASIZE);
+
+    hold_count = 0;
+    openblas_get_workspace_stats(&hits, &misses);
+    for (i = 0; i < MANY_THREADS; i++)
+        ASSERT_EQUAL(0, pthread_create(&thread[i], NULL, workspace_gemm_hold, NULL));
+    for (i = 0; i < MANY_THREADS; i++)
+        ASSERT_EQUAL(0, pthread_join(thread[i], NULL));
+    openblas_get_workspace_stats(&hits2, &misses2);
+
+    ASSERT_EQUAL(hits + misses + 2 * MANY_THREADS, hits2 + misses2);
+    ASSERT_TRUE(hits2 - hits <= NUM_BUFFERS / 2);
+    ASSERT_TRUE(misses2 - misses >= MANY_THREADS + 4);
+}
+#endif
+#endif